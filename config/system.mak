@@ -0,0 +1,9 @@
+# -*- makefile -*-
+#
+# This file is automatically generated by configure.
+# Do not hand edit.
+
+OSTYPE		:= linux-gnu
+MACHINETYPE	:= x86_64
+PLATFORM	:= x86_64-pc-linux-gnu
+FULLOSTYPE	:= pc-linux-gnu
@@ -63,11 +63,17 @@ void delete_alloc_context(cst_alloc_context ctx);
 void *cst_local_alloc(cst_alloc_context ctx, int size);
 void cst_local_free(cst_alloc_context ctx, void *p);
 #else /* not UNDER_CE */
-typedef void * cst_alloc_context;
-#define new_alloc_context(size)   (NULL)
-#define delete_alloc_context(ctx)
-#define cst_local_alloc(ctx,size) cst_safe_alloc(size)
-#define cst_local_free(cst,p)     cst_free(p)
+/* Elsewhere a context hands out small blocks from a pool and keeps the */
+/* ones freed for reuse, everything goes when the context is deleted.   */
+/* A NULL context is just cst_alloc/cst_free.  Contexts aren't thread   */
+/* safe, each belongs to one utterance                                  */
+typedef struct cst_alloc_context_struct *cst_alloc_context;
+
+cst_alloc_context new_alloc_context(int size);
+void delete_alloc_context(cst_alloc_context ctx);
+
+void *cst_local_alloc(cst_alloc_context ctx, int size);
+void cst_local_free(cst_alloc_context ctx, void *p);
 #endif /* UNDER_CE */
 
 /* The public interface to the alloc functions */
@@ -79,4 +85,36 @@ typedef void * cst_alloc_context;
 
 void cst_free(void *p);
 
+/* Pools, for many small allocations that are all freed together.      */
+/* cst_pool_reset() frees everything at once but keeps the underlying */
+/* blocks so a pool can be reused without going back to malloc        */
+typedef struct cst_pool_struct cst_pool;
+cst_pool *new_pool(int block_size);
+void delete_pool(cst_pool *p);
+void *cst_pool_alloc(cst_pool *p, int size);
+void cst_pool_reset(cst_pool *p);
+#define cst_pool_new(P,TYPE,SIZE) ((TYPE *)cst_pool_alloc((P),sizeof(TYPE)*(SIZE)))
+
+/* Allocation statistics.  These need the size kept with each block so */
+/* they must be switched on before anything is allocated, by calling   */
+/* cst_alloc_stats_enable() or setting the environment variable         */
+/* CST_ALLOC_STATS, and can't be switched off again.  Size classes are  */
+/* powers of two: up to 16 bytes, up to 32, ... the last is the rest    */
+#define CST_ALLOC_SIZE_CLASSES 16
+
+typedef struct cst_alloc_counts_struct {
+    long calls;                /* allocations, a realloc counts as one */
+    long frees;
+    double bytes;              /* total asked for */
+    double in_use;
+    double high_water;         /* most in use at once */
+    long size_classes[CST_ALLOC_SIZE_CLASSES];
+} cst_alloc_counts;
+
+int cst_alloc_stats_enable(void);    /* FALSE if it is too late */
+/* Process wide, and for the calling thread only (in_use and high_water */
+/* are for what this thread allocated less what it freed)               */
+void cst_alloc_stats(cst_alloc_counts *c);
+void cst_alloc_thread_stats(cst_alloc_counts *c);
+
 #endif
@@ -68,6 +68,10 @@ typedef struct cst_audiodev_struct {
     int byteswap;
     cst_rateconv *rateconv;
     void *platform_data;
+    /* Kept for audio_write()'s conversions, rather than allocating */
+    /* them on every call                                            */
+    void *conv[2];
+    int conv_size[2];
 } cst_audiodev;
 
 /* Generic audio functions */
@@ -99,6 +103,21 @@ int audio_flush_file(cst_audiodev *ad);
 /* For audio streaming */
 #define CST_AUDIO_STREAM_STOP -1
 #define CST_AUDIO_STREAM_CONT 0
+
+/* What is being said, as it is streamed: phones (Segment items), words */
+/* and SSML marks (the "ssml_mark" feature on a Token), with where they  */
+/* start and end in the utterance's wave (a mark's end is its start)     */
+#define CST_AUDIO_EVENT_PHONE 1
+#define CST_AUDIO_EVENT_WORD  2
+#define CST_AUDIO_EVENT_MARK  3
+typedef struct cst_audio_event_struct
+{
+    int type;
+    const char *name;
+    int start, end;           /* in samples */
+    const cst_item *item;     /* the Segment, Word or Token */
+} cst_audio_event;
+
 typedef struct cst_audio_streaming_info_struct
 {
     int min_buffsize;
@@ -109,6 +128,13 @@ typedef struct cst_audio_streaming_info_struct
     const cst_item *item;     /* because you'll probably want this */
                               /* But this is *not* updated automatically */
     void *userdata;
+
+    /* If set, called with each event that starts in a chunk, in order, */
+    /* before asc is given the chunk.  Marks come before the word they   */
+    /* are at, and words before their first phone                        */
+    int (*event)(const cst_audio_event *e,
+                 struct cst_audio_streaming_info_struct *asi);
+    const cst_item *event_seg;  /* the next Segment to give events for */
 } cst_audio_streaming_info;
 cst_audio_streaming_info *new_audio_streaming_info();
 void delete_audio_streaming_info(cst_audio_streaming_info *asi);
@@ -116,8 +142,37 @@ CST_VAL_USER_TYPE_DCLS(audio_streaming_info,cst_audio_streaming_info)
 typedef int (*cst_audio_stream_callback)(const cst_wave *w,int start,int size, 
                                       int last, cst_audio_streaming_info *asi);
 
+/* How synthesis gives asi each chunk: the events up to its end and */
+/* then the chunk itself.  A chunk starting at 0 begins a new wave    */
+int audio_stream_send(cst_audio_streaming_info *asi, const cst_wave *w,
+                      int start, int size, int last);
+/* Where a Segment ends in the wave, from its "end_sample" feature if */
+/* the synthesizer set one, otherwise from its end time               */
+int audio_segment_end_sample(const cst_item *seg, int sample_rate);
+
 /* An example audio streaming callback function src/audio/au_streaming.c */
 int audio_stream_chunk(const cst_wave *w, int start, int size, 
                        int last, cst_audio_streaming_info *asi);
 
+/* Asynchronous playback (src/audio/au_player.c).  Waves are copied    */
+/* into a ring buffer of size samples (0 for a default) and played by   */
+/* a thread of the player's own, so writes only wait when the ring is   */
+/* full.  Without threads they are played as they are written.  Writes */
+/* return CST_AUDIO_STREAM_STOP once the player has been stopped.  If  */
+/* the device won't open, that is reported once (for each format) and  */
+/* the samples are dropped                                              */
+typedef struct cst_audio_player_struct cst_audio_player;
+cst_audio_player *new_audio_player(int size);
+void delete_audio_player(cst_audio_player *p); /* after playing the rest */
+int audio_player_write(cst_audio_player *p, const cst_wave *w,
+                       int start, int size);
+int audio_player_play(cst_audio_player *p, const cst_wave *w);
+int audio_player_flush(cst_audio_player *p); /* wait until all is played */
+void audio_player_stop(cst_audio_player *p); /* drop it all, from any thread */
+void audio_player_restart(cst_audio_player *p);
+int audio_player_stopped(cst_audio_player *p);
+/* A streaming callback, with asi->userdata the player */
+int audio_player_stream_chunk(const cst_wave *w, int start, int size,
+                              int last, cst_audio_streaming_info *asi);
+
 #endif
@@ -74,4 +74,25 @@ CST_VAL_USER_TYPE_DCLS(cart,cst_cart)
 
 const cst_val *cart_interpret(cst_item *item, const cst_cart *tree);
 
+/* A cart compiled to C (by tools/compile_prosody), it gives the same */
+/* answers as cart_interpret() on tree but goes straight to features  */
+/* rather than parsing their paths at each node.  ffunc_names are the */
+/* last parts of the feature paths, to be bound with ff_bind()         */
+#define CST_CART_COMPILED_MAX_FEATS 64
+
+typedef const cst_val *(*cst_cart_compiled_func)(const cst_item *item,
+                                                 const cst_ffunction *ff);
+typedef struct cst_cart_compiled_struct {
+    const cst_cart *tree;
+    int num_feats;
+    const char * const *ffunc_names;
+    cst_cart_compiled_func interpret;
+} cst_cart_compiled;
+
+CST_VAL_USER_TYPE_DCLS(cart_compiled,cst_cart_compiled)
+
+const cst_val *cart_interpret_compiled(cst_item *item,
+                                       const cst_cart_compiled *c,
+                                       const cst_ffunction *ff);
+
 #endif
@@ -157,15 +157,43 @@ CST_VAL_USER_TYPE_DCLS(cg_db,cst_cg_db)
 void delete_cg_db(cst_cg_db *db);
 
 cst_utterance *cg_synth(cst_utterance *utt);
+
+/* Speed against quality, the synthesis_tier feature ("fast", "balanced" */
+/* or "quality", the default) sets all of these at once, and the          */
+/* mlsa_speed_param feature can still be set on its own.  resynth_type   */
+/* "fixed" asks for the integer vocoder with any tier                     */
+typedef struct cst_cg_tier_struct {
+    int num_models;        /* F0 and param models to average, 0 for all */
+    int do_mlpg;           /* 0 takes the static means, without MLPG */
+    int mlsa_speed_param;  /* higher mceps to ignore */
+    int pade_order;        /* for the MLSA filter, 4 or 5 */
+    int postfilter_ir;     /* impulse response length for postfilter gain */
+    int fixed_point;       /* 1 for integer (Q format) filtering */
+} cst_cg_tier;
+void cg_get_tier(const cst_features *f, cst_cg_tier *tier);
+
 cst_wave *mlsa_resynthesis(const cst_track *t, 
                            const cst_track *str, 
                            cst_cg_db *cg_db,
                            cst_audio_streaming_info *asc,
                            int mlsa_speech_param);
+/* The same a piece at a time, keeping the vocoder's state (filter     */
+/* history, pitch and excitation) between pieces.  The wave is sized   */
+/* for all of t, frames [start,end) of t (and str) are added to it in   */
+/* order, and mlsa_finish() returns it, or NULL if the callback stopped */
+typedef struct cst_mlsa_struct cst_mlsa;
+cst_mlsa *new_mlsa(const cst_track *t, cst_cg_db *cg_db,
+                   const cst_cg_tier *tier);
+int mlsa_synth_frames(cst_mlsa *m, const cst_track *t, const cst_track *str,
+                      int start, int end, cst_audio_streaming_info *asc);
+cst_wave *mlsa_finish(cst_mlsa *m, cst_audio_streaming_info *asc);
 cst_track *mlpg(const cst_track *param_track, cst_cg_db *cg_db);
 
 cst_voice *cst_cg_load_voice(const char *voxdir,
                              const cst_lang lang_table[]);
+cst_lexicon *cg_init_lang_lex(cst_voice *vox,
+                              const cst_lang *lang_table,
+                              const char *language);
 int cst_cg_dump_voice(const cst_voice *v,const cst_string *filename);
 
 #endif
@@ -45,6 +45,8 @@
 #include "cst_viterbi.h"
 #include "cst_track.h"
 #include "cst_sts.h"
+#include "cst_thread.h"
+#include "cst_voice.h"
 
 #define CLUNIT_NONE (unsigned short)65535
 
@@ -59,6 +61,20 @@ typedef struct cst_clunit_type_struct {
     int start, count;
 } cst_clunit_type;
 
+/* A precomputed join between two units, as found by optimal coupling */
+typedef struct cst_clunit_join_struct {
+    int u0, u1;
+    int cost;
+    int u0_move, u1_move;  /* new end of u0 and start of u1, -1 if none */
+} cst_clunit_join;
+
+typedef struct cst_clunit_join_table_struct {
+    int num_joins;
+    const cst_clunit_join *joins;  /* sorted on u0 then u1 */
+} cst_clunit_join_table;
+
+typedef struct cst_clunit_join_cache_struct cst_clunit_join_cache;
+
 typedef struct cst_clunit_db_struct {
     const char *name;
     const cst_clunit_type *types;
@@ -77,6 +93,14 @@ typedef struct cst_clunit_db_struct {
     int extend_selections;
     int f0_weight;
     char *(*unit_name_func)(cst_item *s);
+
+    /* Optional offline join costs for common unit pairs, may be NULL */
+    const cst_clunit_join_table *join_table;
+
+    /* These are set up at runtime by clunit_db_prepare() */
+    const unsigned short *join_weights16; /* NULL if weights are > 16 bit */
+    cst_clunit_join_cache *join_cache;    /* NULL unless asked for */
+    cst_thread_pool *workers;             /* NULL unless asked for */
 } cst_clunit_db;
 
 CST_VAL_USER_TYPE_DCLS(clunit_db,cst_clunit_db)
@@ -94,6 +118,31 @@ int clunit_get_unit_index_name(cst_clunit_db *cludb,
 /* Used to test if the unit name is in the database, -1 if not */
 int clunit_get_unit_type_index(cst_clunit_db *cludb, const char *name);
 
+/* Runtime set up of a db, cache_size > 0 asks for a join cost cache */
+/* and num_threads > 1 for join costs to be found in parallel         */
+void clunit_db_prepare(cst_clunit_db *cludb, int cache_size,
+                       int num_threads);
+
+/* Join cost cache and precomputed join tables (cst_clunits_join.c) */
+cst_clunit_join_cache *new_clunit_join_cache(int size);
+void delete_clunit_join_cache(cst_clunit_join_cache *jc);
+int clunit_join_cache_lookup(cst_clunit_join_cache *jc, int u0, int u1,
+                             cst_clunit_join *j);
+void clunit_join_cache_add(cst_clunit_join_cache *jc,
+                           const cst_clunit_join *j);
+void clunit_join_cache_stats(cst_clunit_join_cache *jc,
+                             int *hits, int *misses, int *entries);
+const cst_clunit_join *clunit_join_table_lookup(const cst_clunit_join_table *t,
+                                                int u0, int u1);
+int clunit_join_table_save(cst_clunit_db *cludb, int k, const char *filename);
+
+/* Whole voices in a single mmap'd file (cst_clunits_vox.c), loaded   */
+/* voices use their language's lexicon from lang_table, not their own */
+int cst_clunits_dump_voice(const cst_voice *v, const char *filename);
+cst_voice *cst_clunits_load_voice(const char *filename,
+                                  const cst_lang lang_table[]);
+void cst_clunits_free_voxfile(void *vf);
+
 #define UNIT_TYPE(db,u) ((db)->types[(db)->units[(u)].type].name)
 #define UNIT_INDEX(db,u) ((u) - (db)->types[(db)->units[(u)].type].start)
 
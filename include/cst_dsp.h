@@ -0,0 +1,76 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Signal processing kernels, chosen at run time for the CPU            */
+/*                                                                       */
+/*************************************************************************/
+#ifndef _CST_DSP_H__
+#define _CST_DSP_H__
+
+/* The inner loops of the vocoders, LPC resynthesis, rate conversion */
+/* and clunits join costs.  Each has a plain C reference and, where   */
+/* the compiler can build them, versions for wider vector units; the  */
+/* best the machine has is picked by cst_dsp_init() (flite_init()     */
+/* calls it).  Setting the environment variable CST_DSP to a variant  */
+/* name (e.g. "c") forces that one, if this machine can run it        */
+typedef struct cst_dsp_kernels_struct {
+    const char *name;
+
+    /* sum of a[i]*b[i], the float ones may add in any order */
+    double (*dot)(const double *a, const double *b, int n);
+    float (*dot_float)(const float *a, const float *b, int n);
+    /* wraps as int arithmetic does, so always the same answer */
+    int (*dot_int)(const int *a, const int *b, int n);
+
+    /* sum of (|a[i]-b[i]|*w[i])>>16 (a and b scaled up by 256 for the */
+    /* 8 bit version), returning as soon as it is over bestsofar, so   */
+    /* the answer is only exact when it isn't more than bestsofar      */
+    int (*wabsdiff16)(const unsigned short *a, const unsigned short *b,
+                      const unsigned short *w, int n, int bestsofar);
+    int (*wabsdiff8)(const unsigned char *a, const unsigned char *b,
+                     const unsigned short *w, int n, int bestsofar);
+} cst_dsp_kernels;
+
+/* The kernels in use, the C reference until cst_dsp_init() is called */
+extern const cst_dsp_kernels *cst_dsp;
+
+void cst_dsp_init(void);
+/* The variants this machine can run, 0 is the C reference, NULL past */
+/* the end, and the one with the given name (NULL if it can't be run)  */
+const cst_dsp_kernels *cst_dsp_variant(int i);
+const cst_dsp_kernels *cst_dsp_find(const char *name);
+
+#endif
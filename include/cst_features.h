@@ -63,6 +63,8 @@ typedef struct cst_features_struct {
 cst_features *new_features(void);
 cst_features *new_features_local(cst_alloc_context ctx);
 void delete_features(cst_features *f);
+/* Remove all features (and links), f is then like a new one */
+void feat_clear(cst_features *f);
 
 /* Accessor functions */
 int feat_int(const cst_features *f, const char *name);
@@ -129,6 +129,14 @@ CST_VAL_USER_FUNCPTR_DCLS(ffunc,cst_ffunction)
 void ff_register(cst_features *ffeatures, const char *name,
 			   cst_ffunction f);
 void ff_unregister(cst_features *ffeatures, const char *name);
+/* For code that has parsed its feature paths already (e.g. compiled  */
+/* carts): ff_bind() finds the ffunctions for the last parts of some   */
+/* paths, NULL for plain item features, and ffeature_at() is the last  */
+/* step of ffeature() once it has found the item                      */
+void ff_bind(const cst_features *ffunctions, const char * const *names,
+             int num_names, cst_ffunction *ff);
+const cst_val *ffeature_at(const cst_item *item, const char *name,
+                           cst_ffunction ff);
 
 /* Generalized item hook function, like cst_uttfunc. */
 typedef cst_val *(*cst_itemfunc)(cst_item *i);
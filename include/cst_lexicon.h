@@ -69,6 +69,9 @@ typedef struct lexicon_struct {
 
     cst_val *lex_addenda;  /* For pronunciations added at run time */
 
+    /* Lexical insertion results for recent words, set up at run time */
+    struct cst_lex_cache_struct *cache;
+
 } cst_lexicon;
 
 cst_lexicon *new_lexicon();
@@ -84,6 +87,30 @@ cst_val *lex_lookup(const cst_lexicon *l, const char *word, const char *pos,
 int in_lex(const cst_lexicon *l, const char *word, const char *pos,
            const cst_features *feats);
 
+/* A word's pronunciation as lexical insertion builds it: phone names */
+/* (atoms, without stress) and for the last phone of each syllable    */
+/* the syllable's stress                                              */
+#define CST_LEX_PRON_MAX 32
+#define CST_LEX_SYL_NONE 0
+#define CST_LEX_SYL_UNSTRESSED 1
+#define CST_LEX_SYL_STRESSED 2
+typedef struct cst_lex_pron_struct {
+    int num_phones;
+    const cst_val *phones[CST_LEX_PRON_MAX];
+    unsigned char syl_end[CST_LEX_PRON_MAX];
+} cst_lex_pron;
+
+/* Fixed size, thread safe, cache of prons by word and pos, shared by */
+/* everything using the lexicon.  lex_cache() sets it up first time  */
+/* (size 0 for none) and returns NULL if the lexicon can't have one, */
+/* as its lts_function may depend on more than the word              */
+typedef struct cst_lex_cache_struct cst_lex_cache;
+cst_lex_cache *lex_cache(cst_lexicon *l, int size);
+int lex_cache_lookup(cst_lex_cache *c, const char *word, const char *pos,
+                     cst_lex_pron *p);
+void lex_cache_add(cst_lex_cache *c, const char *word, const char *pos,
+                   const cst_lex_pron *p);
+
 CST_VAL_USER_TYPE_DCLS(lexicon,cst_lexicon)
 
 #endif
@@ -72,6 +72,40 @@ int phone_feat_id(const cst_phoneset *ps,const char* featname);
 
 const cst_phoneset *item_phoneset(const cst_item *i);
 
+/* Lookup tables for a phoneset: hashes from phone and feature names */
+/* to their ids and a dense [phone][feature] table of the values, so */
+/* finding a phone feature needs no scans through the names          */
+typedef struct cst_phoneset_accel_struct {
+    const cst_phoneset *ps;
+    int num_feats;
+    int phone_hash_size, feat_hash_size;  /* powers of 2 */
+    short *phone_hash;                    /* id+1, 0 for empty */
+    short *feat_hash;
+    const cst_val **table;                /* num_phones * num_feats */
+} cst_phoneset_accel;
+
+cst_phoneset_accel *new_phoneset_accel(const cst_phoneset *ps);
+void delete_phoneset_accel(cst_phoneset_accel *pa);
+
+/* As phone_id(), phone_feat_id() and phone_feature() */
+int phoneset_accel_phone_id(const cst_phoneset_accel *pa,
+                            const char *phonename);
+int phoneset_accel_feat_id(const cst_phoneset_accel *pa,
+                           const char *featname);
+const cst_val *phoneset_accel_feature(const cst_phoneset_accel *pa,
+                                      const char *phonename,
+                                      const char *featname);
+
+/* Sets the phoneset in f (a voice's features) along with its tables */
+void phoneset_set(cst_features *f, const cst_phoneset *ps);
+/* The tables for the phoneset of i's utterance, found once per */
+/* utterance and built for it if the phoneset wasn't given by    */
+/* phoneset_set()                                                */
+const cst_phoneset_accel *item_phoneset_accel(const cst_item *i);
+/* featname of the phone named by i */
+const cst_val *item_phone_feature(const cst_item *i, const char *featname);
+
 CST_VAL_USER_TYPE_DCLS(phoneset,cst_phoneset)
+CST_VAL_USER_TYPE_DCLS(phoneset_accel,cst_phoneset_accel)
 
 #endif
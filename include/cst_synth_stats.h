@@ -0,0 +1,118 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Optional timing and counts of what synthesis spends its time on      */
+/*                                                                       */
+/*************************************************************************/
+#ifndef _CST_SYNTH_STATS_H__
+#define _CST_SYNTH_STATS_H__
+
+#include "cst_file.h"
+#include "cst_utterance.h"
+
+/* When switched on (it is off by default) apply_synth_method() times */
+/* each module it calls and modules bump the counters below.  Each     */
+/* utterance gets its own stats (the "synth_stats" feature) and these  */
+/* are also added to process wide totals.  When off the only cost is   */
+/* a test of cst_synth_stats_on                                        */
+
+typedef enum {
+    CST_STAT_CART_EVALS,       /* cart_interpret() calls */
+    CST_STAT_LEX_LOOKUPS,
+    CST_STAT_LEX_HITS,         /* found in the addenda or lexicon */
+    CST_STAT_LEX_LTS,          /* needed letter to sound rules */
+    CST_STAT_LEX_CACHE_HITS,   /* words that didn't need a lookup at all */
+    CST_STAT_SAMPLES,          /* in the synthesized waveforms */
+    CST_STAT_ALLOCS,           /* only if cst_alloc stats are on */
+    CST_STAT_ALLOC_BYTES,
+    CST_STAT_NUM_COUNTERS
+} cst_synth_counter;
+
+#define CST_SYNTH_STATS_MAX_MODULES 16
+#define CST_SYNTH_STATS_MAX_RELATIONS 16
+
+typedef struct cst_synth_module_stats_struct {
+    const char *name;          /* the module's hookname */
+    int calls;
+    double wall;               /* seconds */
+    double cpu;
+    double allocs;             /* only if cst_alloc stats are on */
+    double alloc_bytes;
+} cst_synth_module_stats;
+
+typedef struct cst_synth_relation_stats_struct {
+    char name[32];
+    int items;
+} cst_synth_relation_stats;
+
+typedef struct cst_synth_stats_struct {
+    int num_utts;
+    int num_modules;
+    cst_synth_module_stats modules[CST_SYNTH_STATS_MAX_MODULES];
+    int num_relations;
+    cst_synth_relation_stats relations[CST_SYNTH_STATS_MAX_RELATIONS];
+    double counts[CST_STAT_NUM_COUNTERS];
+} cst_synth_stats;
+
+cst_synth_stats *new_synth_stats(void);
+void delete_synth_stats(cst_synth_stats *s);
+CST_VAL_USER_TYPE_DCLS(synth_stats,cst_synth_stats)
+
+extern int cst_synth_stats_on;
+void cst_synth_stats_enable(int on);
+
+/* Add n to a counter of the utterance being synthesized in this thread */
+#define cst_synth_stats_add(C,N) \
+    do { if (cst_synth_stats_on) cst_synth_stats_count((C),(N)); } while (0)
+void cst_synth_stats_count(cst_synth_counter c, int n);
+
+/* The stats of one utterance, NULL if none were collected */
+const cst_synth_stats *utt_synth_stats(const cst_utterance *u);
+/* Process wide totals (copied into s) and resetting them */
+void cst_synth_stats_totals(cst_synth_stats *s);
+void cst_synth_stats_reset(void);
+void cst_synth_stats_print(cst_file fd, const cst_synth_stats *s);
+
+/* Used by apply_synth_method() */
+cst_synth_stats *synth_stats_start(cst_synth_stats *run);
+void synth_stats_module(cst_synth_stats *s, const char *name,
+                        double wall, double cpu,
+                        const cst_alloc_counts *a0,
+                        const cst_alloc_counts *a1);
+void synth_stats_end(cst_utterance *u, cst_synth_stats *run,
+                     cst_synth_stats *outer);
+
+#endif
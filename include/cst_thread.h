@@ -0,0 +1,103 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Minimal thread support                                               */
+/*                                                                       */
+/*************************************************************************/
+#ifndef _CST_THREAD_H__
+#define _CST_THREAD_H__
+
+/* The implementation is chosen at configure time (THREADTYPE), the  */
+/* "none" version gives no-op locks so single threaded platforms     */
+/* still link                                                        */
+
+typedef struct cst_mutex_struct cst_mutex;
+
+cst_mutex *new_mutex(void);
+void delete_mutex(cst_mutex *m);
+void cst_mutex_lock(cst_mutex *m);
+void cst_mutex_unlock(cst_mutex *m);
+
+/* Condition variables, always used with a locked mutex */
+typedef struct cst_cond_struct cst_cond;
+
+cst_cond *new_cond(void);
+void delete_cond(cst_cond *c);
+void cst_cond_wait(cst_cond *c, cst_mutex *m);
+void cst_cond_signal(cst_cond *c);
+void cst_cond_broadcast(cst_cond *c);
+
+/* Threads, cst_thread_create returns NULL if they aren't supported */
+/* (or can't be created) so callers must be ready to do the work    */
+/* themselves                                                       */
+typedef struct cst_thread_struct cst_thread;
+typedef void *(cst_thread_f)(void *arg);
+
+cst_thread *cst_thread_create(cst_thread_f *func, void *arg);
+void *cst_thread_join(cst_thread *t);
+
+/* Per thread data, each thread sees its own value (initially NULL) */
+typedef struct cst_thread_key_struct cst_thread_key;
+
+cst_thread_key *new_thread_key(void);
+void delete_thread_key(cst_thread_key *k);
+void *cst_thread_key_get(cst_thread_key *k);
+void cst_thread_key_set(cst_thread_key *k, void *v);
+
+/* Clocks for timing, in seconds from some arbitrary start: elapsed  */
+/* time and cpu time used by the calling thread                      */
+double cst_clock_wall(void);
+double cst_clock_thread_cpu(void);
+
+/* A single process wide lock, for lazily setting up shared state */
+/* hung off voices and databases                                   */
+void cst_global_lock(void);
+void cst_global_unlock(void);
+
+/* A fixed set of worker threads for splitting up a loop: run calls */
+/* func(arg,i) for each i in 0 .. num_tasks-1, in any order and on  */
+/* any thread (including the caller's), and returns when all are    */
+/* done.  Only one run happens on a pool at a time                  */
+typedef void (cst_thread_task_f)(void *arg, int task);
+typedef struct cst_thread_pool_struct cst_thread_pool;
+
+cst_thread_pool *new_thread_pool(int num_threads);
+void delete_thread_pool(cst_thread_pool *p);
+int thread_pool_size(const cst_thread_pool *p);
+void thread_pool_run(cst_thread_pool *p, cst_thread_task_f *func,
+                     void *arg, int num_tasks);
+
+#endif
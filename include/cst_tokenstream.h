@@ -51,6 +51,11 @@ typedef struct  cst_tokenstream_struct {
     int line_number;
     int eof_flag;
     cst_string *string_buffer;
+    /* Memory streams (ts_open_string() and ts_open_mapped()) are */
+    /* tokenized straight from string_buffer, which for a mapped  */
+    /* file isn't nul terminated and belongs to string_buffer_map */
+    int string_buffer_size;
+    cst_filemap *string_buffer_map;
 
     int current_char;
 
@@ -128,6 +133,13 @@ cst_tokenstream *ts_open_generic(const char *filename,
                                  int (*tell)(cst_tokenstream *ts),
                                  int (*size)(cst_tokenstream *ts),
                                  int (*getc)(cst_tokenstream *ts));
+/* Like ts_open() but tokenizes the file from memory, it falls back */
+/* to ts_open() for stdin and files that can't be mapped            */
+cst_tokenstream *ts_open_mapped(const char *filename,
+                                const cst_string *whitespacesymbols,
+                                const cst_string *singlecharsymbols,
+                                const cst_string *prepunctsymbols,
+                                const cst_string *postpunctsymbols);
 void ts_close(cst_tokenstream *ts);
 
 #if defined(_WIN32) && !defined(__GNUC__)
@@ -157,6 +169,10 @@ void set_charclasses(cst_tokenstream *ts,
 		     const cst_string *prepunctuation,
 		     const cst_string *postpunctuation);
 
+/* Whitespace and punctuation only hold the stream's class symbols so */
+/* there are few different ones, short ones are shared atoms         */
+const cst_val *ts_part_val(const cst_string *part);
+
 int ts_read(void *buff, int size, int num, cst_tokenstream *ts);
 
 int ts_set_stream_pos(cst_tokenstream *ts,int pos);
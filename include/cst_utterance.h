@@ -52,11 +52,17 @@ struct cst_utterance_struct {
     cst_features *ffunctions;
     cst_features *relations;
     cst_alloc_context ctx;
+
+    /* Found on first use, see item_phoneset_accel() */
+    const struct cst_phoneset_accel_struct *phoneset_accel;
 };
 
 /* Constructor functions */
 cst_utterance *new_utterance();
 void delete_utterance(cst_utterance *u);
+/* Empty u so it can be used again, cheaper than deleting it and */
+/* making a new one for a run of utterances                       */
+void utt_reset(cst_utterance *u);
 
 cst_relation *utt_relation(const cst_utterance *u,const char *name);
 cst_relation *utt_relation_create(cst_utterance *u,const char *name);
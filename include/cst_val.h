@@ -113,6 +113,14 @@ cst_val *string_val(const char *s);
 cst_val *val_new_typed(int type, void *vv);
 cst_val *cons_val(const cst_val *a, const cst_val *b);
 
+/* Atoms are shared string vals for small closed sets of strings, like */
+/* phone names, cart values and feature names.  The same string always */
+/* gives the same val, which is never copied or freed, so atoms can be  */
+/* compared by address.  Don't use them for open sets like words        */
+const cst_val *atom_val(const char *s);
+const cst_val *atom_val_n(const char *s, int n); /* first n chars of s */
+int val_atomp(const cst_val *v);
+
 /* Derefence and delete val if no other references */
 void delete_val(cst_val *val);
 void delete_val_list(cst_val *val);
@@ -142,6 +150,8 @@ int cst_val_consp(const cst_val *v);
 #define CST_VAL_CDR(X) ((X)->c.cc.cdr)
 
 #define CST_VAL_REFCOUNT(X) ((X)->c.a.ref_count)
+/* Vals with a ref count of -1 (consts) or this (atoms) are never freed */
+#define CST_VAL_REFCOUNT_ATOM -2
 
 /* Some standard function */
 int val_equal(const cst_val *a, const cst_val *b);
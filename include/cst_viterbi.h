@@ -43,6 +43,7 @@
 #include "cst_file.h"
 #include "cst_math.h"
 #include "cst_utterance.h"
+#include "cst_thread.h"
 
 typedef struct cst_vit_cand_struct {
     int score;
@@ -79,6 +80,23 @@ typedef struct cst_vit_point_struct {
 cst_vit_point *new_vit_point();
 void delete_vit_point(cst_vit_point *vp);
 
+/* The array based decoder keeps a column of states (candidates and */
+/* their best back pointer) for each point, all from one pool, and   */
+/* the join points of the best path to each state as plain ints      */
+typedef struct cst_vit_state_struct {
+    int ival;              /* the candidate, e.g. a unit index */
+    int score;             /* the candidate's own (target) score */
+    int path_score;        /* best score of a path ending here */
+    int from;              /* state in previous column, -1 for none */
+    int prev_move, this_move; /* join points from join func, -1 for none */
+} cst_vit_state;
+
+typedef struct cst_vit_column_struct {
+    cst_item *item;
+    int num_states;
+    cst_vit_state *states;
+} cst_vit_column;
+
 struct cst_viterbi_struct;
 
 /* Functions for user call back, to find candiates at a point, and
@@ -88,6 +106,16 @@ typedef cst_vit_cand *(cst_vit_cand_f_t)(cst_item *s,
 typedef cst_vit_path *(cst_vit_path_f_t)(cst_vit_path *p,
 					  cst_vit_cand *c,
 					  struct cst_viterbi_struct *vd);
+/* and for the array based decoder: candidates are added to col with */
+/* viterbi_add_state(), joins return the cost of going from p to c   */
+typedef void (cst_vit_states_f_t)(cst_item *s,
+                                  const cst_vit_column *prev,
+                                  cst_vit_column *col,
+                                  struct cst_viterbi_struct *vd);
+typedef int (cst_vit_join_f_t)(const cst_vit_state *p,
+                               const cst_vit_state *c,
+                               int *prev_move, int *this_move,
+                               struct cst_viterbi_struct *vd);
 
 typedef struct cst_viterbi_struct {
     int num_states;
@@ -98,11 +126,30 @@ typedef struct cst_viterbi_struct {
     cst_vit_point *timeline;
     cst_vit_point *last_point;
     cst_features *f;
+
+    /* Only keep the best beam_width paths/states at each point, 0 is */
+    /* all; needed for the general (num_states == 0) search           */
+    int beam_width;
+
+    /* Array based decoder, used when join_func is set */
+    cst_vit_states_f_t *states_func;
+    cst_vit_join_f_t *join_func;
+    int num_columns;
+    cst_vit_column *columns;
+    cst_pool *pool;
+    cst_vit_state *scratch;
+    int scratch_size;
+
+    /* If set, the joins into a column are shared out over these, the */
+    /* join_func must then be safe to call from several threads       */
+    cst_thread_pool *workers;
 } cst_viterbi;
 
 
 cst_viterbi *new_viterbi(cst_vit_cand_f_t *cand_func, 
 			 cst_vit_path_f_t *path_func);
+cst_viterbi *new_viterbi_array(cst_vit_states_f_t *states_func,
+                               cst_vit_join_f_t *join_func);
 void delete_viterbi(cst_viterbi *vd);
 
 void viterbi_initialise(cst_viterbi *vd,cst_relation *r);
@@ -110,4 +157,9 @@ void viterbi_decode(cst_viterbi *vd);
 int viterbi_result(cst_viterbi *vd, const char *n);
 void viterbi_copy_feature(cst_viterbi *vd,const char *featname);
 
+cst_vit_state *viterbi_add_state(cst_viterbi *vd, cst_vit_column *col,
+                                 int ival, int score);
+void viterbi_copy_moves(cst_viterbi *vd,
+                        const char *prev_name, const char *this_name);
+
 #endif
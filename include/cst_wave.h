@@ -86,6 +86,23 @@ int cst_wave_append_riff(cst_wave *w,const char *filename);
 int cst_wave_save_riff_fd(cst_wave *w, cst_file fd);
 int cst_wave_save_raw_fd(cst_wave *w, cst_file fd);
 
+/* Sinks, for writing a run of waves (e.g. one per utterance) to one  */
+/* output without reopening it for each.  type is "riff", "raw",      */
+/* "snd" or "stream" (frames of "WAVF", sample rate, channels and     */
+/* number of samples, then the samples, and an empty frame at the     */
+/* end).  riff and stream are little endian, snd big endian and raw  */
+/* as the machine is.  Headers are fixed up at close, or every so     */
+/* many seconds of output if asked.  A sink on an fd starts where the */
+/* fd is, so its header is fixed up there                             */
+typedef struct cst_wave_sink_struct cst_wave_sink;
+
+cst_wave_sink *cst_wave_sink_open(const char *filename, const char *type);
+cst_wave_sink *cst_wave_sink_open_fd(cst_file fd, const char *type);
+void cst_wave_sink_set_checkpoint(cst_wave_sink *s, float seconds);
+int cst_wave_sink_write(cst_wave_sink *s, const cst_wave *w);
+int cst_wave_sink_checkpoint(cst_wave_sink *s);
+int cst_wave_sink_close(cst_wave_sink *s);
+
 int cst_wave_load(cst_wave *w, const char *filename, const char *type);
 int cst_wave_load_riff(cst_wave *w, const char *filename);
 int cst_wave_load_raw(cst_wave *w, const char *filename,
@@ -99,6 +116,10 @@ int cst_wave_load_raw_fd (cst_wave *w, cst_file fd,
 void cst_wave_resize(cst_wave *w,int samples, int num_channels);
 void cst_wave_resample(cst_wave *w, int sample_rate);
 void cst_wave_rescale(cst_wave *w, int factor);
+/* The mean log spectral distance in dB between (the first channels */
+/* of) two waves, over the frames that aren't silent in both; -1 if   */
+/* the sample rates differ.  For checking one synthesis against another */
+float cst_wave_spectral_distance(const cst_wave *a, const cst_wave *b);
 
 /* Resampling code */
 typedef struct cst_rateconv_struct {
@@ -62,6 +62,7 @@ extern "C" {
 #include "cst_utt_utils.h"
 #include "cst_lexicon.h"
 #include "cst_synth.h"
+#include "cst_synth_stats.h"
 #include "cst_units.h"
 #include "cst_tokenstream.h"
 
@@ -82,6 +83,7 @@ int flite_init();
 cst_voice *flite_voice_select(const char *name);
 cst_voice *flite_voice_load(const char *voice_filename);
 int flite_voice_dump(cst_voice *voice, const char *voice_filename);
+int flite_voice_dump_joins(cst_voice *voice, const char *filename);
 float flite_file_to_speech(const char *filename, 
 			   cst_voice *voice,
 			   const char *outtype);
@@ -102,14 +104,73 @@ float flite_ssml_text_to_speech(const char *text,
                                 const char *outtype);
 int flite_voice_add_lex_addenda(cst_voice *v, const cst_string *lexfile);
 
+/* Incremental text input, text may be pushed a piece at a time and */
+/* utterances are synthesized (in the background) as soon as their */
+/* end is known.  close waits for everything to be synthesized      */
+typedef struct flite_stream_struct flite_stream;
+flite_stream *flite_stream_open(cst_voice *voice, const char *outtype);
+int flite_stream_push_text(flite_stream *ctx, const char *chunk);
+float flite_stream_close(flite_stream *ctx);
+
+/* Cache of synthesized prompts, used by flite_text_to_wave() and     */
+/* flite_text_to_speech() for voices with the feature "prompt_cache"  */
+/* (a prompt_cache_val()).  Entries are limited to max_bytes in all   */
+/* and to ttl seconds old (0 for no limit), if dir isn't NULL they're */
+/* also kept there as files.  max_bytes doesn't limit dir, and files  */
+/* older than ttl are only removed when next looked up, so dir must   */
+/* be cleaned up by whatever made it.  A cache may be shared between  */
+/* voices                                                             */
+typedef struct flite_prompt_cache_struct flite_prompt_cache;
+typedef struct flite_prompt_cache_counts_struct {
+    long hits;              /* including disk_hits */
+    long disk_hits;
+    long misses;
+    long evictions;
+    long expired;
+    int entries;
+    double bytes;
+} flite_prompt_cache_counts;
+CST_VAL_USER_TYPE_DCLS(prompt_cache,flite_prompt_cache)
+
+flite_prompt_cache *new_flite_prompt_cache(int max_bytes, int ttl,
+                                           const char *dir);
+void delete_flite_prompt_cache(flite_prompt_cache *c);
+void flite_prompt_cache_stats(flite_prompt_cache *c,
+                              flite_prompt_cache_counts *counts);
+/* flite_synth_text() through the voice's cache, if it has one */
+cst_utterance *flite_synth_text_cached(const char *text, cst_voice *voice);
+
 /* Lower lever user functions */
 cst_wave *flite_text_to_wave(const char *text,cst_voice *voice);
 cst_utterance *flite_synth_text(const char *text,cst_voice *voice);
 cst_utterance *flite_synth_phones(const char *phones,cst_voice *voice);
+/* Like flite_synth_text but reuses utt (after utt_reset), returns NULL */
+/* on failure, utt is always still the caller's to delete               */
+cst_utterance *flite_synth_into(cst_utterance *utt, const char *text,
+                                cst_voice *voice);
 
 float flite_ts_to_speech(cst_tokenstream *ts, 
                          cst_voice *voice,
                          const char *outtype);
+/* Output through a sink that stays open over all the utterances,  */
+/* rather than a file that is reopened for each (NULL for no output) */
+/* flite_open_sink() gives the sink that flite_ts_to_speech() etc    */
+/* use for a filename outtype (NULL for play, stream and none), its  */
+/* format is the voice's output_type (default riff) with a header    */
+/* checkpoint every output_checkpoint seconds (default never)        */
+cst_wave_sink *flite_open_sink(const char *outtype, cst_voice *voice);
+float flite_ts_to_sink(cst_tokenstream *ts,
+                       cst_voice *voice,
+                       cst_wave_sink *sink);
+float flite_ssml_ts_to_sink(cst_tokenstream *ts,
+                            cst_voice *voice,
+                            cst_wave_sink *sink);
+float flite_sink_output(cst_utterance *u, cst_wave_sink *sink);
+/* For "play" each utterance is queued on a player while the next is */
+/* synthesized, unless the voice's play_async is 0.  play_buffer_size */
+/* is the player's buffer in samples                                  */
+cst_audio_player *flite_open_player(const char *outtype, cst_voice *voice);
+float flite_player_output(cst_utterance *u, cst_audio_player *player);
 cst_utterance *flite_do_synth(cst_utterance *u,
                               cst_voice *voice,
                               cst_uttfunc synth);
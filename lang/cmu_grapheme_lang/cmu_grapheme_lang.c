@@ -136,7 +136,7 @@ void cmu_grapheme_lang_init(cst_voice *v)
     feat_set(v->features,"utt_break",breakfunc_val(&grapheme_utt_break));
 
     /* Phoneset -- need to get this from voice */
-    feat_set(v->features,"phoneset",phoneset_val(&cmu_grapheme_phoneset));
+    phoneset_set(v->features,&cmu_grapheme_phoneset);
     feat_set_string(v->features,"silence",cmu_grapheme_phoneset.silence);
 
     /* Get information from voice and add to lexicon */
@@ -705,7 +705,7 @@ void cmu_indic_lang_init(cst_voice *v)
     feat_set(v->features,"utt_break",breakfunc_val(&indic_utt_break));
 
     /* Phoneset -- need to get this from voice */
-    feat_set(v->features,"phoneset",phoneset_val(&cmu_indic_phoneset));
+    phoneset_set(v->features,&cmu_indic_phoneset);
     feat_set_string(v->features,"silence",cmu_indic_phoneset.silence);
 
     /* Get information from voice and add to lexicon */
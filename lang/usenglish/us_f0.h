@@ -53,6 +53,19 @@ typedef struct us_f0_lr_term_struct us_f0_lr_term;
 
 extern const us_f0_lr_term f0_lr_terms[];
 
+/* The same model compiled by tools/compile_prosody: features finds */
+/* the values of all the model's features at once, in fv           */
+typedef struct us_f0_lr_compiled_struct {
+    const us_f0_lr_term *terms;
+    const int *term_feats;  /* each term's feature, -1 for the intercept */
+    int num_feats;
+    const char * const *ffunc_names;
+    void (*features)(const cst_item *s, const cst_ffunction *ff,
+                     const cst_val **fv);
+} us_f0_lr_compiled_model;
+
+extern const us_f0_lr_compiled_model us_f0_lr_compiled;
+
 cst_utterance *us_f0_model(cst_utterance *u);
 
 #endif
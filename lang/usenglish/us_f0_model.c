@@ -41,6 +41,7 @@
 
 #include "cst_hrg.h"
 #include "cst_phoneset.h"
+#include "cst_cart.h"
 #include "us_f0.h"
 
 static void apply_lr_model(cst_item *s,
@@ -79,6 +80,44 @@ static void apply_lr_model(cst_item *s,
     }
 }
 
+static void apply_lr_model_compiled(cst_item *s,
+                                    const us_f0_lr_compiled_model *model,
+                                    const cst_ffunction *ff,
+                                    float *start,
+                                    float *mid,
+                                    float *end)
+{
+    /* As apply_lr_model but with all the features found at once */
+    const us_f0_lr_term *f0_lr_terms = model->terms;
+    const cst_val *fvals[CST_CART_COMPILED_MAX_FEATS];
+    const cst_val *v;
+    int i;
+    float fv;
+
+    model->features(s,ff,fvals);
+    *start = f0_lr_terms[0].start;
+    *mid = f0_lr_terms[0].mid;
+    *end = f0_lr_terms[0].end;
+    for (i=1; f0_lr_terms[i].feature; i++)
+    {
+        v = fvals[model->term_feats[i]];
+	if (f0_lr_terms[i].type)
+	{
+	    if (cst_streq(val_string(v),f0_lr_terms[i].type))
+		fv = 1.0;
+	    else
+		fv = 0.0;
+	}
+	else
+	    fv = val_float(v);
+	(*start) += fv*f0_lr_terms[i].start;
+	(*mid) += fv*f0_lr_terms[i].mid;
+	(*end) += fv*f0_lr_terms[i].end;
+    }
+    for (i=0; i < model->num_feats; i++)
+        delete_val((cst_val *)fvals[i]);
+}
+
 static void add_target_point(cst_relation *targ,float pos, float f0)
 {
     cst_item *t;
@@ -127,13 +166,13 @@ static float vowel_mid(cst_item *syl)
     /* return time point mid way in vowel in this syl */
     cst_item *s;
     cst_item *ts;
-    const cst_phoneset *ps = item_phoneset(syl);
+    const cst_phoneset_accel *pa = item_phoneset_accel(syl);
 
     ts = item_daughter(item_as(syl,"SylStructure"));
     for (s=ts; s; s = item_next(s))
     {
-	if (cst_streq("+", phone_feature_string(ps,item_feat_string(s,"name"),
-						"vc")))
+	if (cst_streq("+", val_string(phoneset_accel_feature(pa,
+                                          item_feat_string(s,"name"),"vc"))))
 	{
 	    return (item_feat_float(s,"end")+
 		    ffeature_float(s,"R:Segment.p.end"))/2.0;
@@ -157,6 +196,8 @@ cst_utterance *us_f0_model(cst_utterance *u)
     float mean, stddev, local_mean, local_stddev;
     float start, mid, end, lend;
     float seg_end;
+    const us_f0_lr_compiled_model *model = NULL;
+    cst_ffunction ff[CST_CART_COMPILED_MAX_FEATS];
 
     if (feat_present(u->features,"no_f0_target_model"))
         return u;
@@ -166,6 +207,12 @@ cst_utterance *us_f0_model(cst_utterance *u)
     mean *= get_param_float(u->features,"f0_shift", 1.0);
     stddev = get_param_float(u->features,"int_f0_target_stddev", 12.0);
     
+    if (get_param_int(u->features,"compiled_prosody",TRUE))
+    {
+        model = &us_f0_lr_compiled;
+        ff_bind(u->ffunctions,model->ffunc_names,model->num_feats,ff);
+    }
+
     lend = 0;
     for (syl=relation_head(utt_relation(u,"Syllable"));
 	 syl;
@@ -188,7 +235,10 @@ cst_utterance *us_f0_model(cst_utterance *u)
 	if (local_stddev == 0.0)
 		local_stddev = stddev;
 
-	apply_lr_model(syl,f0_lr_terms,&start,&mid,&end);
+        if (model)
+            apply_lr_model_compiled(syl,model,ff,&start,&mid,&end);
+        else
+            apply_lr_model(syl,f0_lr_terms,&start,&mid,&end);
 	if (post_break(syl))
 	    lend = map_f0(start,local_mean,local_stddev);
 	add_target_point(targ_rel,
@@ -0,0 +1,4224 @@
+/*******************************************************/
+/**  Autogenerated by tools/compile_prosody from the   */
+/**  carts and F0 model in lang/usenglish, don't edit   */
+/*******************************************************/
+
+#include "cst_string.h"
+#include "cst_cart.h"
+#include "cst_regex.h"
+#include "usenglish.h"
+#include "us_f0.h"
+
+/* us_int_accent_cart */
+
+static const cst_val *us_int_accent_f0(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.R:Token.parent.EMPH */
+    return ffeature_at(item_parent(item_as(item_parent(item_as(i,"SylStructure")),"Token")),
+                       "EMPH",ff[0]);
+}
+
+static const cst_val *us_int_accent_f1(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* n.R:SylStructure.parent.R:Token.parent.EMPH */
+    return ffeature_at(item_parent(item_as(item_parent(item_as(item_next(i),"SylStructure")),"Token")),
+                       "EMPH",ff[1]);
+}
+
+static const cst_val *us_int_accent_f2(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* p.R:SylStructure.parent.R:Token.parent.EMPH */
+    return ffeature_at(item_parent(item_as(item_parent(item_as(item_prev(i),"SylStructure")),"Token")),
+                       "EMPH",ff[2]);
+}
+
+static const cst_val *us_int_accent_f3(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* ssyl_in */
+    return ffeature_at(i,
+                       "ssyl_in",ff[3]);
+}
+
+static const cst_val *us_int_accent_f4(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.gpos */
+    return ffeature_at(item_parent(item_as(i,"SylStructure")),
+                       "gpos",ff[4]);
+}
+
+static const cst_val *us_int_accent_f5(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* ssyl_out */
+    return ffeature_at(i,
+                       "ssyl_out",ff[5]);
+}
+
+static const cst_val *us_int_accent_f6(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* stress */
+    return ffeature_at(i,
+                       "stress",ff[6]);
+}
+
+static const cst_val *us_int_accent_f7(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.R:Word.p.gpos */
+    return ffeature_at(item_prev(item_as(item_parent(item_as(i,"SylStructure")),"Word")),
+                       "gpos",ff[7]);
+}
+
+static const cst_val *us_int_accent_f8(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* p.syl_break */
+    return ffeature_at(item_prev(i),
+                       "syl_break",ff[8]);
+}
+
+static const cst_val *us_int_accent_f9(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* syl_break */
+    return ffeature_at(i,
+                       "syl_break",ff[9]);
+}
+
+static const cst_val *us_int_accent_f10(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* p.p.syl_break */
+    return ffeature_at(item_prev(item_prev(i)),
+                       "syl_break",ff[10]);
+}
+
+static const cst_val *us_int_accent_f11(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.R:Word.p.p.gpos */
+    return ffeature_at(item_prev(item_prev(item_as(item_parent(item_as(i,"SylStructure")),"Word"))),
+                       "gpos",ff[11]);
+}
+
+static const cst_val *us_int_accent_f12(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* syl_out */
+    return ffeature_at(i,
+                       "syl_out",ff[12]);
+}
+
+static const cst_val *us_int_accent_f13(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.R:Word.n.gpos */
+    return ffeature_at(item_next(item_as(item_parent(item_as(i,"SylStructure")),"Word")),
+                       "gpos",ff[13]);
+}
+
+static const cst_val *us_int_accent_f14(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* n.stress */
+    return ffeature_at(item_next(i),
+                       "stress",ff[14]);
+}
+
+static const cst_val *us_int_accent_f15(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* syl_in */
+    return ffeature_at(i,
+                       "syl_in",ff[15]);
+}
+
+static const cst_val *us_int_accent_f16(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* n.syl_break */
+    return ffeature_at(item_next(i),
+                       "syl_break",ff[16]);
+}
+
+static const cst_val *us_int_accent_f17(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* n.n.syl_break */
+    return ffeature_at(item_next(item_next(i)),
+                       "syl_break",ff[17]);
+}
+
+static const char * const us_int_accent_ffunc_names[] = {
+    "EMPH",
+    "EMPH",
+    "EMPH",
+    "ssyl_in",
+    "gpos",
+    "ssyl_out",
+    "stress",
+    "gpos",
+    "syl_break",
+    "syl_break",
+    "syl_break",
+    "gpos",
+    "syl_out",
+    "gpos",
+    "stress",
+    "syl_in",
+    "syl_break",
+    "syl_break",
+    NULL };
+
+static const cst_val *us_int_accent_interpret(const cst_item *i,
+        const cst_ffunction *ff)
+{
+    const cst_val *f[18];
+    const cst_val *v;
+    int k;
+
+    memset(f,0,sizeof(f));
+    if (!f[0]) f[0] = val_inc_refcount(us_int_accent_f0(i,ff));
+    if (!val_equal(f[0],us_int_accent_cart.rule_table[0].val))
+        goto n2;
+    v = us_int_accent_cart.rule_table[1].val;
+    goto done;
+n2:
+    if (!f[1]) f[1] = val_inc_refcount(us_int_accent_f1(i,ff));
+    if (!val_equal(f[1],us_int_accent_cart.rule_table[2].val))
+        goto n4;
+    v = us_int_accent_cart.rule_table[3].val;
+    goto done;
+n4:
+    if (!f[2]) f[2] = val_inc_refcount(us_int_accent_f2(i,ff));
+    if (!val_equal(f[2],us_int_accent_cart.rule_table[4].val))
+        goto n6;
+    v = us_int_accent_cart.rule_table[5].val;
+    goto done;
+n6:
+    if (!f[3]) f[3] = val_inc_refcount(us_int_accent_f3(i,ff));
+    if (!val_equal(f[3],us_int_accent_cart.rule_table[6].val))
+        goto n8;
+    v = us_int_accent_cart.rule_table[7].val;
+    goto done;
+n8:
+    if (!f[4]) f[4] = val_inc_refcount(us_int_accent_f4(i,ff));
+    if (!val_equal(f[4],us_int_accent_cart.rule_table[8].val))
+        goto n10;
+    v = us_int_accent_cart.rule_table[9].val;
+    goto done;
+n10:
+    if (!f[4]) f[4] = val_inc_refcount(us_int_accent_f4(i,ff));
+    if (!val_equal(f[4],us_int_accent_cart.rule_table[10].val))
+        goto n12;
+    v = us_int_accent_cart.rule_table[11].val;
+    goto done;
+n12:
+    if (!f[5]) f[5] = val_inc_refcount(us_int_accent_f5(i,ff));
+    if (!val_equal(f[5],us_int_accent_cart.rule_table[12].val))
+        goto n14;
+    v = us_int_accent_cart.rule_table[13].val;
+    goto done;
+n14:
+    if (!f[4]) f[4] = val_inc_refcount(us_int_accent_f4(i,ff));
+    if (!val_equal(f[4],us_int_accent_cart.rule_table[14].val))
+        goto n16;
+    v = us_int_accent_cart.rule_table[15].val;
+    goto done;
+n16:
+    if (!f[4]) f[4] = val_inc_refcount(us_int_accent_f4(i,ff));
+    if (!val_equal(f[4],us_int_accent_cart.rule_table[16].val))
+        goto n18;
+    v = us_int_accent_cart.rule_table[17].val;
+    goto done;
+n18:
+    if (!f[4]) f[4] = val_inc_refcount(us_int_accent_f4(i,ff));
+    if (!val_equal(f[4],us_int_accent_cart.rule_table[18].val))
+        goto n20;
+    v = us_int_accent_cart.rule_table[19].val;
+    goto done;
+n20:
+    if (!f[4]) f[4] = val_inc_refcount(us_int_accent_f4(i,ff));
+    if (!val_equal(f[4],us_int_accent_cart.rule_table[20].val))
+        goto n22;
+    v = us_int_accent_cart.rule_table[21].val;
+    goto done;
+n22:
+    if (!f[6]) f[6] = val_inc_refcount(us_int_accent_f6(i,ff));
+    if (!val_equal(f[6],us_int_accent_cart.rule_table[22].val))
+        goto n24;
+    v = us_int_accent_cart.rule_table[23].val;
+    goto done;
+n24:
+    if (!f[7]) f[7] = val_inc_refcount(us_int_accent_f7(i,ff));
+    if (!val_equal(f[7],us_int_accent_cart.rule_table[24].val))
+        goto n26;
+    v = us_int_accent_cart.rule_table[25].val;
+    goto done;
+n26:
+    if (!f[4]) f[4] = val_inc_refcount(us_int_accent_f4(i,ff));
+    if (!val_equal(f[4],us_int_accent_cart.rule_table[26].val))
+        goto n28;
+    v = us_int_accent_cart.rule_table[27].val;
+    goto done;
+n28:
+    if (!f[8]) f[8] = val_inc_refcount(us_int_accent_f8(i,ff));
+    if (!val_equal(f[8],us_int_accent_cart.rule_table[28].val))
+        goto n32;
+    if (!f[9]) f[9] = val_inc_refcount(us_int_accent_f9(i,ff));
+    if (!val_equal(f[9],us_int_accent_cart.rule_table[29].val))
+        goto n31;
+    v = us_int_accent_cart.rule_table[30].val;
+    goto done;
+n31:
+    v = us_int_accent_cart.rule_table[31].val;
+    goto done;
+n32:
+    if (!f[10]) f[10] = val_inc_refcount(us_int_accent_f10(i,ff));
+    if (!val_equal(f[10],us_int_accent_cart.rule_table[32].val))
+        goto n46;
+    if (!f[11]) f[11] = val_inc_refcount(us_int_accent_f11(i,ff));
+    if (!val_equal(f[11],us_int_accent_cart.rule_table[33].val))
+        goto n35;
+    v = us_int_accent_cart.rule_table[34].val;
+    goto done;
+n35:
+    if (!f[12]) f[12] = val_inc_refcount(us_int_accent_f12(i,ff));
+    if (!val_equal(f[12],us_int_accent_cart.rule_table[35].val))
+        goto n37;
+    v = us_int_accent_cart.rule_table[36].val;
+    goto done;
+n37:
+    if (!f[13]) f[13] = val_inc_refcount(us_int_accent_f13(i,ff));
+    if (!val_equal(f[13],us_int_accent_cart.rule_table[37].val))
+        goto n39;
+    v = us_int_accent_cart.rule_table[38].val;
+    goto done;
+n39:
+    if (!f[9]) f[9] = val_inc_refcount(us_int_accent_f9(i,ff));
+    if (!val_equal(f[9],us_int_accent_cart.rule_table[39].val))
+        goto n41;
+    v = us_int_accent_cart.rule_table[40].val;
+    goto done;
+n41:
+    if (!f[14]) f[14] = val_inc_refcount(us_int_accent_f14(i,ff));
+    if (!val_equal(f[14],us_int_accent_cart.rule_table[41].val))
+        goto n43;
+    v = us_int_accent_cart.rule_table[42].val;
+    goto done;
+n43:
+    if (!f[8]) f[8] = val_inc_refcount(us_int_accent_f8(i,ff));
+    if (!val_equal(f[8],us_int_accent_cart.rule_table[43].val))
+        goto n45;
+    v = us_int_accent_cart.rule_table[44].val;
+    goto done;
+n45:
+    v = us_int_accent_cart.rule_table[45].val;
+    goto done;
+n46:
+    if (!f[3]) f[3] = val_inc_refcount(us_int_accent_f3(i,ff));
+    if (!val_equal(f[3],us_int_accent_cart.rule_table[46].val))
+        goto n48;
+    v = us_int_accent_cart.rule_table[47].val;
+    goto done;
+n48:
+    if (!f[5]) f[5] = val_inc_refcount(us_int_accent_f5(i,ff));
+    if (!val_equal(f[5],us_int_accent_cart.rule_table[48].val))
+        goto n50;
+    v = us_int_accent_cart.rule_table[49].val;
+    goto done;
+n50:
+    if (!f[10]) f[10] = val_inc_refcount(us_int_accent_f10(i,ff));
+    if (!val_equal(f[10],us_int_accent_cart.rule_table[50].val))
+        goto n54;
+    if (!f[7]) f[7] = val_inc_refcount(us_int_accent_f7(i,ff));
+    if (!val_equal(f[7],us_int_accent_cart.rule_table[51].val))
+        goto n53;
+    v = us_int_accent_cart.rule_table[52].val;
+    goto done;
+n53:
+    v = us_int_accent_cart.rule_table[53].val;
+    goto done;
+n54:
+    if (!f[15]) f[15] = val_inc_refcount(us_int_accent_f15(i,ff));
+    if (!val_equal(f[15],us_int_accent_cart.rule_table[54].val))
+        goto n68;
+    if (!f[14]) f[14] = val_inc_refcount(us_int_accent_f14(i,ff));
+    if (!val_equal(f[14],us_int_accent_cart.rule_table[55].val))
+        goto n65;
+    if (!f[7]) f[7] = val_inc_refcount(us_int_accent_f7(i,ff));
+    if (!val_equal(f[7],us_int_accent_cart.rule_table[56].val))
+        goto n58;
+    v = us_int_accent_cart.rule_table[57].val;
+    goto done;
+n58:
+    if (!f[12]) f[12] = val_inc_refcount(us_int_accent_f12(i,ff));
+    if (!val_equal(f[12],us_int_accent_cart.rule_table[58].val))
+        goto n60;
+    v = us_int_accent_cart.rule_table[59].val;
+    goto done;
+n60:
+    if (!f[7]) f[7] = val_inc_refcount(us_int_accent_f7(i,ff));
+    if (!val_equal(f[7],us_int_accent_cart.rule_table[60].val))
+        goto n64;
+    if (!f[12]) f[12] = val_inc_refcount(us_int_accent_f12(i,ff));
+    if (!val_equal(f[12],us_int_accent_cart.rule_table[61].val))
+        goto n63;
+    v = us_int_accent_cart.rule_table[62].val;
+    goto done;
+n63:
+    v = us_int_accent_cart.rule_table[63].val;
+    goto done;
+n64:
+    v = us_int_accent_cart.rule_table[64].val;
+    goto done;
+n65:
+    if (!f[16]) f[16] = val_inc_refcount(us_int_accent_f16(i,ff));
+    if (!val_equal(f[16],us_int_accent_cart.rule_table[65].val))
+        goto n67;
+    v = us_int_accent_cart.rule_table[66].val;
+    goto done;
+n67:
+    v = us_int_accent_cart.rule_table[67].val;
+    goto done;
+n68:
+    if (!f[13]) f[13] = val_inc_refcount(us_int_accent_f13(i,ff));
+    if (!val_equal(f[13],us_int_accent_cart.rule_table[68].val))
+        goto n72;
+    if (!f[9]) f[9] = val_inc_refcount(us_int_accent_f9(i,ff));
+    if (!val_equal(f[9],us_int_accent_cart.rule_table[69].val))
+        goto n71;
+    v = us_int_accent_cart.rule_table[70].val;
+    goto done;
+n71:
+    v = us_int_accent_cart.rule_table[71].val;
+    goto done;
+n72:
+    if (!f[9]) f[9] = val_inc_refcount(us_int_accent_f9(i,ff));
+    if (!val_equal(f[9],us_int_accent_cart.rule_table[72].val))
+        goto n82;
+    if (!f[3]) f[3] = val_inc_refcount(us_int_accent_f3(i,ff));
+    if (!val_equal(f[3],us_int_accent_cart.rule_table[73].val))
+        goto n75;
+    v = us_int_accent_cart.rule_table[74].val;
+    goto done;
+n75:
+    if (!f[8]) f[8] = val_inc_refcount(us_int_accent_f8(i,ff));
+    if (!val_equal(f[8],us_int_accent_cart.rule_table[75].val))
+        goto n77;
+    v = us_int_accent_cart.rule_table[76].val;
+    goto done;
+n77:
+    if (!f[14]) f[14] = val_inc_refcount(us_int_accent_f14(i,ff));
+    if (!val_equal(f[14],us_int_accent_cart.rule_table[77].val))
+        goto n81;
+    if (!f[10]) f[10] = val_inc_refcount(us_int_accent_f10(i,ff));
+    if (!val_equal(f[10],us_int_accent_cart.rule_table[78].val))
+        goto n80;
+    v = us_int_accent_cart.rule_table[79].val;
+    goto done;
+n80:
+    v = us_int_accent_cart.rule_table[80].val;
+    goto done;
+n81:
+    v = us_int_accent_cart.rule_table[81].val;
+    goto done;
+n82:
+    if (!f[12]) f[12] = val_inc_refcount(us_int_accent_f12(i,ff));
+    if (!val_equal(f[12],us_int_accent_cart.rule_table[82].val))
+        goto n88;
+    if (!f[17]) f[17] = val_inc_refcount(us_int_accent_f17(i,ff));
+    if (!val_equal(f[17],us_int_accent_cart.rule_table[83].val))
+        goto n87;
+    if (!f[10]) f[10] = val_inc_refcount(us_int_accent_f10(i,ff));
+    if (!val_equal(f[10],us_int_accent_cart.rule_table[84].val))
+        goto n86;
+    v = us_int_accent_cart.rule_table[85].val;
+    goto done;
+n86:
+    v = us_int_accent_cart.rule_table[86].val;
+    goto done;
+n87:
+    v = us_int_accent_cart.rule_table[87].val;
+    goto done;
+n88:
+    if (!f[12]) f[12] = val_inc_refcount(us_int_accent_f12(i,ff));
+    if (!val_equal(f[12],us_int_accent_cart.rule_table[88].val))
+        goto n92;
+    if (!f[7]) f[7] = val_inc_refcount(us_int_accent_f7(i,ff));
+    if (!val_equal(f[7],us_int_accent_cart.rule_table[89].val))
+        goto n91;
+    v = us_int_accent_cart.rule_table[90].val;
+    goto done;
+n91:
+    v = us_int_accent_cart.rule_table[91].val;
+    goto done;
+n92:
+    if (!f[11]) f[11] = val_inc_refcount(us_int_accent_f11(i,ff));
+    if (!val_equal(f[11],us_int_accent_cart.rule_table[92].val))
+        goto n102;
+    if (!f[15]) f[15] = val_inc_refcount(us_int_accent_f15(i,ff));
+    if (!val_equal(f[15],us_int_accent_cart.rule_table[93].val))
+        goto n95;
+    v = us_int_accent_cart.rule_table[94].val;
+    goto done;
+n95:
+    if (!f[15]) f[15] = val_inc_refcount(us_int_accent_f15(i,ff));
+    if (!val_equal(f[15],us_int_accent_cart.rule_table[95].val))
+        goto n97;
+    v = us_int_accent_cart.rule_table[96].val;
+    goto done;
+n97:
+    if (!f[10]) f[10] = val_inc_refcount(us_int_accent_f10(i,ff));
+    if (!val_equal(f[10],us_int_accent_cart.rule_table[97].val))
+        goto n99;
+    v = us_int_accent_cart.rule_table[98].val;
+    goto done;
+n99:
+    if (!f[7]) f[7] = val_inc_refcount(us_int_accent_f7(i,ff));
+    if (!val_equal(f[7],us_int_accent_cart.rule_table[99].val))
+        goto n101;
+    v = us_int_accent_cart.rule_table[100].val;
+    goto done;
+n101:
+    v = us_int_accent_cart.rule_table[101].val;
+    goto done;
+n102:
+    if (!f[5]) f[5] = val_inc_refcount(us_int_accent_f5(i,ff));
+    if (!val_equal(f[5],us_int_accent_cart.rule_table[102].val))
+        goto n108;
+    if (!f[8]) f[8] = val_inc_refcount(us_int_accent_f8(i,ff));
+    if (!val_equal(f[8],us_int_accent_cart.rule_table[103].val))
+        goto n105;
+    v = us_int_accent_cart.rule_table[104].val;
+    goto done;
+n105:
+    if (!f[10]) f[10] = val_inc_refcount(us_int_accent_f10(i,ff));
+    if (!val_equal(f[10],us_int_accent_cart.rule_table[105].val))
+        goto n107;
+    v = us_int_accent_cart.rule_table[106].val;
+    goto done;
+n107:
+    v = us_int_accent_cart.rule_table[107].val;
+    goto done;
+n108:
+    if (!f[11]) f[11] = val_inc_refcount(us_int_accent_f11(i,ff));
+    if (!val_equal(f[11],us_int_accent_cart.rule_table[108].val))
+        goto n110;
+    v = us_int_accent_cart.rule_table[109].val;
+    goto done;
+n110:
+    if (!f[9]) f[9] = val_inc_refcount(us_int_accent_f9(i,ff));
+    if (!val_equal(f[9],us_int_accent_cart.rule_table[110].val))
+        goto n114;
+    if (!f[10]) f[10] = val_inc_refcount(us_int_accent_f10(i,ff));
+    if (!val_equal(f[10],us_int_accent_cart.rule_table[111].val))
+        goto n113;
+    v = us_int_accent_cart.rule_table[112].val;
+    goto done;
+n113:
+    v = us_int_accent_cart.rule_table[113].val;
+    goto done;
+n114:
+    if (!f[15]) f[15] = val_inc_refcount(us_int_accent_f15(i,ff));
+    if (!val_equal(f[15],us_int_accent_cart.rule_table[114].val))
+        goto n120;
+    if (!f[14]) f[14] = val_inc_refcount(us_int_accent_f14(i,ff));
+    if (!val_equal(f[14],us_int_accent_cart.rule_table[115].val))
+        goto n119;
+    if (!f[13]) f[13] = val_inc_refcount(us_int_accent_f13(i,ff));
+    if (!val_equal(f[13],us_int_accent_cart.rule_table[116].val))
+        goto n118;
+    v = us_int_accent_cart.rule_table[117].val;
+    goto done;
+n118:
+    v = us_int_accent_cart.rule_table[118].val;
+    goto done;
+n119:
+    v = us_int_accent_cart.rule_table[119].val;
+    goto done;
+n120:
+    if (!f[13]) f[13] = val_inc_refcount(us_int_accent_f13(i,ff));
+    if (!val_equal(f[13],us_int_accent_cart.rule_table[120].val))
+        goto n122;
+    v = us_int_accent_cart.rule_table[121].val;
+    goto done;
+n122:
+    if (!f[17]) f[17] = val_inc_refcount(us_int_accent_f17(i,ff));
+    if (!val_equal(f[17],us_int_accent_cart.rule_table[122].val))
+        goto n124;
+    v = us_int_accent_cart.rule_table[123].val;
+    goto done;
+n124:
+    if (!f[3]) f[3] = val_inc_refcount(us_int_accent_f3(i,ff));
+    if (!val_equal(f[3],us_int_accent_cart.rule_table[124].val))
+        goto n126;
+    v = us_int_accent_cart.rule_table[125].val;
+    goto done;
+n126:
+    if (!f[8]) f[8] = val_inc_refcount(us_int_accent_f8(i,ff));
+    if (!val_equal(f[8],us_int_accent_cart.rule_table[126].val))
+        goto n136;
+    if (!f[16]) f[16] = val_inc_refcount(us_int_accent_f16(i,ff));
+    if (!val_equal(f[16],us_int_accent_cart.rule_table[127].val))
+        goto n129;
+    v = us_int_accent_cart.rule_table[128].val;
+    goto done;
+n129:
+    if (!f[3]) f[3] = val_inc_refcount(us_int_accent_f3(i,ff));
+    if (!val_equal(f[3],us_int_accent_cart.rule_table[129].val))
+        goto n131;
+    v = us_int_accent_cart.rule_table[130].val;
+    goto done;
+n131:
+    if (!f[10]) f[10] = val_inc_refcount(us_int_accent_f10(i,ff));
+    if (!val_equal(f[10],us_int_accent_cart.rule_table[131].val))
+        goto n133;
+    v = us_int_accent_cart.rule_table[132].val;
+    goto done;
+n133:
+    if (!f[3]) f[3] = val_inc_refcount(us_int_accent_f3(i,ff));
+    if (!val_equal(f[3],us_int_accent_cart.rule_table[133].val))
+        goto n135;
+    v = us_int_accent_cart.rule_table[134].val;
+    goto done;
+n135:
+    v = us_int_accent_cart.rule_table[135].val;
+    goto done;
+n136:
+    if (!f[7]) f[7] = val_inc_refcount(us_int_accent_f7(i,ff));
+    if (!val_equal(f[7],us_int_accent_cart.rule_table[136].val))
+        goto n138;
+    v = us_int_accent_cart.rule_table[137].val;
+    goto done;
+n138:
+    if (!f[15]) f[15] = val_inc_refcount(us_int_accent_f15(i,ff));
+    if (!val_equal(f[15],us_int_accent_cart.rule_table[138].val))
+        goto n140;
+    v = us_int_accent_cart.rule_table[139].val;
+    goto done;
+n140:
+    if (!f[12]) f[12] = val_inc_refcount(us_int_accent_f12(i,ff));
+    if (!val_equal(f[12],us_int_accent_cart.rule_table[140].val))
+        goto n142;
+    v = us_int_accent_cart.rule_table[141].val;
+    goto done;
+n142:
+    if (!f[15]) f[15] = val_inc_refcount(us_int_accent_f15(i,ff));
+    if (!val_equal(f[15],us_int_accent_cart.rule_table[142].val))
+        goto n144;
+    v = us_int_accent_cart.rule_table[143].val;
+    goto done;
+n144:
+    if (!f[14]) f[14] = val_inc_refcount(us_int_accent_f14(i,ff));
+    if (!val_equal(f[14],us_int_accent_cart.rule_table[144].val))
+        goto n148;
+    if (!f[15]) f[15] = val_inc_refcount(us_int_accent_f15(i,ff));
+    if (!val_equal(f[15],us_int_accent_cart.rule_table[145].val))
+        goto n147;
+    v = us_int_accent_cart.rule_table[146].val;
+    goto done;
+n147:
+    v = us_int_accent_cart.rule_table[147].val;
+    goto done;
+n148:
+    v = us_int_accent_cart.rule_table[148].val;
+    goto done;
+done:
+    for (k=0; k<18; k++)
+        delete_val((cst_val *)(void *)f[k]);
+    return v;
+}
+
+const cst_cart_compiled us_int_accent_cart_compiled = {
+    &us_int_accent_cart,
+    18,
+    us_int_accent_ffunc_names,
+    us_int_accent_interpret
+};
+
+/* us_int_tone_cart */
+
+static const cst_val *us_int_tone_f0(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* lisp_syl_yn_question */
+    return ffeature_at(i,
+                       "lisp_syl_yn_question",ff[0]);
+}
+
+static const cst_val *us_int_tone_f1(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.gpos */
+    return ffeature_at(item_parent(item_as(i,"SylStructure")),
+                       "gpos",ff[1]);
+}
+
+static const cst_val *us_int_tone_f2(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* ssyl_in */
+    return ffeature_at(i,
+                       "ssyl_in",ff[2]);
+}
+
+static const cst_val *us_int_tone_f3(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* p.old_syl_break */
+    return ffeature_at(item_prev(i),
+                       "old_syl_break",ff[3]);
+}
+
+static const cst_val *us_int_tone_f4(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* n.old_syl_break */
+    return ffeature_at(item_next(i),
+                       "old_syl_break",ff[4]);
+}
+
+static const cst_val *us_int_tone_f5(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* old_syl_break */
+    return ffeature_at(i,
+                       "old_syl_break",ff[5]);
+}
+
+static const cst_val *us_int_tone_f6(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.R:Word.n.gpos */
+    return ffeature_at(item_next(item_as(item_parent(item_as(i,"SylStructure")),"Word")),
+                       "gpos",ff[6]);
+}
+
+static const cst_val *us_int_tone_f7(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.R:Word.p.gpos */
+    return ffeature_at(item_prev(item_as(item_parent(item_as(i,"SylStructure")),"Word")),
+                       "gpos",ff[7]);
+}
+
+static const cst_val *us_int_tone_f8(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* syl_in */
+    return ffeature_at(i,
+                       "syl_in",ff[8]);
+}
+
+static const cst_val *us_int_tone_f9(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* sub_phrases */
+    return ffeature_at(i,
+                       "sub_phrases",ff[9]);
+}
+
+static const cst_val *us_int_tone_f10(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* n.stress */
+    return ffeature_at(item_next(i),
+                       "stress",ff[10]);
+}
+
+static const cst_val *us_int_tone_f11(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.R:Word.n.n.gpos */
+    return ffeature_at(item_next(item_next(item_as(item_parent(item_as(i,"SylStructure")),"Word"))),
+                       "gpos",ff[11]);
+}
+
+static const cst_val *us_int_tone_f12(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* p.p.old_syl_break */
+    return ffeature_at(item_prev(item_prev(i)),
+                       "old_syl_break",ff[12]);
+}
+
+static const cst_val *us_int_tone_f13(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* n.n.old_syl_break */
+    return ffeature_at(item_next(item_next(i)),
+                       "old_syl_break",ff[13]);
+}
+
+static const cst_val *us_int_tone_f14(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.R:Word.p.p.gpos */
+    return ffeature_at(item_prev(item_prev(item_as(item_parent(item_as(i,"SylStructure")),"Word"))),
+                       "gpos",ff[14]);
+}
+
+static const char * const us_int_tone_ffunc_names[] = {
+    "lisp_syl_yn_question",
+    "gpos",
+    "ssyl_in",
+    "old_syl_break",
+    "old_syl_break",
+    "old_syl_break",
+    "gpos",
+    "gpos",
+    "syl_in",
+    "sub_phrases",
+    "stress",
+    "gpos",
+    "old_syl_break",
+    "old_syl_break",
+    "gpos",
+    NULL };
+
+static const cst_val *us_int_tone_interpret(const cst_item *i,
+        const cst_ffunction *ff)
+{
+    const cst_val *f[15];
+    const cst_val *v;
+    int k;
+
+    memset(f,0,sizeof(f));
+    if (!f[0]) f[0] = val_inc_refcount(us_int_tone_f0(i,ff));
+    if (!val_equal(f[0],us_int_tone_cart.rule_table[0].val))
+        goto n2;
+    v = us_int_tone_cart.rule_table[1].val;
+    goto done;
+n2:
+    if (!f[1]) f[1] = val_inc_refcount(us_int_tone_f1(i,ff));
+    if (!val_equal(f[1],us_int_tone_cart.rule_table[2].val))
+        goto n4;
+    v = us_int_tone_cart.rule_table[3].val;
+    goto done;
+n4:
+    if (!f[2]) f[2] = val_inc_refcount(us_int_tone_f2(i,ff));
+    if (!val_equal(f[2],us_int_tone_cart.rule_table[4].val))
+        goto n6;
+    v = us_int_tone_cart.rule_table[5].val;
+    goto done;
+n6:
+    if (!f[1]) f[1] = val_inc_refcount(us_int_tone_f1(i,ff));
+    if (!val_equal(f[1],us_int_tone_cart.rule_table[6].val))
+        goto n8;
+    v = us_int_tone_cart.rule_table[7].val;
+    goto done;
+n8:
+    if (!f[3]) f[3] = val_inc_refcount(us_int_tone_f3(i,ff));
+    if (!val_equal(f[3],us_int_tone_cart.rule_table[8].val))
+        goto n10;
+    v = us_int_tone_cart.rule_table[9].val;
+    goto done;
+n10:
+    if (!f[1]) f[1] = val_inc_refcount(us_int_tone_f1(i,ff));
+    if (!val_equal(f[1],us_int_tone_cart.rule_table[10].val))
+        goto n12;
+    v = us_int_tone_cart.rule_table[11].val;
+    goto done;
+n12:
+    if (!f[4]) f[4] = val_inc_refcount(us_int_tone_f4(i,ff));
+    if (!val_equal(f[4],us_int_tone_cart.rule_table[12].val))
+        goto n14;
+    v = us_int_tone_cart.rule_table[13].val;
+    goto done;
+n14:
+    if (!f[4]) f[4] = val_inc_refcount(us_int_tone_f4(i,ff));
+    if (!val_equal(f[4],us_int_tone_cart.rule_table[14].val))
+        goto n16;
+    v = us_int_tone_cart.rule_table[15].val;
+    goto done;
+n16:
+    if (!f[1]) f[1] = val_inc_refcount(us_int_tone_f1(i,ff));
+    if (!val_equal(f[1],us_int_tone_cart.rule_table[16].val))
+        goto n18;
+    v = us_int_tone_cart.rule_table[17].val;
+    goto done;
+n18:
+    if (!f[5]) f[5] = val_inc_refcount(us_int_tone_f5(i,ff));
+    if (!val_equal(f[5],us_int_tone_cart.rule_table[18].val))
+        goto n46;
+    if (!f[6]) f[6] = val_inc_refcount(us_int_tone_f6(i,ff));
+    if (!val_equal(f[6],us_int_tone_cart.rule_table[19].val))
+        goto n21;
+    v = us_int_tone_cart.rule_table[20].val;
+    goto done;
+n21:
+    if (!f[7]) f[7] = val_inc_refcount(us_int_tone_f7(i,ff));
+    if (!val_equal(f[7],us_int_tone_cart.rule_table[21].val))
+        goto n23;
+    v = us_int_tone_cart.rule_table[22].val;
+    goto done;
+n23:
+    if (!f[6]) f[6] = val_inc_refcount(us_int_tone_f6(i,ff));
+    if (!val_equal(f[6],us_int_tone_cart.rule_table[23].val))
+        goto n25;
+    v = us_int_tone_cart.rule_table[24].val;
+    goto done;
+n25:
+    if (!f[2]) f[2] = val_inc_refcount(us_int_tone_f2(i,ff));
+    if (!val_equal(f[2],us_int_tone_cart.rule_table[25].val))
+        goto n27;
+    v = us_int_tone_cart.rule_table[26].val;
+    goto done;
+n27:
+    if (!f[8]) f[8] = val_inc_refcount(us_int_tone_f8(i,ff));
+    if (!val_equal(f[8],us_int_tone_cart.rule_table[27].val))
+        goto n29;
+    v = us_int_tone_cart.rule_table[28].val;
+    goto done;
+n29:
+    if (!f[6]) f[6] = val_inc_refcount(us_int_tone_f6(i,ff));
+    if (!val_equal(f[6],us_int_tone_cart.rule_table[29].val))
+        goto n31;
+    v = us_int_tone_cart.rule_table[30].val;
+    goto done;
+n31:
+    if (!f[8]) f[8] = val_inc_refcount(us_int_tone_f8(i,ff));
+    if (!val_equal(f[8],us_int_tone_cart.rule_table[31].val))
+        goto n33;
+    v = us_int_tone_cart.rule_table[32].val;
+    goto done;
+n33:
+    if (!f[9]) f[9] = val_inc_refcount(us_int_tone_f9(i,ff));
+    if (!val_equal(f[9],us_int_tone_cart.rule_table[33].val))
+        goto n35;
+    v = us_int_tone_cart.rule_table[34].val;
+    goto done;
+n35:
+    if (!f[7]) f[7] = val_inc_refcount(us_int_tone_f7(i,ff));
+    if (!val_equal(f[7],us_int_tone_cart.rule_table[35].val))
+        goto n37;
+    v = us_int_tone_cart.rule_table[36].val;
+    goto done;
+n37:
+    if (!f[9]) f[9] = val_inc_refcount(us_int_tone_f9(i,ff));
+    if (!val_equal(f[9],us_int_tone_cart.rule_table[37].val))
+        goto n45;
+    if (!f[6]) f[6] = val_inc_refcount(us_int_tone_f6(i,ff));
+    if (!val_equal(f[6],us_int_tone_cart.rule_table[38].val))
+        goto n42;
+    if (!f[4]) f[4] = val_inc_refcount(us_int_tone_f4(i,ff));
+    if (!val_equal(f[4],us_int_tone_cart.rule_table[39].val))
+        goto n41;
+    v = us_int_tone_cart.rule_table[40].val;
+    goto done;
+n41:
+    v = us_int_tone_cart.rule_table[41].val;
+    goto done;
+n42:
+    if (!f[10]) f[10] = val_inc_refcount(us_int_tone_f10(i,ff));
+    if (!val_equal(f[10],us_int_tone_cart.rule_table[42].val))
+        goto n44;
+    v = us_int_tone_cart.rule_table[43].val;
+    goto done;
+n44:
+    v = us_int_tone_cart.rule_table[44].val;
+    goto done;
+n45:
+    v = us_int_tone_cart.rule_table[45].val;
+    goto done;
+n46:
+    if (!f[1]) f[1] = val_inc_refcount(us_int_tone_f1(i,ff));
+    if (!val_equal(f[1],us_int_tone_cart.rule_table[46].val))
+        goto n48;
+    v = us_int_tone_cart.rule_table[47].val;
+    goto done;
+n48:
+    if (!f[8]) f[8] = val_inc_refcount(us_int_tone_f8(i,ff));
+    if (!val_equal(f[8],us_int_tone_cart.rule_table[48].val))
+        goto n50;
+    v = us_int_tone_cart.rule_table[49].val;
+    goto done;
+n50:
+    if (!f[1]) f[1] = val_inc_refcount(us_int_tone_f1(i,ff));
+    if (!val_equal(f[1],us_int_tone_cart.rule_table[50].val))
+        goto n94;
+    if (!f[11]) f[11] = val_inc_refcount(us_int_tone_f11(i,ff));
+    if (!val_equal(f[11],us_int_tone_cart.rule_table[51].val))
+        goto n53;
+    v = us_int_tone_cart.rule_table[52].val;
+    goto done;
+n53:
+    if (!f[12]) f[12] = val_inc_refcount(us_int_tone_f12(i,ff));
+    if (!val_equal(f[12],us_int_tone_cart.rule_table[53].val))
+        goto n55;
+    v = us_int_tone_cart.rule_table[54].val;
+    goto done;
+n55:
+    if (!f[8]) f[8] = val_inc_refcount(us_int_tone_f8(i,ff));
+    if (!val_equal(f[8],us_int_tone_cart.rule_table[55].val))
+        goto n57;
+    v = us_int_tone_cart.rule_table[56].val;
+    goto done;
+n57:
+    if (!f[13]) f[13] = val_inc_refcount(us_int_tone_f13(i,ff));
+    if (!val_equal(f[13],us_int_tone_cart.rule_table[57].val))
+        goto n59;
+    v = us_int_tone_cart.rule_table[58].val;
+    goto done;
+n59:
+    if (!f[11]) f[11] = val_inc_refcount(us_int_tone_f11(i,ff));
+    if (!val_equal(f[11],us_int_tone_cart.rule_table[59].val))
+        goto n61;
+    v = us_int_tone_cart.rule_table[60].val;
+    goto done;
+n61:
+    if (!f[7]) f[7] = val_inc_refcount(us_int_tone_f7(i,ff));
+    if (!val_equal(f[7],us_int_tone_cart.rule_table[61].val))
+        goto n63;
+    v = us_int_tone_cart.rule_table[62].val;
+    goto done;
+n63:
+    if (!f[13]) f[13] = val_inc_refcount(us_int_tone_f13(i,ff));
+    if (!val_equal(f[13],us_int_tone_cart.rule_table[63].val))
+        goto n65;
+    v = us_int_tone_cart.rule_table[64].val;
+    goto done;
+n65:
+    if (!f[11]) f[11] = val_inc_refcount(us_int_tone_f11(i,ff));
+    if (!val_equal(f[11],us_int_tone_cart.rule_table[65].val))
+        goto n67;
+    v = us_int_tone_cart.rule_table[66].val;
+    goto done;
+n67:
+    if (!f[2]) f[2] = val_inc_refcount(us_int_tone_f2(i,ff));
+    if (!val_equal(f[2],us_int_tone_cart.rule_table[67].val))
+        goto n69;
+    v = us_int_tone_cart.rule_table[68].val;
+    goto done;
+n69:
+    if (!f[11]) f[11] = val_inc_refcount(us_int_tone_f11(i,ff));
+    if (!val_equal(f[11],us_int_tone_cart.rule_table[69].val))
+        goto n71;
+    v = us_int_tone_cart.rule_table[70].val;
+    goto done;
+n71:
+    if (!f[14]) f[14] = val_inc_refcount(us_int_tone_f14(i,ff));
+    if (!val_equal(f[14],us_int_tone_cart.rule_table[71].val))
+        goto n73;
+    v = us_int_tone_cart.rule_table[72].val;
+    goto done;
+n73:
+    if (!f[7]) f[7] = val_inc_refcount(us_int_tone_f7(i,ff));
+    if (!val_equal(f[7],us_int_tone_cart.rule_table[73].val))
+        goto n75;
+    v = us_int_tone_cart.rule_table[74].val;
+    goto done;
+n75:
+    if (!f[14]) f[14] = val_inc_refcount(us_int_tone_f14(i,ff));
+    if (!val_equal(f[14],us_int_tone_cart.rule_table[75].val))
+        goto n77;
+    v = us_int_tone_cart.rule_table[76].val;
+    goto done;
+n77:
+    if (!f[8]) f[8] = val_inc_refcount(us_int_tone_f8(i,ff));
+    if (!val_equal(f[8],us_int_tone_cart.rule_table[77].val))
+        goto n79;
+    v = us_int_tone_cart.rule_table[78].val;
+    goto done;
+n79:
+    if (!f[11]) f[11] = val_inc_refcount(us_int_tone_f11(i,ff));
+    if (!val_equal(f[11],us_int_tone_cart.rule_table[79].val))
+        goto n81;
+    v = us_int_tone_cart.rule_table[80].val;
+    goto done;
+n81:
+    if (!f[9]) f[9] = val_inc_refcount(us_int_tone_f9(i,ff));
+    if (!val_equal(f[9],us_int_tone_cart.rule_table[81].val))
+        goto n83;
+    v = us_int_tone_cart.rule_table[82].val;
+    goto done;
+n83:
+    if (!f[14]) f[14] = val_inc_refcount(us_int_tone_f14(i,ff));
+    if (!val_equal(f[14],us_int_tone_cart.rule_table[83].val))
+        goto n85;
+    v = us_int_tone_cart.rule_table[84].val;
+    goto done;
+n85:
+    if (!f[2]) f[2] = val_inc_refcount(us_int_tone_f2(i,ff));
+    if (!val_equal(f[2],us_int_tone_cart.rule_table[85].val))
+        goto n87;
+    v = us_int_tone_cart.rule_table[86].val;
+    goto done;
+n87:
+    if (!f[4]) f[4] = val_inc_refcount(us_int_tone_f4(i,ff));
+    if (!val_equal(f[4],us_int_tone_cart.rule_table[87].val))
+        goto n89;
+    v = us_int_tone_cart.rule_table[88].val;
+    goto done;
+n89:
+    if (!f[6]) f[6] = val_inc_refcount(us_int_tone_f6(i,ff));
+    if (!val_equal(f[6],us_int_tone_cart.rule_table[89].val))
+        goto n91;
+    v = us_int_tone_cart.rule_table[90].val;
+    goto done;
+n91:
+    if (!f[5]) f[5] = val_inc_refcount(us_int_tone_f5(i,ff));
+    if (!val_equal(f[5],us_int_tone_cart.rule_table[91].val))
+        goto n93;
+    v = us_int_tone_cart.rule_table[92].val;
+    goto done;
+n93:
+    v = us_int_tone_cart.rule_table[93].val;
+    goto done;
+n94:
+    v = us_int_tone_cart.rule_table[94].val;
+    goto done;
+done:
+    for (k=0; k<15; k++)
+        delete_val((cst_val *)(void *)f[k]);
+    return v;
+}
+
+const cst_cart_compiled us_int_tone_cart_compiled = {
+    &us_int_tone_cart,
+    15,
+    us_int_tone_ffunc_names,
+    us_int_tone_interpret
+};
+
+/* us_durz_cart */
+
+static const cst_val *us_durz_f0(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* name */
+    return ffeature_at(i,
+                       "name",ff[0]);
+}
+
+static const cst_val *us_durz_f1(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* emph_sil */
+    return ffeature_at(i,
+                       "emph_sil",ff[1]);
+}
+
+static const cst_val *us_durz_f2(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* p.R:SylStructure.parent.parent.pbreak */
+    return ffeature_at(item_parent(item_parent(item_as(item_prev(i),"SylStructure"))),
+                       "pbreak",ff[2]);
+}
+
+static const cst_val *us_durz_f3(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.accented */
+    return ffeature_at(item_parent(item_as(i,"SylStructure")),
+                       "accented",ff[3]);
+}
+
+static const cst_val *us_durz_f4(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* n.ph_ctype */
+    return ffeature_at(item_next(i),
+                       "ph_ctype",ff[4]);
+}
+
+static const cst_val *us_durz_f5(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* p.ph_vlng */
+    return ffeature_at(item_prev(i),
+                       "ph_vlng",ff[5]);
+}
+
+static const cst_val *us_durz_f6(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.syl_codasize */
+    return ffeature_at(item_parent(item_as(i,"SylStructure")),
+                       "syl_codasize",ff[6]);
+}
+
+static const cst_val *us_durz_f7(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* p.ph_ctype */
+    return ffeature_at(item_prev(i),
+                       "ph_ctype",ff[7]);
+}
+
+static const cst_val *us_durz_f8(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* ph_ctype */
+    return ffeature_at(i,
+                       "ph_ctype",ff[8]);
+}
+
+static const cst_val *us_durz_f9(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.syl_break */
+    return ffeature_at(item_parent(item_as(i,"SylStructure")),
+                       "syl_break",ff[9]);
+}
+
+static const cst_val *us_durz_f10(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.asyl_in */
+    return ffeature_at(item_parent(item_as(i,"SylStructure")),
+                       "asyl_in",ff[10]);
+}
+
+static const cst_val *us_durz_f11(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* ph_vlng */
+    return ffeature_at(i,
+                       "ph_vlng",ff[11]);
+}
+
+static const cst_val *us_durz_f12(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* p.p.ph_vfront */
+    return ffeature_at(item_prev(item_prev(i)),
+                       "ph_vfront",ff[12]);
+}
+
+static const cst_val *us_durz_f13(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* seg_onsetcoda */
+    return ffeature_at(i,
+                       "seg_onsetcoda",ff[13]);
+}
+
+static const cst_val *us_durz_f14(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.parent.gpos */
+    return ffeature_at(item_parent(item_parent(item_as(i,"SylStructure"))),
+                       "gpos",ff[14]);
+}
+
+static const cst_val *us_durz_f15(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.last_accent */
+    return ffeature_at(item_parent(item_as(i,"SylStructure")),
+                       "last_accent",ff[15]);
+}
+
+static const cst_val *us_durz_f16(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.sub_phrases */
+    return ffeature_at(item_parent(item_as(i,"SylStructure")),
+                       "sub_phrases",ff[16]);
+}
+
+static const cst_val *us_durz_f17(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* pos_in_syl */
+    return ffeature_at(i,
+                       "pos_in_syl",ff[17]);
+}
+
+static const cst_val *us_durz_f18(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.R:Syllable.p.syl_break */
+    return ffeature_at(item_prev(item_as(item_parent(item_as(i,"SylStructure")),"Syllable")),
+                       "syl_break",ff[18]);
+}
+
+static const cst_val *us_durz_f19(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.R:Syllable.n.syl_onsetsize */
+    return ffeature_at(item_next(item_as(item_parent(item_as(i,"SylStructure")),"Syllable")),
+                       "syl_onsetsize",ff[19]);
+}
+
+static const cst_val *us_durz_f20(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* seg_onset_stop */
+    return ffeature_at(i,
+                       "seg_onset_stop",ff[20]);
+}
+
+static const cst_val *us_durz_f21(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.position_type */
+    return ffeature_at(item_parent(item_as(i,"SylStructure")),
+                       "position_type",ff[21]);
+}
+
+static const cst_val *us_durz_f22(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.syl_out */
+    return ffeature_at(item_parent(item_as(i,"SylStructure")),
+                       "syl_out",ff[22]);
+}
+
+static const cst_val *us_durz_f23(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* p.p.ph_vlng */
+    return ffeature_at(item_prev(item_prev(i)),
+                       "ph_vlng",ff[23]);
+}
+
+static const cst_val *us_durz_f24(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:SylStructure.parent.parent.word_numsyls */
+    return ffeature_at(item_parent(item_parent(item_as(i,"SylStructure"))),
+                       "word_numsyls",ff[24]);
+}
+
+static const cst_val *us_durz_f25(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* seg_coda_fric */
+    return ffeature_at(i,
+                       "seg_coda_fric",ff[25]);
+}
+
+static const cst_val *us_durz_f26(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* n.n.ph_vheight */
+    return ffeature_at(item_next(item_next(i)),
+                       "ph_vheight",ff[26]);
+}
+
+static const cst_val *us_durz_f27(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* n.n.ph_vfront */
+    return ffeature_at(item_next(item_next(i)),
+                       "ph_vfront",ff[27]);
+}
+
+static const cst_val *us_durz_f28(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* ph_vheight */
+    return ffeature_at(i,
+                       "ph_vheight",ff[28]);
+}
+
+static const char * const us_durz_ffunc_names[] = {
+    "name",
+    "emph_sil",
+    "pbreak",
+    "accented",
+    "ph_ctype",
+    "ph_vlng",
+    "syl_codasize",
+    "ph_ctype",
+    "ph_ctype",
+    "syl_break",
+    "asyl_in",
+    "ph_vlng",
+    "ph_vfront",
+    "seg_onsetcoda",
+    "gpos",
+    "last_accent",
+    "sub_phrases",
+    "pos_in_syl",
+    "syl_break",
+    "syl_onsetsize",
+    "seg_onset_stop",
+    "position_type",
+    "syl_out",
+    "ph_vlng",
+    "word_numsyls",
+    "seg_coda_fric",
+    "ph_vheight",
+    "ph_vfront",
+    "ph_vheight",
+    NULL };
+
+static const cst_val *us_durz_interpret(const cst_item *i,
+        const cst_ffunction *ff)
+{
+    const cst_val *f[29];
+    const cst_val *v;
+    int k;
+
+    memset(f,0,sizeof(f));
+    if (!f[0]) f[0] = val_inc_refcount(us_durz_f0(i,ff));
+    if (!val_equal(f[0],us_durz_cart.rule_table[0].val))
+        goto n6;
+    if (!f[1]) f[1] = val_inc_refcount(us_durz_f1(i,ff));
+    if (!val_equal(f[1],us_durz_cart.rule_table[1].val))
+        goto n3;
+    v = us_durz_cart.rule_table[2].val;
+    goto done;
+n3:
+    if (!f[2]) f[2] = val_inc_refcount(us_durz_f2(i,ff));
+    if (!val_equal(f[2],us_durz_cart.rule_table[3].val))
+        goto n5;
+    v = us_durz_cart.rule_table[4].val;
+    goto done;
+n5:
+    v = us_durz_cart.rule_table[5].val;
+    goto done;
+n6:
+    if (!f[3]) f[3] = val_inc_refcount(us_durz_f3(i,ff));
+    if (!val_equal(f[3],us_durz_cart.rule_table[6].val))
+        goto n422;
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[7].val))
+        goto n159;
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[8].val))
+        goto n92;
+    if (!f[6]) f[6] = val_inc_refcount(us_durz_f6(i,ff));
+    if (!val_less(f[6],us_durz_cart.rule_table[9].val))
+        goto n43;
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[10].val))
+        goto n14;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[11].val))
+        goto n13;
+    v = us_durz_cart.rule_table[12].val;
+    goto done;
+n13:
+    v = us_durz_cart.rule_table[13].val;
+    goto done;
+n14:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[14].val))
+        goto n20;
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[15].val))
+        goto n17;
+    v = us_durz_cart.rule_table[16].val;
+    goto done;
+n17:
+    if (!f[10]) f[10] = val_inc_refcount(us_durz_f10(i,ff));
+    if (!val_less(f[10],us_durz_cart.rule_table[17].val))
+        goto n19;
+    v = us_durz_cart.rule_table[18].val;
+    goto done;
+n19:
+    v = us_durz_cart.rule_table[19].val;
+    goto done;
+n20:
+    if (!f[11]) f[11] = val_inc_refcount(us_durz_f11(i,ff));
+    if (!val_equal(f[11],us_durz_cart.rule_table[20].val))
+        goto n26;
+    if (!f[12]) f[12] = val_inc_refcount(us_durz_f12(i,ff));
+    if (!val_equal(f[12],us_durz_cart.rule_table[21].val))
+        goto n23;
+    v = us_durz_cart.rule_table[22].val;
+    goto done;
+n23:
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[23].val))
+        goto n25;
+    v = us_durz_cart.rule_table[24].val;
+    goto done;
+n25:
+    v = us_durz_cart.rule_table[25].val;
+    goto done;
+n26:
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[26].val))
+        goto n32;
+    if (!f[13]) f[13] = val_inc_refcount(us_durz_f13(i,ff));
+    if (!val_equal(f[13],us_durz_cart.rule_table[27].val))
+        goto n29;
+    v = us_durz_cart.rule_table[28].val;
+    goto done;
+n29:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[29].val))
+        goto n31;
+    v = us_durz_cart.rule_table[30].val;
+    goto done;
+n31:
+    v = us_durz_cart.rule_table[31].val;
+    goto done;
+n32:
+    if (!f[14]) f[14] = val_inc_refcount(us_durz_f14(i,ff));
+    if (!val_equal(f[14],us_durz_cart.rule_table[32].val))
+        goto n38;
+    if (!f[15]) f[15] = val_inc_refcount(us_durz_f15(i,ff));
+    if (!val_less(f[15],us_durz_cart.rule_table[33].val))
+        goto n37;
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[34].val))
+        goto n36;
+    v = us_durz_cart.rule_table[35].val;
+    goto done;
+n36:
+    v = us_durz_cart.rule_table[36].val;
+    goto done;
+n37:
+    v = us_durz_cart.rule_table[37].val;
+    goto done;
+n38:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[38].val))
+        goto n40;
+    v = us_durz_cart.rule_table[39].val;
+    goto done;
+n40:
+    if (!f[10]) f[10] = val_inc_refcount(us_durz_f10(i,ff));
+    if (!val_less(f[10],us_durz_cart.rule_table[40].val))
+        goto n42;
+    v = us_durz_cart.rule_table[41].val;
+    goto done;
+n42:
+    v = us_durz_cart.rule_table[42].val;
+    goto done;
+n43:
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[43].val))
+        goto n77;
+    if (!f[18]) f[18] = val_inc_refcount(us_durz_f18(i,ff));
+    if (!val_equal(f[18],us_durz_cart.rule_table[44].val))
+        goto n50;
+    if (!f[19]) f[19] = val_inc_refcount(us_durz_f19(i,ff));
+    if (!val_less(f[19],us_durz_cart.rule_table[45].val))
+        goto n47;
+    v = us_durz_cart.rule_table[46].val;
+    goto done;
+n47:
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[47].val))
+        goto n49;
+    v = us_durz_cart.rule_table[48].val;
+    goto done;
+n49:
+    v = us_durz_cart.rule_table[49].val;
+    goto done;
+n50:
+    if (!f[20]) f[20] = val_inc_refcount(us_durz_f20(i,ff));
+    if (!val_equal(f[20],us_durz_cart.rule_table[50].val))
+        goto n68;
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[51].val))
+        goto n53;
+    v = us_durz_cart.rule_table[52].val;
+    goto done;
+n53:
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[53].val))
+        goto n67;
+    if (!f[23]) f[23] = val_inc_refcount(us_durz_f23(i,ff));
+    if (!val_equal(f[23],us_durz_cart.rule_table[54].val))
+        goto n56;
+    v = us_durz_cart.rule_table[55].val;
+    goto done;
+n56:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[56].val))
+        goto n62;
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[57].val))
+        goto n59;
+    v = us_durz_cart.rule_table[58].val;
+    goto done;
+n59:
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[59].val))
+        goto n61;
+    v = us_durz_cart.rule_table[60].val;
+    goto done;
+n61:
+    v = us_durz_cart.rule_table[61].val;
+    goto done;
+n62:
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[62].val))
+        goto n66;
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[63].val))
+        goto n65;
+    v = us_durz_cart.rule_table[64].val;
+    goto done;
+n65:
+    v = us_durz_cart.rule_table[65].val;
+    goto done;
+n66:
+    v = us_durz_cart.rule_table[66].val;
+    goto done;
+n67:
+    v = us_durz_cart.rule_table[67].val;
+    goto done;
+n68:
+    if (!f[14]) f[14] = val_inc_refcount(us_durz_f14(i,ff));
+    if (!val_equal(f[14],us_durz_cart.rule_table[68].val))
+        goto n70;
+    v = us_durz_cart.rule_table[69].val;
+    goto done;
+n70:
+    if (!f[12]) f[12] = val_inc_refcount(us_durz_f12(i,ff));
+    if (!val_equal(f[12],us_durz_cart.rule_table[70].val))
+        goto n72;
+    v = us_durz_cart.rule_table[71].val;
+    goto done;
+n72:
+    if (!f[10]) f[10] = val_inc_refcount(us_durz_f10(i,ff));
+    if (!val_less(f[10],us_durz_cart.rule_table[72].val))
+        goto n76;
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[73].val))
+        goto n75;
+    v = us_durz_cart.rule_table[74].val;
+    goto done;
+n75:
+    v = us_durz_cart.rule_table[75].val;
+    goto done;
+n76:
+    v = us_durz_cart.rule_table[76].val;
+    goto done;
+n77:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[77].val))
+        goto n83;
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[78].val))
+        goto n82;
+    if (!f[18]) f[18] = val_inc_refcount(us_durz_f18(i,ff));
+    if (!val_equal(f[18],us_durz_cart.rule_table[79].val))
+        goto n81;
+    v = us_durz_cart.rule_table[80].val;
+    goto done;
+n81:
+    v = us_durz_cart.rule_table[81].val;
+    goto done;
+n82:
+    v = us_durz_cart.rule_table[82].val;
+    goto done;
+n83:
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[83].val))
+        goto n87;
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[84].val))
+        goto n86;
+    v = us_durz_cart.rule_table[85].val;
+    goto done;
+n86:
+    v = us_durz_cart.rule_table[86].val;
+    goto done;
+n87:
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[87].val))
+        goto n89;
+    v = us_durz_cart.rule_table[88].val;
+    goto done;
+n89:
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[89].val))
+        goto n91;
+    v = us_durz_cart.rule_table[90].val;
+    goto done;
+n91:
+    v = us_durz_cart.rule_table[91].val;
+    goto done;
+n92:
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[92].val))
+        goto n134;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[93].val))
+        goto n99;
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[94].val))
+        goto n98;
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[95].val))
+        goto n97;
+    v = us_durz_cart.rule_table[96].val;
+    goto done;
+n97:
+    v = us_durz_cart.rule_table[97].val;
+    goto done;
+n98:
+    v = us_durz_cart.rule_table[98].val;
+    goto done;
+n99:
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[99].val))
+        goto n115;
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[100].val))
+        goto n108;
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[101].val))
+        goto n103;
+    v = us_durz_cart.rule_table[102].val;
+    goto done;
+n103:
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[103].val))
+        goto n107;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[104].val))
+        goto n106;
+    v = us_durz_cart.rule_table[105].val;
+    goto done;
+n106:
+    v = us_durz_cart.rule_table[106].val;
+    goto done;
+n107:
+    v = us_durz_cart.rule_table[107].val;
+    goto done;
+n108:
+    if (!f[13]) f[13] = val_inc_refcount(us_durz_f13(i,ff));
+    if (!val_equal(f[13],us_durz_cart.rule_table[108].val))
+        goto n114;
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[109].val))
+        goto n113;
+    if (!f[15]) f[15] = val_inc_refcount(us_durz_f15(i,ff));
+    if (!val_less(f[15],us_durz_cart.rule_table[110].val))
+        goto n112;
+    v = us_durz_cart.rule_table[111].val;
+    goto done;
+n112:
+    v = us_durz_cart.rule_table[112].val;
+    goto done;
+n113:
+    v = us_durz_cart.rule_table[113].val;
+    goto done;
+n114:
+    v = us_durz_cart.rule_table[114].val;
+    goto done;
+n115:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[115].val))
+        goto n117;
+    v = us_durz_cart.rule_table[116].val;
+    goto done;
+n117:
+    if (!f[15]) f[15] = val_inc_refcount(us_durz_f15(i,ff));
+    if (!val_less(f[15],us_durz_cart.rule_table[117].val))
+        goto n125;
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[118].val))
+        goto n122;
+    if (!f[24]) f[24] = val_inc_refcount(us_durz_f24(i,ff));
+    if (!val_less(f[24],us_durz_cart.rule_table[119].val))
+        goto n121;
+    v = us_durz_cart.rule_table[120].val;
+    goto done;
+n121:
+    v = us_durz_cart.rule_table[121].val;
+    goto done;
+n122:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[122].val))
+        goto n124;
+    v = us_durz_cart.rule_table[123].val;
+    goto done;
+n124:
+    v = us_durz_cart.rule_table[124].val;
+    goto done;
+n125:
+    if (!f[25]) f[25] = val_inc_refcount(us_durz_f25(i,ff));
+    if (!val_equal(f[25],us_durz_cart.rule_table[125].val))
+        goto n131;
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[126].val))
+        goto n128;
+    v = us_durz_cart.rule_table[127].val;
+    goto done;
+n128:
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[128].val))
+        goto n130;
+    v = us_durz_cart.rule_table[129].val;
+    goto done;
+n130:
+    v = us_durz_cart.rule_table[130].val;
+    goto done;
+n131:
+    if (!f[15]) f[15] = val_inc_refcount(us_durz_f15(i,ff));
+    if (!val_less(f[15],us_durz_cart.rule_table[131].val))
+        goto n133;
+    v = us_durz_cart.rule_table[132].val;
+    goto done;
+n133:
+    v = us_durz_cart.rule_table[133].val;
+    goto done;
+n134:
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[134].val))
+        goto n144;
+    if (!f[18]) f[18] = val_inc_refcount(us_durz_f18(i,ff));
+    if (!val_equal(f[18],us_durz_cart.rule_table[135].val))
+        goto n137;
+    v = us_durz_cart.rule_table[136].val;
+    goto done;
+n137:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[137].val))
+        goto n139;
+    v = us_durz_cart.rule_table[138].val;
+    goto done;
+n139:
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[139].val))
+        goto n143;
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[140].val))
+        goto n142;
+    v = us_durz_cart.rule_table[141].val;
+    goto done;
+n142:
+    v = us_durz_cart.rule_table[142].val;
+    goto done;
+n143:
+    v = us_durz_cart.rule_table[143].val;
+    goto done;
+n144:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[144].val))
+        goto n148;
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[145].val))
+        goto n147;
+    v = us_durz_cart.rule_table[146].val;
+    goto done;
+n147:
+    v = us_durz_cart.rule_table[147].val;
+    goto done;
+n148:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[148].val))
+        goto n152;
+    if (!f[10]) f[10] = val_inc_refcount(us_durz_f10(i,ff));
+    if (!val_less(f[10],us_durz_cart.rule_table[149].val))
+        goto n151;
+    v = us_durz_cart.rule_table[150].val;
+    goto done;
+n151:
+    v = us_durz_cart.rule_table[151].val;
+    goto done;
+n152:
+    if (!f[25]) f[25] = val_inc_refcount(us_durz_f25(i,ff));
+    if (!val_equal(f[25],us_durz_cart.rule_table[152].val))
+        goto n154;
+    v = us_durz_cart.rule_table[153].val;
+    goto done;
+n154:
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[154].val))
+        goto n158;
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[155].val))
+        goto n157;
+    v = us_durz_cart.rule_table[156].val;
+    goto done;
+n157:
+    v = us_durz_cart.rule_table[157].val;
+    goto done;
+n158:
+    v = us_durz_cart.rule_table[158].val;
+    goto done;
+n159:
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[159].val))
+        goto n229;
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[160].val))
+        goto n214;
+    if (!f[18]) f[18] = val_inc_refcount(us_durz_f18(i,ff));
+    if (!val_equal(f[18],us_durz_cart.rule_table[161].val))
+        goto n169;
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[162].val))
+        goto n164;
+    v = us_durz_cart.rule_table[163].val;
+    goto done;
+n164:
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[164].val))
+        goto n166;
+    v = us_durz_cart.rule_table[165].val;
+    goto done;
+n166:
+    if (!f[26]) f[26] = val_inc_refcount(us_durz_f26(i,ff));
+    if (!val_equal(f[26],us_durz_cart.rule_table[166].val))
+        goto n168;
+    v = us_durz_cart.rule_table[167].val;
+    goto done;
+n168:
+    v = us_durz_cart.rule_table[168].val;
+    goto done;
+n169:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[169].val))
+        goto n173;
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[170].val))
+        goto n172;
+    v = us_durz_cart.rule_table[171].val;
+    goto done;
+n172:
+    v = us_durz_cart.rule_table[172].val;
+    goto done;
+n173:
+    if (!f[11]) f[11] = val_inc_refcount(us_durz_f11(i,ff));
+    if (!val_equal(f[11],us_durz_cart.rule_table[173].val))
+        goto n185;
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[174].val))
+        goto n176;
+    v = us_durz_cart.rule_table[175].val;
+    goto done;
+n176:
+    if (!f[14]) f[14] = val_inc_refcount(us_durz_f14(i,ff));
+    if (!val_equal(f[14],us_durz_cart.rule_table[176].val))
+        goto n178;
+    v = us_durz_cart.rule_table[177].val;
+    goto done;
+n178:
+    if (!f[26]) f[26] = val_inc_refcount(us_durz_f26(i,ff));
+    if (!val_equal(f[26],us_durz_cart.rule_table[178].val))
+        goto n180;
+    v = us_durz_cart.rule_table[179].val;
+    goto done;
+n180:
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[180].val))
+        goto n184;
+    if (!f[12]) f[12] = val_inc_refcount(us_durz_f12(i,ff));
+    if (!val_equal(f[12],us_durz_cart.rule_table[181].val))
+        goto n183;
+    v = us_durz_cart.rule_table[182].val;
+    goto done;
+n183:
+    v = us_durz_cart.rule_table[183].val;
+    goto done;
+n184:
+    v = us_durz_cart.rule_table[184].val;
+    goto done;
+n185:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[185].val))
+        goto n191;
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[186].val))
+        goto n190;
+    if (!f[27]) f[27] = val_inc_refcount(us_durz_f27(i,ff));
+    if (!val_equal(f[27],us_durz_cart.rule_table[187].val))
+        goto n189;
+    v = us_durz_cart.rule_table[188].val;
+    goto done;
+n189:
+    v = us_durz_cart.rule_table[189].val;
+    goto done;
+n190:
+    v = us_durz_cart.rule_table[190].val;
+    goto done;
+n191:
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[191].val))
+        goto n193;
+    v = us_durz_cart.rule_table[192].val;
+    goto done;
+n193:
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[193].val))
+        goto n195;
+    v = us_durz_cart.rule_table[194].val;
+    goto done;
+n195:
+    if (!f[6]) f[6] = val_inc_refcount(us_durz_f6(i,ff));
+    if (!val_less(f[6],us_durz_cart.rule_table[195].val))
+        goto n201;
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[196].val))
+        goto n200;
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[197].val))
+        goto n199;
+    v = us_durz_cart.rule_table[198].val;
+    goto done;
+n199:
+    v = us_durz_cart.rule_table[199].val;
+    goto done;
+n200:
+    v = us_durz_cart.rule_table[200].val;
+    goto done;
+n201:
+    if (!f[28]) f[28] = val_inc_refcount(us_durz_f28(i,ff));
+    if (!val_equal(f[28],us_durz_cart.rule_table[201].val))
+        goto n205;
+    if (!f[26]) f[26] = val_inc_refcount(us_durz_f26(i,ff));
+    if (!val_equal(f[26],us_durz_cart.rule_table[202].val))
+        goto n204;
+    v = us_durz_cart.rule_table[203].val;
+    goto done;
+n204:
+    v = us_durz_cart.rule_table[204].val;
+    goto done;
+n205:
+    if (!f[19]) f[19] = val_inc_refcount(us_durz_f19(i,ff));
+    if (!val_less(f[19],us_durz_cart.rule_table[205].val))
+        goto n209;
+    if (!f[10]) f[10] = val_inc_refcount(us_durz_f10(i,ff));
+    if (!val_less(f[10],us_durz_cart.rule_table[206].val))
+        goto n208;
+    v = us_durz_cart.rule_table[207].val;
+    goto done;
+n208:
+    v = us_durz_cart.rule_table[208].val;
+    goto done;
+n209:
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[209].val))
+        goto n211;
+    v = us_durz_cart.rule_table[210].val;
+    goto done;
+n211:
+    if (!f[14]) f[14] = val_inc_refcount(us_durz_f14(i,ff));
+    if (!val_equal(f[14],us_durz_cart.rule_table[211].val))
+        goto n213;
+    v = us_durz_cart.rule_table[212].val;
+    goto done;
+n213:
+    v = us_durz_cart.rule_table[213].val;
+    goto done;
+n214:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[214].val))
+        goto n216;
+    v = us_durz_cart.rule_table[215].val;
+    goto done;
+n216:
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[216].val))
+        goto n220;
+    if (!f[25]) f[25] = val_inc_refcount(us_durz_f25(i,ff));
+    if (!val_equal(f[25],us_durz_cart.rule_table[217].val))
+        goto n219;
+    v = us_durz_cart.rule_table[218].val;
+    goto done;
+n219:
+    v = us_durz_cart.rule_table[219].val;
+    goto done;
+n220:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[220].val))
+        goto n222;
+    v = us_durz_cart.rule_table[221].val;
+    goto done;
+n222:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[222].val))
+        goto n226;
+    if (!f[18]) f[18] = val_inc_refcount(us_durz_f18(i,ff));
+    if (!val_equal(f[18],us_durz_cart.rule_table[223].val))
+        goto n225;
+    v = us_durz_cart.rule_table[224].val;
+    goto done;
+n225:
+    v = us_durz_cart.rule_table[225].val;
+    goto done;
+n226:
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[226].val))
+        goto n228;
+    v = us_durz_cart.rule_table[227].val;
+    goto done;
+n228:
+    v = us_durz_cart.rule_table[228].val;
+    goto done;
+n229:
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[229].val))
+        goto n357;
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[230].val))
+        goto n248;
+    if (!f[11]) f[11] = val_inc_refcount(us_durz_f11(i,ff));
+    if (!val_equal(f[11],us_durz_cart.rule_table[231].val))
+        goto n233;
+    v = us_durz_cart.rule_table[232].val;
+    goto done;
+n233:
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[233].val))
+        goto n239;
+    if (!f[11]) f[11] = val_inc_refcount(us_durz_f11(i,ff));
+    if (!val_equal(f[11],us_durz_cart.rule_table[234].val))
+        goto n236;
+    v = us_durz_cart.rule_table[235].val;
+    goto done;
+n236:
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[236].val))
+        goto n238;
+    v = us_durz_cart.rule_table[237].val;
+    goto done;
+n238:
+    v = us_durz_cart.rule_table[238].val;
+    goto done;
+n239:
+    if (!f[26]) f[26] = val_inc_refcount(us_durz_f26(i,ff));
+    if (!val_equal(f[26],us_durz_cart.rule_table[239].val))
+        goto n243;
+    if (!f[28]) f[28] = val_inc_refcount(us_durz_f28(i,ff));
+    if (!val_equal(f[28],us_durz_cart.rule_table[240].val))
+        goto n242;
+    v = us_durz_cart.rule_table[241].val;
+    goto done;
+n242:
+    v = us_durz_cart.rule_table[242].val;
+    goto done;
+n243:
+    if (!f[28]) f[28] = val_inc_refcount(us_durz_f28(i,ff));
+    if (!val_equal(f[28],us_durz_cart.rule_table[243].val))
+        goto n245;
+    v = us_durz_cart.rule_table[244].val;
+    goto done;
+n245:
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[245].val))
+        goto n247;
+    v = us_durz_cart.rule_table[246].val;
+    goto done;
+n247:
+    v = us_durz_cart.rule_table[247].val;
+    goto done;
+n248:
+    if (!f[11]) f[11] = val_inc_refcount(us_durz_f11(i,ff));
+    if (!val_equal(f[11],us_durz_cart.rule_table[248].val))
+        goto n284;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[249].val))
+        goto n281;
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[250].val))
+        goto n264;
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[251].val))
+        goto n257;
+    if (!f[19]) f[19] = val_inc_refcount(us_durz_f19(i,ff));
+    if (!val_less(f[19],us_durz_cart.rule_table[252].val))
+        goto n254;
+    v = us_durz_cart.rule_table[253].val;
+    goto done;
+n254:
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[254].val))
+        goto n256;
+    v = us_durz_cart.rule_table[255].val;
+    goto done;
+n256:
+    v = us_durz_cart.rule_table[256].val;
+    goto done;
+n257:
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[257].val))
+        goto n261;
+    if (!f[19]) f[19] = val_inc_refcount(us_durz_f19(i,ff));
+    if (!val_less(f[19],us_durz_cart.rule_table[258].val))
+        goto n260;
+    v = us_durz_cart.rule_table[259].val;
+    goto done;
+n260:
+    v = us_durz_cart.rule_table[260].val;
+    goto done;
+n261:
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[261].val))
+        goto n263;
+    v = us_durz_cart.rule_table[262].val;
+    goto done;
+n263:
+    v = us_durz_cart.rule_table[263].val;
+    goto done;
+n264:
+    if (!f[20]) f[20] = val_inc_refcount(us_durz_f20(i,ff));
+    if (!val_equal(f[20],us_durz_cart.rule_table[264].val))
+        goto n278;
+    if (!f[18]) f[18] = val_inc_refcount(us_durz_f18(i,ff));
+    if (!val_equal(f[18],us_durz_cart.rule_table[265].val))
+        goto n271;
+    if (!f[12]) f[12] = val_inc_refcount(us_durz_f12(i,ff));
+    if (!val_equal(f[12],us_durz_cart.rule_table[266].val))
+        goto n268;
+    v = us_durz_cart.rule_table[267].val;
+    goto done;
+n268:
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[268].val))
+        goto n270;
+    v = us_durz_cart.rule_table[269].val;
+    goto done;
+n270:
+    v = us_durz_cart.rule_table[270].val;
+    goto done;
+n271:
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[271].val))
+        goto n275;
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[272].val))
+        goto n274;
+    v = us_durz_cart.rule_table[273].val;
+    goto done;
+n274:
+    v = us_durz_cart.rule_table[274].val;
+    goto done;
+n275:
+    if (!f[15]) f[15] = val_inc_refcount(us_durz_f15(i,ff));
+    if (!val_less(f[15],us_durz_cart.rule_table[275].val))
+        goto n277;
+    v = us_durz_cart.rule_table[276].val;
+    goto done;
+n277:
+    v = us_durz_cart.rule_table[277].val;
+    goto done;
+n278:
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[278].val))
+        goto n280;
+    v = us_durz_cart.rule_table[279].val;
+    goto done;
+n280:
+    v = us_durz_cart.rule_table[280].val;
+    goto done;
+n281:
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[281].val))
+        goto n283;
+    v = us_durz_cart.rule_table[282].val;
+    goto done;
+n283:
+    v = us_durz_cart.rule_table[283].val;
+    goto done;
+n284:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[284].val))
+        goto n294;
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[285].val))
+        goto n291;
+    if (!f[19]) f[19] = val_inc_refcount(us_durz_f19(i,ff));
+    if (!val_less(f[19],us_durz_cart.rule_table[286].val))
+        goto n290;
+    if (!f[12]) f[12] = val_inc_refcount(us_durz_f12(i,ff));
+    if (!val_equal(f[12],us_durz_cart.rule_table[287].val))
+        goto n289;
+    v = us_durz_cart.rule_table[288].val;
+    goto done;
+n289:
+    v = us_durz_cart.rule_table[289].val;
+    goto done;
+n290:
+    v = us_durz_cart.rule_table[290].val;
+    goto done;
+n291:
+    if (!f[12]) f[12] = val_inc_refcount(us_durz_f12(i,ff));
+    if (!val_equal(f[12],us_durz_cart.rule_table[291].val))
+        goto n293;
+    v = us_durz_cart.rule_table[292].val;
+    goto done;
+n293:
+    v = us_durz_cart.rule_table[293].val;
+    goto done;
+n294:
+    if (!f[11]) f[11] = val_inc_refcount(us_durz_f11(i,ff));
+    if (!val_equal(f[11],us_durz_cart.rule_table[294].val))
+        goto n322;
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[295].val))
+        goto n307;
+    if (!f[14]) f[14] = val_inc_refcount(us_durz_f14(i,ff));
+    if (!val_equal(f[14],us_durz_cart.rule_table[296].val))
+        goto n304;
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[297].val))
+        goto n299;
+    v = us_durz_cart.rule_table[298].val;
+    goto done;
+n299:
+    if (!f[24]) f[24] = val_inc_refcount(us_durz_f24(i,ff));
+    if (!val_less(f[24],us_durz_cart.rule_table[299].val))
+        goto n303;
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[300].val))
+        goto n302;
+    v = us_durz_cart.rule_table[301].val;
+    goto done;
+n302:
+    v = us_durz_cart.rule_table[302].val;
+    goto done;
+n303:
+    v = us_durz_cart.rule_table[303].val;
+    goto done;
+n304:
+    if (!f[28]) f[28] = val_inc_refcount(us_durz_f28(i,ff));
+    if (!val_equal(f[28],us_durz_cart.rule_table[304].val))
+        goto n306;
+    v = us_durz_cart.rule_table[305].val;
+    goto done;
+n306:
+    v = us_durz_cart.rule_table[306].val;
+    goto done;
+n307:
+    if (!f[14]) f[14] = val_inc_refcount(us_durz_f14(i,ff));
+    if (!val_equal(f[14],us_durz_cart.rule_table[307].val))
+        goto n309;
+    v = us_durz_cart.rule_table[308].val;
+    goto done;
+n309:
+    if (!f[18]) f[18] = val_inc_refcount(us_durz_f18(i,ff));
+    if (!val_equal(f[18],us_durz_cart.rule_table[309].val))
+        goto n311;
+    v = us_durz_cart.rule_table[310].val;
+    goto done;
+n311:
+    if (!f[14]) f[14] = val_inc_refcount(us_durz_f14(i,ff));
+    if (!val_equal(f[14],us_durz_cart.rule_table[311].val))
+        goto n319;
+    if (!f[18]) f[18] = val_inc_refcount(us_durz_f18(i,ff));
+    if (!val_equal(f[18],us_durz_cart.rule_table[312].val))
+        goto n316;
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[313].val))
+        goto n315;
+    v = us_durz_cart.rule_table[314].val;
+    goto done;
+n315:
+    v = us_durz_cart.rule_table[315].val;
+    goto done;
+n316:
+    if (!f[24]) f[24] = val_inc_refcount(us_durz_f24(i,ff));
+    if (!val_less(f[24],us_durz_cart.rule_table[316].val))
+        goto n318;
+    v = us_durz_cart.rule_table[317].val;
+    goto done;
+n318:
+    v = us_durz_cart.rule_table[318].val;
+    goto done;
+n319:
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[319].val))
+        goto n321;
+    v = us_durz_cart.rule_table[320].val;
+    goto done;
+n321:
+    v = us_durz_cart.rule_table[321].val;
+    goto done;
+n322:
+    if (!f[18]) f[18] = val_inc_refcount(us_durz_f18(i,ff));
+    if (!val_equal(f[18],us_durz_cart.rule_table[322].val))
+        goto n334;
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[323].val))
+        goto n325;
+    v = us_durz_cart.rule_table[324].val;
+    goto done;
+n325:
+    if (!f[26]) f[26] = val_inc_refcount(us_durz_f26(i,ff));
+    if (!val_equal(f[26],us_durz_cart.rule_table[325].val))
+        goto n327;
+    v = us_durz_cart.rule_table[326].val;
+    goto done;
+n327:
+    if (!f[11]) f[11] = val_inc_refcount(us_durz_f11(i,ff));
+    if (!val_equal(f[11],us_durz_cart.rule_table[327].val))
+        goto n331;
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[328].val))
+        goto n330;
+    v = us_durz_cart.rule_table[329].val;
+    goto done;
+n330:
+    v = us_durz_cart.rule_table[330].val;
+    goto done;
+n331:
+    if (!f[6]) f[6] = val_inc_refcount(us_durz_f6(i,ff));
+    if (!val_less(f[6],us_durz_cart.rule_table[331].val))
+        goto n333;
+    v = us_durz_cart.rule_table[332].val;
+    goto done;
+n333:
+    v = us_durz_cart.rule_table[333].val;
+    goto done;
+n334:
+    if (!f[23]) f[23] = val_inc_refcount(us_durz_f23(i,ff));
+    if (!val_equal(f[23],us_durz_cart.rule_table[334].val))
+        goto n338;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[335].val))
+        goto n337;
+    v = us_durz_cart.rule_table[336].val;
+    goto done;
+n337:
+    v = us_durz_cart.rule_table[337].val;
+    goto done;
+n338:
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[338].val))
+        goto n346;
+    if (!f[14]) f[14] = val_inc_refcount(us_durz_f14(i,ff));
+    if (!val_equal(f[14],us_durz_cart.rule_table[339].val))
+        goto n343;
+    if (!f[18]) f[18] = val_inc_refcount(us_durz_f18(i,ff));
+    if (!val_equal(f[18],us_durz_cart.rule_table[340].val))
+        goto n342;
+    v = us_durz_cart.rule_table[341].val;
+    goto done;
+n342:
+    v = us_durz_cart.rule_table[342].val;
+    goto done;
+n343:
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[343].val))
+        goto n345;
+    v = us_durz_cart.rule_table[344].val;
+    goto done;
+n345:
+    v = us_durz_cart.rule_table[345].val;
+    goto done;
+n346:
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[346].val))
+        goto n352;
+    if (!f[14]) f[14] = val_inc_refcount(us_durz_f14(i,ff));
+    if (!val_equal(f[14],us_durz_cart.rule_table[347].val))
+        goto n349;
+    v = us_durz_cart.rule_table[348].val;
+    goto done;
+n349:
+    if (!f[11]) f[11] = val_inc_refcount(us_durz_f11(i,ff));
+    if (!val_equal(f[11],us_durz_cart.rule_table[349].val))
+        goto n351;
+    v = us_durz_cart.rule_table[350].val;
+    goto done;
+n351:
+    v = us_durz_cart.rule_table[351].val;
+    goto done;
+n352:
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[352].val))
+        goto n356;
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[353].val))
+        goto n355;
+    v = us_durz_cart.rule_table[354].val;
+    goto done;
+n355:
+    v = us_durz_cart.rule_table[355].val;
+    goto done;
+n356:
+    v = us_durz_cart.rule_table[356].val;
+    goto done;
+n357:
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[357].val))
+        goto n371;
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[358].val))
+        goto n364;
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[359].val))
+        goto n361;
+    v = us_durz_cart.rule_table[360].val;
+    goto done;
+n361:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[361].val))
+        goto n363;
+    v = us_durz_cart.rule_table[362].val;
+    goto done;
+n363:
+    v = us_durz_cart.rule_table[363].val;
+    goto done;
+n364:
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[364].val))
+        goto n368;
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[365].val))
+        goto n367;
+    v = us_durz_cart.rule_table[366].val;
+    goto done;
+n367:
+    v = us_durz_cart.rule_table[367].val;
+    goto done;
+n368:
+    if (!f[27]) f[27] = val_inc_refcount(us_durz_f27(i,ff));
+    if (!val_equal(f[27],us_durz_cart.rule_table[368].val))
+        goto n370;
+    v = us_durz_cart.rule_table[369].val;
+    goto done;
+n370:
+    v = us_durz_cart.rule_table[370].val;
+    goto done;
+n371:
+    if (!f[12]) f[12] = val_inc_refcount(us_durz_f12(i,ff));
+    if (!val_equal(f[12],us_durz_cart.rule_table[371].val))
+        goto n417;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[372].val))
+        goto n382;
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[373].val))
+        goto n379;
+    if (!f[14]) f[14] = val_inc_refcount(us_durz_f14(i,ff));
+    if (!val_equal(f[14],us_durz_cart.rule_table[374].val))
+        goto n378;
+    if (!f[18]) f[18] = val_inc_refcount(us_durz_f18(i,ff));
+    if (!val_equal(f[18],us_durz_cart.rule_table[375].val))
+        goto n377;
+    v = us_durz_cart.rule_table[376].val;
+    goto done;
+n377:
+    v = us_durz_cart.rule_table[377].val;
+    goto done;
+n378:
+    v = us_durz_cart.rule_table[378].val;
+    goto done;
+n379:
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[379].val))
+        goto n381;
+    v = us_durz_cart.rule_table[380].val;
+    goto done;
+n381:
+    v = us_durz_cart.rule_table[381].val;
+    goto done;
+n382:
+    if (!f[11]) f[11] = val_inc_refcount(us_durz_f11(i,ff));
+    if (!val_equal(f[11],us_durz_cart.rule_table[382].val))
+        goto n386;
+    if (!f[28]) f[28] = val_inc_refcount(us_durz_f28(i,ff));
+    if (!val_equal(f[28],us_durz_cart.rule_table[383].val))
+        goto n385;
+    v = us_durz_cart.rule_table[384].val;
+    goto done;
+n385:
+    v = us_durz_cart.rule_table[385].val;
+    goto done;
+n386:
+    if (!f[19]) f[19] = val_inc_refcount(us_durz_f19(i,ff));
+    if (!val_less(f[19],us_durz_cart.rule_table[386].val))
+        goto n416;
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[387].val))
+        goto n405;
+    if (!f[18]) f[18] = val_inc_refcount(us_durz_f18(i,ff));
+    if (!val_equal(f[18],us_durz_cart.rule_table[388].val))
+        goto n390;
+    v = us_durz_cart.rule_table[389].val;
+    goto done;
+n390:
+    if (!f[18]) f[18] = val_inc_refcount(us_durz_f18(i,ff));
+    if (!val_equal(f[18],us_durz_cart.rule_table[390].val))
+        goto n396;
+    if (!f[28]) f[28] = val_inc_refcount(us_durz_f28(i,ff));
+    if (!val_equal(f[28],us_durz_cart.rule_table[391].val))
+        goto n393;
+    v = us_durz_cart.rule_table[392].val;
+    goto done;
+n393:
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[393].val))
+        goto n395;
+    v = us_durz_cart.rule_table[394].val;
+    goto done;
+n395:
+    v = us_durz_cart.rule_table[395].val;
+    goto done;
+n396:
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[396].val))
+        goto n400;
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[397].val))
+        goto n399;
+    v = us_durz_cart.rule_table[398].val;
+    goto done;
+n399:
+    v = us_durz_cart.rule_table[399].val;
+    goto done;
+n400:
+    if (!f[6]) f[6] = val_inc_refcount(us_durz_f6(i,ff));
+    if (!val_less(f[6],us_durz_cart.rule_table[400].val))
+        goto n404;
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[401].val))
+        goto n403;
+    v = us_durz_cart.rule_table[402].val;
+    goto done;
+n403:
+    v = us_durz_cart.rule_table[403].val;
+    goto done;
+n404:
+    v = us_durz_cart.rule_table[404].val;
+    goto done;
+n405:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[405].val))
+        goto n409;
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[406].val))
+        goto n408;
+    v = us_durz_cart.rule_table[407].val;
+    goto done;
+n408:
+    v = us_durz_cart.rule_table[408].val;
+    goto done;
+n409:
+    if (!f[18]) f[18] = val_inc_refcount(us_durz_f18(i,ff));
+    if (!val_equal(f[18],us_durz_cart.rule_table[409].val))
+        goto n413;
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[410].val))
+        goto n412;
+    v = us_durz_cart.rule_table[411].val;
+    goto done;
+n412:
+    v = us_durz_cart.rule_table[412].val;
+    goto done;
+n413:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[413].val))
+        goto n415;
+    v = us_durz_cart.rule_table[414].val;
+    goto done;
+n415:
+    v = us_durz_cart.rule_table[415].val;
+    goto done;
+n416:
+    v = us_durz_cart.rule_table[416].val;
+    goto done;
+n417:
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[417].val))
+        goto n419;
+    v = us_durz_cart.rule_table[418].val;
+    goto done;
+n419:
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[419].val))
+        goto n421;
+    v = us_durz_cart.rule_table[420].val;
+    goto done;
+n421:
+    v = us_durz_cart.rule_table[421].val;
+    goto done;
+n422:
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[422].val))
+        goto n674;
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[423].val))
+        goto n533;
+    if (!f[13]) f[13] = val_inc_refcount(us_durz_f13(i,ff));
+    if (!val_equal(f[13],us_durz_cart.rule_table[424].val))
+        goto n510;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[425].val))
+        goto n439;
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[426].val))
+        goto n430;
+    if (!f[23]) f[23] = val_inc_refcount(us_durz_f23(i,ff));
+    if (!val_equal(f[23],us_durz_cart.rule_table[427].val))
+        goto n429;
+    v = us_durz_cart.rule_table[428].val;
+    goto done;
+n429:
+    v = us_durz_cart.rule_table[429].val;
+    goto done;
+n430:
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[430].val))
+        goto n434;
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[431].val))
+        goto n433;
+    v = us_durz_cart.rule_table[432].val;
+    goto done;
+n433:
+    v = us_durz_cart.rule_table[433].val;
+    goto done;
+n434:
+    if (!f[12]) f[12] = val_inc_refcount(us_durz_f12(i,ff));
+    if (!val_equal(f[12],us_durz_cart.rule_table[434].val))
+        goto n438;
+    if (!f[25]) f[25] = val_inc_refcount(us_durz_f25(i,ff));
+    if (!val_equal(f[25],us_durz_cart.rule_table[435].val))
+        goto n437;
+    v = us_durz_cart.rule_table[436].val;
+    goto done;
+n437:
+    v = us_durz_cart.rule_table[437].val;
+    goto done;
+n438:
+    v = us_durz_cart.rule_table[438].val;
+    goto done;
+n439:
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[439].val))
+        goto n455;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[440].val))
+        goto n442;
+    v = us_durz_cart.rule_table[441].val;
+    goto done;
+n442:
+    if (!f[11]) f[11] = val_inc_refcount(us_durz_f11(i,ff));
+    if (!val_equal(f[11],us_durz_cart.rule_table[442].val))
+        goto n444;
+    v = us_durz_cart.rule_table[443].val;
+    goto done;
+n444:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[444].val))
+        goto n450;
+    if (!f[10]) f[10] = val_inc_refcount(us_durz_f10(i,ff));
+    if (!val_less(f[10],us_durz_cart.rule_table[445].val))
+        goto n447;
+    v = us_durz_cart.rule_table[446].val;
+    goto done;
+n447:
+    if (!f[28]) f[28] = val_inc_refcount(us_durz_f28(i,ff));
+    if (!val_equal(f[28],us_durz_cart.rule_table[447].val))
+        goto n449;
+    v = us_durz_cart.rule_table[448].val;
+    goto done;
+n449:
+    v = us_durz_cart.rule_table[449].val;
+    goto done;
+n450:
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[450].val))
+        goto n452;
+    v = us_durz_cart.rule_table[451].val;
+    goto done;
+n452:
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[452].val))
+        goto n454;
+    v = us_durz_cart.rule_table[453].val;
+    goto done;
+n454:
+    v = us_durz_cart.rule_table[454].val;
+    goto done;
+n455:
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[455].val))
+        goto n477;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[456].val))
+        goto n460;
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[457].val))
+        goto n459;
+    v = us_durz_cart.rule_table[458].val;
+    goto done;
+n459:
+    v = us_durz_cart.rule_table[459].val;
+    goto done;
+n460:
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[460].val))
+        goto n466;
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[461].val))
+        goto n465;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[462].val))
+        goto n464;
+    v = us_durz_cart.rule_table[463].val;
+    goto done;
+n464:
+    v = us_durz_cart.rule_table[464].val;
+    goto done;
+n465:
+    v = us_durz_cart.rule_table[465].val;
+    goto done;
+n466:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[466].val))
+        goto n468;
+    v = us_durz_cart.rule_table[467].val;
+    goto done;
+n468:
+    if (!f[27]) f[27] = val_inc_refcount(us_durz_f27(i,ff));
+    if (!val_equal(f[27],us_durz_cart.rule_table[468].val))
+        goto n470;
+    v = us_durz_cart.rule_table[469].val;
+    goto done;
+n470:
+    if (!f[19]) f[19] = val_inc_refcount(us_durz_f19(i,ff));
+    if (!val_less(f[19],us_durz_cart.rule_table[470].val))
+        goto n474;
+    if (!f[26]) f[26] = val_inc_refcount(us_durz_f26(i,ff));
+    if (!val_equal(f[26],us_durz_cart.rule_table[471].val))
+        goto n473;
+    v = us_durz_cart.rule_table[472].val;
+    goto done;
+n473:
+    v = us_durz_cart.rule_table[473].val;
+    goto done;
+n474:
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[474].val))
+        goto n476;
+    v = us_durz_cart.rule_table[475].val;
+    goto done;
+n476:
+    v = us_durz_cart.rule_table[476].val;
+    goto done;
+n477:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[477].val))
+        goto n481;
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[478].val))
+        goto n480;
+    v = us_durz_cart.rule_table[479].val;
+    goto done;
+n480:
+    v = us_durz_cart.rule_table[480].val;
+    goto done;
+n481:
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[481].val))
+        goto n499;
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[482].val))
+        goto n490;
+    if (!f[15]) f[15] = val_inc_refcount(us_durz_f15(i,ff));
+    if (!val_less(f[15],us_durz_cart.rule_table[483].val))
+        goto n487;
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[484].val))
+        goto n486;
+    v = us_durz_cart.rule_table[485].val;
+    goto done;
+n486:
+    v = us_durz_cart.rule_table[486].val;
+    goto done;
+n487:
+    if (!f[24]) f[24] = val_inc_refcount(us_durz_f24(i,ff));
+    if (!val_less(f[24],us_durz_cart.rule_table[487].val))
+        goto n489;
+    v = us_durz_cart.rule_table[488].val;
+    goto done;
+n489:
+    v = us_durz_cart.rule_table[489].val;
+    goto done;
+n490:
+    if (!f[6]) f[6] = val_inc_refcount(us_durz_f6(i,ff));
+    if (!val_less(f[6],us_durz_cart.rule_table[490].val))
+        goto n496;
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[491].val))
+        goto n493;
+    v = us_durz_cart.rule_table[492].val;
+    goto done;
+n493:
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[493].val))
+        goto n495;
+    v = us_durz_cart.rule_table[494].val;
+    goto done;
+n495:
+    v = us_durz_cart.rule_table[495].val;
+    goto done;
+n496:
+    if (!f[25]) f[25] = val_inc_refcount(us_durz_f25(i,ff));
+    if (!val_equal(f[25],us_durz_cart.rule_table[496].val))
+        goto n498;
+    v = us_durz_cart.rule_table[497].val;
+    goto done;
+n498:
+    v = us_durz_cart.rule_table[498].val;
+    goto done;
+n499:
+    if (!f[11]) f[11] = val_inc_refcount(us_durz_f11(i,ff));
+    if (!val_equal(f[11],us_durz_cart.rule_table[499].val))
+        goto n503;
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[500].val))
+        goto n502;
+    v = us_durz_cart.rule_table[501].val;
+    goto done;
+n502:
+    v = us_durz_cart.rule_table[502].val;
+    goto done;
+n503:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[503].val))
+        goto n509;
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[504].val))
+        goto n506;
+    v = us_durz_cart.rule_table[505].val;
+    goto done;
+n506:
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[506].val))
+        goto n508;
+    v = us_durz_cart.rule_table[507].val;
+    goto done;
+n508:
+    v = us_durz_cart.rule_table[508].val;
+    goto done;
+n509:
+    v = us_durz_cart.rule_table[509].val;
+    goto done;
+n510:
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[510].val))
+        goto n528;
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[511].val))
+        goto n525;
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[512].val))
+        goto n518;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[513].val))
+        goto n515;
+    v = us_durz_cart.rule_table[514].val;
+    goto done;
+n515:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[515].val))
+        goto n517;
+    v = us_durz_cart.rule_table[516].val;
+    goto done;
+n517:
+    v = us_durz_cart.rule_table[517].val;
+    goto done;
+n518:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[518].val))
+        goto n520;
+    v = us_durz_cart.rule_table[519].val;
+    goto done;
+n520:
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[520].val))
+        goto n522;
+    v = us_durz_cart.rule_table[521].val;
+    goto done;
+n522:
+    if (!f[15]) f[15] = val_inc_refcount(us_durz_f15(i,ff));
+    if (!val_less(f[15],us_durz_cart.rule_table[522].val))
+        goto n524;
+    v = us_durz_cart.rule_table[523].val;
+    goto done;
+n524:
+    v = us_durz_cart.rule_table[524].val;
+    goto done;
+n525:
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[525].val))
+        goto n527;
+    v = us_durz_cart.rule_table[526].val;
+    goto done;
+n527:
+    v = us_durz_cart.rule_table[527].val;
+    goto done;
+n528:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[528].val))
+        goto n530;
+    v = us_durz_cart.rule_table[529].val;
+    goto done;
+n530:
+    if (!f[15]) f[15] = val_inc_refcount(us_durz_f15(i,ff));
+    if (!val_less(f[15],us_durz_cart.rule_table[530].val))
+        goto n532;
+    v = us_durz_cart.rule_table[531].val;
+    goto done;
+n532:
+    v = us_durz_cart.rule_table[532].val;
+    goto done;
+n533:
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[533].val))
+        goto n625;
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[534].val))
+        goto n586;
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[535].val))
+        goto n563;
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[536].val))
+        goto n556;
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[537].val))
+        goto n539;
+    v = us_durz_cart.rule_table[538].val;
+    goto done;
+n539:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[539].val))
+        goto n545;
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[540].val))
+        goto n542;
+    v = us_durz_cart.rule_table[541].val;
+    goto done;
+n542:
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[542].val))
+        goto n544;
+    v = us_durz_cart.rule_table[543].val;
+    goto done;
+n544:
+    v = us_durz_cart.rule_table[544].val;
+    goto done;
+n545:
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[545].val))
+        goto n553;
+    if (!f[13]) f[13] = val_inc_refcount(us_durz_f13(i,ff));
+    if (!val_equal(f[13],us_durz_cart.rule_table[546].val))
+        goto n548;
+    v = us_durz_cart.rule_table[547].val;
+    goto done;
+n548:
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[548].val))
+        goto n550;
+    v = us_durz_cart.rule_table[549].val;
+    goto done;
+n550:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[550].val))
+        goto n552;
+    v = us_durz_cart.rule_table[551].val;
+    goto done;
+n552:
+    v = us_durz_cart.rule_table[552].val;
+    goto done;
+n553:
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[553].val))
+        goto n555;
+    v = us_durz_cart.rule_table[554].val;
+    goto done;
+n555:
+    v = us_durz_cart.rule_table[555].val;
+    goto done;
+n556:
+    if (!f[28]) f[28] = val_inc_refcount(us_durz_f28(i,ff));
+    if (!val_equal(f[28],us_durz_cart.rule_table[556].val))
+        goto n558;
+    v = us_durz_cart.rule_table[557].val;
+    goto done;
+n558:
+    if (!f[10]) f[10] = val_inc_refcount(us_durz_f10(i,ff));
+    if (!val_less(f[10],us_durz_cart.rule_table[558].val))
+        goto n560;
+    v = us_durz_cart.rule_table[559].val;
+    goto done;
+n560:
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[560].val))
+        goto n562;
+    v = us_durz_cart.rule_table[561].val;
+    goto done;
+n562:
+    v = us_durz_cart.rule_table[562].val;
+    goto done;
+n563:
+    if (!f[28]) f[28] = val_inc_refcount(us_durz_f28(i,ff));
+    if (!val_equal(f[28],us_durz_cart.rule_table[563].val))
+        goto n567;
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[564].val))
+        goto n566;
+    v = us_durz_cart.rule_table[565].val;
+    goto done;
+n566:
+    v = us_durz_cart.rule_table[566].val;
+    goto done;
+n567:
+    if (!f[13]) f[13] = val_inc_refcount(us_durz_f13(i,ff));
+    if (!val_equal(f[13],us_durz_cart.rule_table[567].val))
+        goto n583;
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[568].val))
+        goto n572;
+    if (!f[24]) f[24] = val_inc_refcount(us_durz_f24(i,ff));
+    if (!val_less(f[24],us_durz_cart.rule_table[569].val))
+        goto n571;
+    v = us_durz_cart.rule_table[570].val;
+    goto done;
+n571:
+    v = us_durz_cart.rule_table[571].val;
+    goto done;
+n572:
+    if (!f[25]) f[25] = val_inc_refcount(us_durz_f25(i,ff));
+    if (!val_equal(f[25],us_durz_cart.rule_table[572].val))
+        goto n580;
+    if (!f[24]) f[24] = val_inc_refcount(us_durz_f24(i,ff));
+    if (!val_less(f[24],us_durz_cart.rule_table[573].val))
+        goto n577;
+    if (!f[28]) f[28] = val_inc_refcount(us_durz_f28(i,ff));
+    if (!val_equal(f[28],us_durz_cart.rule_table[574].val))
+        goto n576;
+    v = us_durz_cart.rule_table[575].val;
+    goto done;
+n576:
+    v = us_durz_cart.rule_table[576].val;
+    goto done;
+n577:
+    if (!f[27]) f[27] = val_inc_refcount(us_durz_f27(i,ff));
+    if (!val_equal(f[27],us_durz_cart.rule_table[577].val))
+        goto n579;
+    v = us_durz_cart.rule_table[578].val;
+    goto done;
+n579:
+    v = us_durz_cart.rule_table[579].val;
+    goto done;
+n580:
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[580].val))
+        goto n582;
+    v = us_durz_cart.rule_table[581].val;
+    goto done;
+n582:
+    v = us_durz_cart.rule_table[582].val;
+    goto done;
+n583:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[583].val))
+        goto n585;
+    v = us_durz_cart.rule_table[584].val;
+    goto done;
+n585:
+    v = us_durz_cart.rule_table[585].val;
+    goto done;
+n586:
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[586].val))
+        goto n594;
+    if (!f[11]) f[11] = val_inc_refcount(us_durz_f11(i,ff));
+    if (!val_equal(f[11],us_durz_cart.rule_table[587].val))
+        goto n589;
+    v = us_durz_cart.rule_table[588].val;
+    goto done;
+n589:
+    if (!f[6]) f[6] = val_inc_refcount(us_durz_f6(i,ff));
+    if (!val_less(f[6],us_durz_cart.rule_table[589].val))
+        goto n591;
+    v = us_durz_cart.rule_table[590].val;
+    goto done;
+n591:
+    if (!f[23]) f[23] = val_inc_refcount(us_durz_f23(i,ff));
+    if (!val_equal(f[23],us_durz_cart.rule_table[591].val))
+        goto n593;
+    v = us_durz_cart.rule_table[592].val;
+    goto done;
+n593:
+    v = us_durz_cart.rule_table[593].val;
+    goto done;
+n594:
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[594].val))
+        goto n596;
+    v = us_durz_cart.rule_table[595].val;
+    goto done;
+n596:
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[596].val))
+        goto n600;
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[597].val))
+        goto n599;
+    v = us_durz_cart.rule_table[598].val;
+    goto done;
+n599:
+    v = us_durz_cart.rule_table[599].val;
+    goto done;
+n600:
+    if (!f[11]) f[11] = val_inc_refcount(us_durz_f11(i,ff));
+    if (!val_equal(f[11],us_durz_cart.rule_table[600].val))
+        goto n614;
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[601].val))
+        goto n611;
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[602].val))
+        goto n604;
+    v = us_durz_cart.rule_table[603].val;
+    goto done;
+n604:
+    if (!f[26]) f[26] = val_inc_refcount(us_durz_f26(i,ff));
+    if (!val_equal(f[26],us_durz_cart.rule_table[604].val))
+        goto n610;
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[605].val))
+        goto n607;
+    v = us_durz_cart.rule_table[606].val;
+    goto done;
+n607:
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[607].val))
+        goto n609;
+    v = us_durz_cart.rule_table[608].val;
+    goto done;
+n609:
+    v = us_durz_cart.rule_table[609].val;
+    goto done;
+n610:
+    v = us_durz_cart.rule_table[610].val;
+    goto done;
+n611:
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[611].val))
+        goto n613;
+    v = us_durz_cart.rule_table[612].val;
+    goto done;
+n613:
+    v = us_durz_cart.rule_table[613].val;
+    goto done;
+n614:
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[614].val))
+        goto n616;
+    v = us_durz_cart.rule_table[615].val;
+    goto done;
+n616:
+    if (!f[11]) f[11] = val_inc_refcount(us_durz_f11(i,ff));
+    if (!val_equal(f[11],us_durz_cart.rule_table[616].val))
+        goto n620;
+    if (!f[10]) f[10] = val_inc_refcount(us_durz_f10(i,ff));
+    if (!val_less(f[10],us_durz_cart.rule_table[617].val))
+        goto n619;
+    v = us_durz_cart.rule_table[618].val;
+    goto done;
+n619:
+    v = us_durz_cart.rule_table[619].val;
+    goto done;
+n620:
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[620].val))
+        goto n624;
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[621].val))
+        goto n623;
+    v = us_durz_cart.rule_table[622].val;
+    goto done;
+n623:
+    v = us_durz_cart.rule_table[623].val;
+    goto done;
+n624:
+    v = us_durz_cart.rule_table[624].val;
+    goto done;
+n625:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[625].val))
+        goto n639;
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[626].val))
+        goto n628;
+    v = us_durz_cart.rule_table[627].val;
+    goto done;
+n628:
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[628].val))
+        goto n630;
+    v = us_durz_cart.rule_table[629].val;
+    goto done;
+n630:
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[630].val))
+        goto n632;
+    v = us_durz_cart.rule_table[631].val;
+    goto done;
+n632:
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[632].val))
+        goto n636;
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[633].val))
+        goto n635;
+    v = us_durz_cart.rule_table[634].val;
+    goto done;
+n635:
+    v = us_durz_cart.rule_table[635].val;
+    goto done;
+n636:
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[636].val))
+        goto n638;
+    v = us_durz_cart.rule_table[637].val;
+    goto done;
+n638:
+    v = us_durz_cart.rule_table[638].val;
+    goto done;
+n639:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[639].val))
+        goto n653;
+    if (!f[6]) f[6] = val_inc_refcount(us_durz_f6(i,ff));
+    if (!val_less(f[6],us_durz_cart.rule_table[640].val))
+        goto n648;
+    if (!f[19]) f[19] = val_inc_refcount(us_durz_f19(i,ff));
+    if (!val_less(f[19],us_durz_cart.rule_table[641].val))
+        goto n645;
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[642].val))
+        goto n644;
+    v = us_durz_cart.rule_table[643].val;
+    goto done;
+n644:
+    v = us_durz_cart.rule_table[644].val;
+    goto done;
+n645:
+    if (!f[27]) f[27] = val_inc_refcount(us_durz_f27(i,ff));
+    if (!val_equal(f[27],us_durz_cart.rule_table[645].val))
+        goto n647;
+    v = us_durz_cart.rule_table[646].val;
+    goto done;
+n647:
+    v = us_durz_cart.rule_table[647].val;
+    goto done;
+n648:
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[648].val))
+        goto n652;
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[649].val))
+        goto n651;
+    v = us_durz_cart.rule_table[650].val;
+    goto done;
+n651:
+    v = us_durz_cart.rule_table[651].val;
+    goto done;
+n652:
+    v = us_durz_cart.rule_table[652].val;
+    goto done;
+n653:
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[653].val))
+        goto n657;
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[654].val))
+        goto n656;
+    v = us_durz_cart.rule_table[655].val;
+    goto done;
+n656:
+    v = us_durz_cart.rule_table[656].val;
+    goto done;
+n657:
+    if (!f[6]) f[6] = val_inc_refcount(us_durz_f6(i,ff));
+    if (!val_less(f[6],us_durz_cart.rule_table[657].val))
+        goto n667;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[658].val))
+        goto n660;
+    v = us_durz_cart.rule_table[659].val;
+    goto done;
+n660:
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[660].val))
+        goto n664;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[661].val))
+        goto n663;
+    v = us_durz_cart.rule_table[662].val;
+    goto done;
+n663:
+    v = us_durz_cart.rule_table[663].val;
+    goto done;
+n664:
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[664].val))
+        goto n666;
+    v = us_durz_cart.rule_table[665].val;
+    goto done;
+n666:
+    v = us_durz_cart.rule_table[666].val;
+    goto done;
+n667:
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[667].val))
+        goto n671;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[668].val))
+        goto n670;
+    v = us_durz_cart.rule_table[669].val;
+    goto done;
+n670:
+    v = us_durz_cart.rule_table[670].val;
+    goto done;
+n671:
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[671].val))
+        goto n673;
+    v = us_durz_cart.rule_table[672].val;
+    goto done;
+n673:
+    v = us_durz_cart.rule_table[673].val;
+    goto done;
+n674:
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[674].val))
+        goto n744;
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[675].val))
+        goto n725;
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[676].val))
+        goto n682;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[677].val))
+        goto n681;
+    if (!f[28]) f[28] = val_inc_refcount(us_durz_f28(i,ff));
+    if (!val_equal(f[28],us_durz_cart.rule_table[678].val))
+        goto n680;
+    v = us_durz_cart.rule_table[679].val;
+    goto done;
+n680:
+    v = us_durz_cart.rule_table[680].val;
+    goto done;
+n681:
+    v = us_durz_cart.rule_table[681].val;
+    goto done;
+n682:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[682].val))
+        goto n692;
+    if (!f[18]) f[18] = val_inc_refcount(us_durz_f18(i,ff));
+    if (!val_equal(f[18],us_durz_cart.rule_table[683].val))
+        goto n685;
+    v = us_durz_cart.rule_table[684].val;
+    goto done;
+n685:
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[685].val))
+        goto n687;
+    v = us_durz_cart.rule_table[686].val;
+    goto done;
+n687:
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[687].val))
+        goto n689;
+    v = us_durz_cart.rule_table[688].val;
+    goto done;
+n689:
+    if (!f[10]) f[10] = val_inc_refcount(us_durz_f10(i,ff));
+    if (!val_less(f[10],us_durz_cart.rule_table[689].val))
+        goto n691;
+    v = us_durz_cart.rule_table[690].val;
+    goto done;
+n691:
+    v = us_durz_cart.rule_table[691].val;
+    goto done;
+n692:
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[692].val))
+        goto n696;
+    if (!f[15]) f[15] = val_inc_refcount(us_durz_f15(i,ff));
+    if (!val_less(f[15],us_durz_cart.rule_table[693].val))
+        goto n695;
+    v = us_durz_cart.rule_table[694].val;
+    goto done;
+n695:
+    v = us_durz_cart.rule_table[695].val;
+    goto done;
+n696:
+    if (!f[13]) f[13] = val_inc_refcount(us_durz_f13(i,ff));
+    if (!val_equal(f[13],us_durz_cart.rule_table[696].val))
+        goto n704;
+    if (!f[27]) f[27] = val_inc_refcount(us_durz_f27(i,ff));
+    if (!val_equal(f[27],us_durz_cart.rule_table[697].val))
+        goto n699;
+    v = us_durz_cart.rule_table[698].val;
+    goto done;
+n699:
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[699].val))
+        goto n701;
+    v = us_durz_cart.rule_table[700].val;
+    goto done;
+n701:
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[701].val))
+        goto n703;
+    v = us_durz_cart.rule_table[702].val;
+    goto done;
+n703:
+    v = us_durz_cart.rule_table[703].val;
+    goto done;
+n704:
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[704].val))
+        goto n706;
+    v = us_durz_cart.rule_table[705].val;
+    goto done;
+n706:
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[706].val))
+        goto n718;
+    if (!f[18]) f[18] = val_inc_refcount(us_durz_f18(i,ff));
+    if (!val_equal(f[18],us_durz_cart.rule_table[707].val))
+        goto n709;
+    v = us_durz_cart.rule_table[708].val;
+    goto done;
+n709:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[709].val))
+        goto n711;
+    v = us_durz_cart.rule_table[710].val;
+    goto done;
+n711:
+    if (!f[10]) f[10] = val_inc_refcount(us_durz_f10(i,ff));
+    if (!val_less(f[10],us_durz_cart.rule_table[711].val))
+        goto n717;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[712].val))
+        goto n716;
+    if (!f[15]) f[15] = val_inc_refcount(us_durz_f15(i,ff));
+    if (!val_less(f[15],us_durz_cart.rule_table[713].val))
+        goto n715;
+    v = us_durz_cart.rule_table[714].val;
+    goto done;
+n715:
+    v = us_durz_cart.rule_table[715].val;
+    goto done;
+n716:
+    v = us_durz_cart.rule_table[716].val;
+    goto done;
+n717:
+    v = us_durz_cart.rule_table[717].val;
+    goto done;
+n718:
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[718].val))
+        goto n722;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[719].val))
+        goto n721;
+    v = us_durz_cart.rule_table[720].val;
+    goto done;
+n721:
+    v = us_durz_cart.rule_table[721].val;
+    goto done;
+n722:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[722].val))
+        goto n724;
+    v = us_durz_cart.rule_table[723].val;
+    goto done;
+n724:
+    v = us_durz_cart.rule_table[724].val;
+    goto done;
+n725:
+    if (!f[28]) f[28] = val_inc_refcount(us_durz_f28(i,ff));
+    if (!val_equal(f[28],us_durz_cart.rule_table[725].val))
+        goto n741;
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[726].val))
+        goto n728;
+    v = us_durz_cart.rule_table[727].val;
+    goto done;
+n728:
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[728].val))
+        goto n730;
+    v = us_durz_cart.rule_table[729].val;
+    goto done;
+n730:
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[730].val))
+        goto n740;
+    if (!f[18]) f[18] = val_inc_refcount(us_durz_f18(i,ff));
+    if (!val_equal(f[18],us_durz_cart.rule_table[731].val))
+        goto n739;
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[732].val))
+        goto n738;
+    if (!f[25]) f[25] = val_inc_refcount(us_durz_f25(i,ff));
+    if (!val_equal(f[25],us_durz_cart.rule_table[733].val))
+        goto n737;
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[734].val))
+        goto n736;
+    v = us_durz_cart.rule_table[735].val;
+    goto done;
+n736:
+    v = us_durz_cart.rule_table[736].val;
+    goto done;
+n737:
+    v = us_durz_cart.rule_table[737].val;
+    goto done;
+n738:
+    v = us_durz_cart.rule_table[738].val;
+    goto done;
+n739:
+    v = us_durz_cart.rule_table[739].val;
+    goto done;
+n740:
+    v = us_durz_cart.rule_table[740].val;
+    goto done;
+n741:
+    if (!f[28]) f[28] = val_inc_refcount(us_durz_f28(i,ff));
+    if (!val_equal(f[28],us_durz_cart.rule_table[741].val))
+        goto n743;
+    v = us_durz_cart.rule_table[742].val;
+    goto done;
+n743:
+    v = us_durz_cart.rule_table[743].val;
+    goto done;
+n744:
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[744].val))
+        goto n768;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[745].val))
+        goto n749;
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[746].val))
+        goto n748;
+    v = us_durz_cart.rule_table[747].val;
+    goto done;
+n748:
+    v = us_durz_cart.rule_table[748].val;
+    goto done;
+n749:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[749].val))
+        goto n751;
+    v = us_durz_cart.rule_table[750].val;
+    goto done;
+n751:
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[751].val))
+        goto n761;
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[752].val))
+        goto n754;
+    v = us_durz_cart.rule_table[753].val;
+    goto done;
+n754:
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[754].val))
+        goto n756;
+    v = us_durz_cart.rule_table[755].val;
+    goto done;
+n756:
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[756].val))
+        goto n760;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[757].val))
+        goto n759;
+    v = us_durz_cart.rule_table[758].val;
+    goto done;
+n759:
+    v = us_durz_cart.rule_table[759].val;
+    goto done;
+n760:
+    v = us_durz_cart.rule_table[760].val;
+    goto done;
+n761:
+    if (!f[11]) f[11] = val_inc_refcount(us_durz_f11(i,ff));
+    if (!val_equal(f[11],us_durz_cart.rule_table[761].val))
+        goto n763;
+    v = us_durz_cart.rule_table[762].val;
+    goto done;
+n763:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[763].val))
+        goto n765;
+    v = us_durz_cart.rule_table[764].val;
+    goto done;
+n765:
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[765].val))
+        goto n767;
+    v = us_durz_cart.rule_table[766].val;
+    goto done;
+n767:
+    v = us_durz_cart.rule_table[767].val;
+    goto done;
+n768:
+    if (!f[6]) f[6] = val_inc_refcount(us_durz_f6(i,ff));
+    if (!val_less(f[6],us_durz_cart.rule_table[768].val))
+        goto n778;
+    if (!f[19]) f[19] = val_inc_refcount(us_durz_f19(i,ff));
+    if (!val_less(f[19],us_durz_cart.rule_table[769].val))
+        goto n773;
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[770].val))
+        goto n772;
+    v = us_durz_cart.rule_table[771].val;
+    goto done;
+n772:
+    v = us_durz_cart.rule_table[772].val;
+    goto done;
+n773:
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[773].val))
+        goto n777;
+    if (!f[18]) f[18] = val_inc_refcount(us_durz_f18(i,ff));
+    if (!val_equal(f[18],us_durz_cart.rule_table[774].val))
+        goto n776;
+    v = us_durz_cart.rule_table[775].val;
+    goto done;
+n776:
+    v = us_durz_cart.rule_table[776].val;
+    goto done;
+n777:
+    v = us_durz_cart.rule_table[777].val;
+    goto done;
+n778:
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[778].val))
+        goto n874;
+    if (!f[13]) f[13] = val_inc_refcount(us_durz_f13(i,ff));
+    if (!val_equal(f[13],us_durz_cart.rule_table[779].val))
+        goto n869;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[780].val))
+        goto n786;
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[781].val))
+        goto n783;
+    v = us_durz_cart.rule_table[782].val;
+    goto done;
+n783:
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[783].val))
+        goto n785;
+    v = us_durz_cart.rule_table[784].val;
+    goto done;
+n785:
+    v = us_durz_cart.rule_table[785].val;
+    goto done;
+n786:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[786].val))
+        goto n790;
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[787].val))
+        goto n789;
+    v = us_durz_cart.rule_table[788].val;
+    goto done;
+n789:
+    v = us_durz_cart.rule_table[789].val;
+    goto done;
+n790:
+    if (!f[28]) f[28] = val_inc_refcount(us_durz_f28(i,ff));
+    if (!val_equal(f[28],us_durz_cart.rule_table[790].val))
+        goto n800;
+    if (!f[11]) f[11] = val_inc_refcount(us_durz_f11(i,ff));
+    if (!val_equal(f[11],us_durz_cart.rule_table[791].val))
+        goto n793;
+    v = us_durz_cart.rule_table[792].val;
+    goto done;
+n793:
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[793].val))
+        goto n795;
+    v = us_durz_cart.rule_table[794].val;
+    goto done;
+n795:
+    if (!f[21]) f[21] = val_inc_refcount(us_durz_f21(i,ff));
+    if (!val_equal(f[21],us_durz_cart.rule_table[795].val))
+        goto n799;
+    if (!f[24]) f[24] = val_inc_refcount(us_durz_f24(i,ff));
+    if (!val_less(f[24],us_durz_cart.rule_table[796].val))
+        goto n798;
+    v = us_durz_cart.rule_table[797].val;
+    goto done;
+n798:
+    v = us_durz_cart.rule_table[798].val;
+    goto done;
+n799:
+    v = us_durz_cart.rule_table[799].val;
+    goto done;
+n800:
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[800].val))
+        goto n810;
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[801].val))
+        goto n807;
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[802].val))
+        goto n804;
+    v = us_durz_cart.rule_table[803].val;
+    goto done;
+n804:
+    if (!f[26]) f[26] = val_inc_refcount(us_durz_f26(i,ff));
+    if (!val_equal(f[26],us_durz_cart.rule_table[804].val))
+        goto n806;
+    v = us_durz_cart.rule_table[805].val;
+    goto done;
+n806:
+    v = us_durz_cart.rule_table[806].val;
+    goto done;
+n807:
+    if (!f[19]) f[19] = val_inc_refcount(us_durz_f19(i,ff));
+    if (!val_less(f[19],us_durz_cart.rule_table[807].val))
+        goto n809;
+    v = us_durz_cart.rule_table[808].val;
+    goto done;
+n809:
+    v = us_durz_cart.rule_table[809].val;
+    goto done;
+n810:
+    if (!f[27]) f[27] = val_inc_refcount(us_durz_f27(i,ff));
+    if (!val_equal(f[27],us_durz_cart.rule_table[810].val))
+        goto n820;
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[811].val))
+        goto n813;
+    v = us_durz_cart.rule_table[812].val;
+    goto done;
+n813:
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[813].val))
+        goto n819;
+    if (!f[11]) f[11] = val_inc_refcount(us_durz_f11(i,ff));
+    if (!val_equal(f[11],us_durz_cart.rule_table[814].val))
+        goto n818;
+    if (!f[16]) f[16] = val_inc_refcount(us_durz_f16(i,ff));
+    if (!val_less(f[16],us_durz_cart.rule_table[815].val))
+        goto n817;
+    v = us_durz_cart.rule_table[816].val;
+    goto done;
+n817:
+    v = us_durz_cart.rule_table[817].val;
+    goto done;
+n818:
+    v = us_durz_cart.rule_table[818].val;
+    goto done;
+n819:
+    v = us_durz_cart.rule_table[819].val;
+    goto done;
+n820:
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[820].val))
+        goto n824;
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[821].val))
+        goto n823;
+    v = us_durz_cart.rule_table[822].val;
+    goto done;
+n823:
+    v = us_durz_cart.rule_table[823].val;
+    goto done;
+n824:
+    if (!f[7]) f[7] = val_inc_refcount(us_durz_f7(i,ff));
+    if (!val_equal(f[7],us_durz_cart.rule_table[824].val))
+        goto n828;
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[825].val))
+        goto n827;
+    v = us_durz_cart.rule_table[826].val;
+    goto done;
+n827:
+    v = us_durz_cart.rule_table[827].val;
+    goto done;
+n828:
+    if (!f[11]) f[11] = val_inc_refcount(us_durz_f11(i,ff));
+    if (!val_equal(f[11],us_durz_cart.rule_table[828].val))
+        goto n858;
+    if (!f[19]) f[19] = val_inc_refcount(us_durz_f19(i,ff));
+    if (!val_less(f[19],us_durz_cart.rule_table[829].val))
+        goto n849;
+    if (!f[20]) f[20] = val_inc_refcount(us_durz_f20(i,ff));
+    if (!val_equal(f[20],us_durz_cart.rule_table[830].val))
+        goto n844;
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[831].val))
+        goto n841;
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[832].val))
+        goto n834;
+    v = us_durz_cart.rule_table[833].val;
+    goto done;
+n834:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[834].val))
+        goto n836;
+    v = us_durz_cart.rule_table[835].val;
+    goto done;
+n836:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[836].val))
+        goto n840;
+    if (!f[5]) f[5] = val_inc_refcount(us_durz_f5(i,ff));
+    if (!val_equal(f[5],us_durz_cart.rule_table[837].val))
+        goto n839;
+    v = us_durz_cart.rule_table[838].val;
+    goto done;
+n839:
+    v = us_durz_cart.rule_table[839].val;
+    goto done;
+n840:
+    v = us_durz_cart.rule_table[840].val;
+    goto done;
+n841:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[841].val))
+        goto n843;
+    v = us_durz_cart.rule_table[842].val;
+    goto done;
+n843:
+    v = us_durz_cart.rule_table[843].val;
+    goto done;
+n844:
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[844].val))
+        goto n846;
+    v = us_durz_cart.rule_table[845].val;
+    goto done;
+n846:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[846].val))
+        goto n848;
+    v = us_durz_cart.rule_table[847].val;
+    goto done;
+n848:
+    v = us_durz_cart.rule_table[848].val;
+    goto done;
+n849:
+    if (!f[18]) f[18] = val_inc_refcount(us_durz_f18(i,ff));
+    if (!val_equal(f[18],us_durz_cart.rule_table[849].val))
+        goto n851;
+    v = us_durz_cart.rule_table[850].val;
+    goto done;
+n851:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[851].val))
+        goto n853;
+    v = us_durz_cart.rule_table[852].val;
+    goto done;
+n853:
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[853].val))
+        goto n855;
+    v = us_durz_cart.rule_table[854].val;
+    goto done;
+n855:
+    if (!f[6]) f[6] = val_inc_refcount(us_durz_f6(i,ff));
+    if (!val_less(f[6],us_durz_cart.rule_table[855].val))
+        goto n857;
+    v = us_durz_cart.rule_table[856].val;
+    goto done;
+n857:
+    v = us_durz_cart.rule_table[857].val;
+    goto done;
+n858:
+    if (!f[17]) f[17] = val_inc_refcount(us_durz_f17(i,ff));
+    if (!val_less(f[17],us_durz_cart.rule_table[858].val))
+        goto n866;
+    if (!f[9]) f[9] = val_inc_refcount(us_durz_f9(i,ff));
+    if (!val_equal(f[9],us_durz_cart.rule_table[859].val))
+        goto n865;
+    if (!f[4]) f[4] = val_inc_refcount(us_durz_f4(i,ff));
+    if (!val_equal(f[4],us_durz_cart.rule_table[860].val))
+        goto n862;
+    v = us_durz_cart.rule_table[861].val;
+    goto done;
+n862:
+    if (!f[22]) f[22] = val_inc_refcount(us_durz_f22(i,ff));
+    if (!val_less(f[22],us_durz_cart.rule_table[862].val))
+        goto n864;
+    v = us_durz_cart.rule_table[863].val;
+    goto done;
+n864:
+    v = us_durz_cart.rule_table[864].val;
+    goto done;
+n865:
+    v = us_durz_cart.rule_table[865].val;
+    goto done;
+n866:
+    if (!f[20]) f[20] = val_inc_refcount(us_durz_f20(i,ff));
+    if (!val_equal(f[20],us_durz_cart.rule_table[866].val))
+        goto n868;
+    v = us_durz_cart.rule_table[867].val;
+    goto done;
+n868:
+    v = us_durz_cart.rule_table[868].val;
+    goto done;
+n869:
+    if (!f[8]) f[8] = val_inc_refcount(us_durz_f8(i,ff));
+    if (!val_equal(f[8],us_durz_cart.rule_table[869].val))
+        goto n871;
+    v = us_durz_cart.rule_table[870].val;
+    goto done;
+n871:
+    if (!f[19]) f[19] = val_inc_refcount(us_durz_f19(i,ff));
+    if (!val_less(f[19],us_durz_cart.rule_table[871].val))
+        goto n873;
+    v = us_durz_cart.rule_table[872].val;
+    goto done;
+n873:
+    v = us_durz_cart.rule_table[873].val;
+    goto done;
+n874:
+    v = us_durz_cart.rule_table[874].val;
+    goto done;
+done:
+    for (k=0; k<29; k++)
+        delete_val((cst_val *)(void *)f[k]);
+    return v;
+}
+
+const cst_cart_compiled us_durz_cart_compiled = {
+    &us_durz_cart,
+    29,
+    us_durz_ffunc_names,
+    us_durz_interpret
+};
+
+/* f0_lr_terms */
+
+static const int us_f0_lr_term_feats[] = {
+    -1, 0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4,
+    5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7, 8, 8, 8, 8,
+    9, 9, 9, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, };
+
+static const cst_val *us_f0_lr_f0(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* p.p.accent */
+    return ffeature_at(item_prev(item_prev(i)),
+                       "accent",ff[0]);
+}
+
+static const cst_val *us_f0_lr_f1(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* p.accent */
+    return ffeature_at(item_prev(i),
+                       "accent",ff[1]);
+}
+
+static const cst_val *us_f0_lr_f2(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* accent */
+    return ffeature_at(i,
+                       "accent",ff[2]);
+}
+
+static const cst_val *us_f0_lr_f3(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* n.accent */
+    return ffeature_at(item_next(i),
+                       "accent",ff[3]);
+}
+
+static const cst_val *us_f0_lr_f4(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* n.n.accent */
+    return ffeature_at(item_next(item_next(i)),
+                       "accent",ff[4]);
+}
+
+static const cst_val *us_f0_lr_f5(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* p.p.endtone */
+    return ffeature_at(item_prev(item_prev(i)),
+                       "endtone",ff[5]);
+}
+
+static const cst_val *us_f0_lr_f6(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* R:Syllable.p.endtone */
+    return ffeature_at(item_prev(item_as(i,"Syllable")),
+                       "endtone",ff[6]);
+}
+
+static const cst_val *us_f0_lr_f7(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* endtone */
+    return ffeature_at(i,
+                       "endtone",ff[7]);
+}
+
+static const cst_val *us_f0_lr_f8(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* n.endtone */
+    return ffeature_at(item_next(i),
+                       "endtone",ff[8]);
+}
+
+static const cst_val *us_f0_lr_f9(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* n.n.endtone */
+    return ffeature_at(item_next(item_next(i)),
+                       "endtone",ff[9]);
+}
+
+static const cst_val *us_f0_lr_f10(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* p.p.old_syl_break */
+    return ffeature_at(item_prev(item_prev(i)),
+                       "old_syl_break",ff[10]);
+}
+
+static const cst_val *us_f0_lr_f11(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* p.old_syl_break */
+    return ffeature_at(item_prev(i),
+                       "old_syl_break",ff[11]);
+}
+
+static const cst_val *us_f0_lr_f12(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* old_syl_break */
+    return ffeature_at(i,
+                       "old_syl_break",ff[12]);
+}
+
+static const cst_val *us_f0_lr_f13(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* n.old_syl_break */
+    return ffeature_at(item_next(i),
+                       "old_syl_break",ff[13]);
+}
+
+static const cst_val *us_f0_lr_f14(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* n.n.old_syl_break */
+    return ffeature_at(item_next(item_next(i)),
+                       "old_syl_break",ff[14]);
+}
+
+static const cst_val *us_f0_lr_f15(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* p.p.stress */
+    return ffeature_at(item_prev(item_prev(i)),
+                       "stress",ff[15]);
+}
+
+static const cst_val *us_f0_lr_f16(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* p.stress */
+    return ffeature_at(item_prev(i),
+                       "stress",ff[16]);
+}
+
+static const cst_val *us_f0_lr_f17(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* stress */
+    return ffeature_at(i,
+                       "stress",ff[17]);
+}
+
+static const cst_val *us_f0_lr_f18(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* n.stress */
+    return ffeature_at(item_next(i),
+                       "stress",ff[18]);
+}
+
+static const cst_val *us_f0_lr_f19(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* n.n.stress */
+    return ffeature_at(item_next(item_next(i)),
+                       "stress",ff[19]);
+}
+
+static const cst_val *us_f0_lr_f20(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* syl_in */
+    return ffeature_at(i,
+                       "syl_in",ff[20]);
+}
+
+static const cst_val *us_f0_lr_f21(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* syl_out */
+    return ffeature_at(i,
+                       "syl_out",ff[21]);
+}
+
+static const cst_val *us_f0_lr_f22(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* ssyl_in */
+    return ffeature_at(i,
+                       "ssyl_in",ff[22]);
+}
+
+static const cst_val *us_f0_lr_f23(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* ssyl_out */
+    return ffeature_at(i,
+                       "ssyl_out",ff[23]);
+}
+
+static const cst_val *us_f0_lr_f24(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* asyl_in */
+    return ffeature_at(i,
+                       "asyl_in",ff[24]);
+}
+
+static const cst_val *us_f0_lr_f25(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* asyl_out */
+    return ffeature_at(i,
+                       "asyl_out",ff[25]);
+}
+
+static const cst_val *us_f0_lr_f26(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* last_accent */
+    return ffeature_at(i,
+                       "last_accent",ff[26]);
+}
+
+static const cst_val *us_f0_lr_f27(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* next_accent */
+    return ffeature_at(i,
+                       "next_accent",ff[27]);
+}
+
+static const cst_val *us_f0_lr_f28(const cst_item *i,
+        const cst_ffunction *ff)
+{   /* sub_phrases */
+    return ffeature_at(i,
+                       "sub_phrases",ff[28]);
+}
+
+static const char * const us_f0_lr_ffunc_names[] = {
+    "accent",
+    "accent",
+    "accent",
+    "accent",
+    "accent",
+    "endtone",
+    "endtone",
+    "endtone",
+    "endtone",
+    "endtone",
+    "old_syl_break",
+    "old_syl_break",
+    "old_syl_break",
+    "old_syl_break",
+    "old_syl_break",
+    "stress",
+    "stress",
+    "stress",
+    "stress",
+    "stress",
+    "syl_in",
+    "syl_out",
+    "ssyl_in",
+    "ssyl_out",
+    "asyl_in",
+    "asyl_out",
+    "last_accent",
+    "next_accent",
+    "sub_phrases",
+    NULL };
+
+static void us_f0_lr_features(const cst_item *i,
+        const cst_ffunction *ff, const cst_val **fv)
+{
+    fv[0] = val_inc_refcount(us_f0_lr_f0(i,ff));
+    fv[1] = val_inc_refcount(us_f0_lr_f1(i,ff));
+    fv[2] = val_inc_refcount(us_f0_lr_f2(i,ff));
+    fv[3] = val_inc_refcount(us_f0_lr_f3(i,ff));
+    fv[4] = val_inc_refcount(us_f0_lr_f4(i,ff));
+    fv[5] = val_inc_refcount(us_f0_lr_f5(i,ff));
+    fv[6] = val_inc_refcount(us_f0_lr_f6(i,ff));
+    fv[7] = val_inc_refcount(us_f0_lr_f7(i,ff));
+    fv[8] = val_inc_refcount(us_f0_lr_f8(i,ff));
+    fv[9] = val_inc_refcount(us_f0_lr_f9(i,ff));
+    fv[10] = val_inc_refcount(us_f0_lr_f10(i,ff));
+    fv[11] = val_inc_refcount(us_f0_lr_f11(i,ff));
+    fv[12] = val_inc_refcount(us_f0_lr_f12(i,ff));
+    fv[13] = val_inc_refcount(us_f0_lr_f13(i,ff));
+    fv[14] = val_inc_refcount(us_f0_lr_f14(i,ff));
+    fv[15] = val_inc_refcount(us_f0_lr_f15(i,ff));
+    fv[16] = val_inc_refcount(us_f0_lr_f16(i,ff));
+    fv[17] = val_inc_refcount(us_f0_lr_f17(i,ff));
+    fv[18] = val_inc_refcount(us_f0_lr_f18(i,ff));
+    fv[19] = val_inc_refcount(us_f0_lr_f19(i,ff));
+    fv[20] = val_inc_refcount(us_f0_lr_f20(i,ff));
+    fv[21] = val_inc_refcount(us_f0_lr_f21(i,ff));
+    fv[22] = val_inc_refcount(us_f0_lr_f22(i,ff));
+    fv[23] = val_inc_refcount(us_f0_lr_f23(i,ff));
+    fv[24] = val_inc_refcount(us_f0_lr_f24(i,ff));
+    fv[25] = val_inc_refcount(us_f0_lr_f25(i,ff));
+    fv[26] = val_inc_refcount(us_f0_lr_f26(i,ff));
+    fv[27] = val_inc_refcount(us_f0_lr_f27(i,ff));
+    fv[28] = val_inc_refcount(us_f0_lr_f28(i,ff));
+}
+
+const us_f0_lr_compiled_model us_f0_lr_compiled = {
+    f0_lr_terms,
+    us_f0_lr_term_feats,
+    29,
+    us_f0_lr_ffunc_names,
+    us_f0_lr_features
+};
+
@@ -53,7 +53,7 @@ void usenglish_init(cst_voice *v)
     feat_set(v->features,"utt_break",breakfunc_val(&default_utt_break));
 
     /* Phoneset */
-    feat_set(v->features,"phoneset",phoneset_val(&us_phoneset));
+    phoneset_set(v->features,&us_phoneset);
     feat_set_string(v->features,"silence",us_phoneset.silence);
 
     /* Text analyser */
@@ -75,9 +75,15 @@ void usenglish_init(cst_voice *v)
     /* Intonation */
     feat_set(v->features,"int_cart_accents",cart_val(&us_int_accent_cart));
     feat_set(v->features,"int_cart_tones",cart_val(&us_int_tone_cart));
+    feat_set(v->features,"int_cart_accents_compiled",
+             cart_compiled_val(&us_int_accent_cart_compiled));
+    feat_set(v->features,"int_cart_tones_compiled",
+             cart_compiled_val(&us_int_tone_cart_compiled));
 
     /* Duration */
     feat_set(v->features,"dur_cart",cart_val(&us_durz_cart));
+    feat_set(v->features,"dur_cart_compiled",
+             cart_compiled_val(&us_durz_cart_compiled));
     feat_set(v->features,"dur_stats",dur_stats_val((dur_stats *)us_dur_stats));
 
     /* f0 model */
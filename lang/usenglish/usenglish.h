@@ -63,6 +63,11 @@ extern const cst_cart us_durz_cart;
 extern const cst_cart us_pos_cart;
 extern const dur_stat * const us_dur_stats[];
 
+/* The intonation and duration carts compiled by tools/compile_prosody */
+extern const cst_cart_compiled us_int_accent_cart_compiled;
+extern const cst_cart_compiled us_int_tone_cart_compiled;
+extern const cst_cart_compiled us_durz_cart_compiled;
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif /* __cplusplus */
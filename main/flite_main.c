@@ -105,8 +105,9 @@ static void flite_usage()
 	   "  -ps         Print segments\n"
            "  -psdur      Print segments and their durations (end-time)\n"
 	   "  -pr RelName Print relation RelName\n"
-           "  -voicedump FILENAME Dump selected (cg) voice to FILENAME\n"
-           "  -v          Verbose mode\n");
+           "  -voicedump FILENAME Dump selected (cg or clunit) voice to FILENAME\n"
+           "  -joindump FILENAME Dump most used (clunit) joins to FILENAME\n"
+           "  -v          Verbose mode, with time spent in each module\n");
     exit(0);
 }
 
@@ -207,6 +208,8 @@ int main(int argc, char **argv)
     int i;
     float durs;
     double time_start, time_end;
+    cst_synth_stats synth_stats;
+    cst_alloc_counts alloc_stats;
     int flite_verbose, flite_loop, ipa_only, flite_bench;
     int explicit_filename, explicit_text, explicit_phones, ssml_mode;
 #define ITER_MAX 3
@@ -214,7 +217,9 @@ int main(int argc, char **argv)
     cst_features *extra_feats;
     const char *lex_addenda_file = NULL;
     const char *voicedumpfile = NULL;
+    const char *joindumpfile = NULL;
     cst_audio_streaming_info *asi;
+    cst_audio_player *player = NULL;
     FILE *fd;
     long length;
 
@@ -243,7 +248,10 @@ int main(int argc, char **argv)
 		 cst_streq(argv[i],"-?"))
 	    flite_usage();
 	else if (cst_streq(argv[i],"-v"))
+        {
 	    flite_verbose = TRUE;
+            cst_synth_stats_enable(TRUE);
+        }
 	else if (cst_streq(argv[i],"-lv"))
         {
             if (flite_voice_list == NULL)
@@ -332,6 +340,11 @@ int main(int argc, char **argv)
             voicedumpfile = argv[i+1];
 	    i++;
 	}
+	else if (cst_streq(argv[i],"-joindump") && (i+1 < argc))
+	{
+            joindumpfile = argv[i+1];
+	    i++;
+	}
 	else if ((cst_streq(argv[i],"-set") || cst_streq(argv[i],"-s"))
 		 && (i+1 < argc))
 	{
@@ -390,10 +403,17 @@ int main(int argc, char **argv)
     if (lex_addenda_file)
         flite_voice_add_lex_addenda(v,lex_addenda_file);
 
+    /* Learning joins needs a cache big enough to see them all */
+    if (joindumpfile && !feat_present(v->features,"clunit_join_cache_size"))
+        feat_set_int(v->features,"clunit_join_cache_size",1000000);
+
     if (cst_streq("stream",outtype))
     {
+        /* Chunks are played while the rest is synthesized */
         asi = new_audio_streaming_info();
-        asi->asc = audio_stream_chunk;
+        player = new_audio_player(0);
+        asi->asc = audio_player_stream_chunk;
+        asi->userdata = player;
         feat_set(v->features,"streaming_info",audio_streaming_info_val(asi));
     }
 
@@ -412,6 +432,7 @@ loop:
     if (explicit_phones) {
         /* filename is actually input phones and not filename */
 	    durs = flite_phones_to_speech(filename,v,outtype);
+        delete_audio_player(player);
         return 0;
     }
     else if ((strchr(filename,' ') && !explicit_filename) || explicit_text || access(filename, F_OK) != 0)
@@ -464,10 +485,32 @@ loop:
 	       durs/(float)(time_end-time_start),
 	       durs,
 	       (float)(time_end-time_start));
+    if (flite_verbose)
+    {
+        cst_synth_stats_totals(&synth_stats);
+        cst_synth_stats_print(stdout,&synth_stats);
+        cst_synth_stats_reset();
+        cst_alloc_stats(&alloc_stats);
+        if (alloc_stats.calls > 0)  /* with CST_ALLOC_STATS set */
+        {
+            printf("allocations: %ld calls %ld frees %.0f bytes, "
+                   "%.0f in use, high water %.0f\n",
+                   alloc_stats.calls,alloc_stats.frees,alloc_stats.bytes,
+                   alloc_stats.in_use,alloc_stats.high_water);
+            printf("  by size (16 32 64 ...):");
+            for (i=0; i<CST_ALLOC_SIZE_CLASSES; i++)
+                printf(" %ld",alloc_stats.size_classes[i]);
+            printf("\n");
+        }
+    }
 
     if (flite_loop || (flite_bench && bench_iter++ < ITER_MAX))
 	    goto loop;
 
+    if (joindumpfile)
+        flite_voice_dump_joins(v,joindumpfile);
+
+    delete_audio_player(player);
     delete_features(extra_feats);
     delete_val(flite_voice_list); flite_voice_list=0;
     /*    cst_alloc_debug_summary(); */
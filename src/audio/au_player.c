@@ -0,0 +1,352 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Asynchronous playback: waves are copied into a ring buffer and a     */
+/*  thread of its own writes them to the audio device, so synthesis of   */
+/*  the next utterance can go on while this one is played                */
+/*                                                                       */
+/*************************************************************************/
+
+#include "cst_string.h"
+#include "cst_wave.h"
+#include "cst_audio.h"
+#include "cst_thread.h"
+
+#define PLAYER_DEFAULT_SIZE (64*1024)  /* samples, 4 seconds at 16KHz */
+#define PLAYER_CHUNK 1024              /* samples per device write */
+
+struct cst_audio_player_struct {
+    cst_mutex *lock;
+    cst_cond *more;          /* samples queued, or something asked for */
+    cst_cond *space;         /* samples taken, or something done */
+    cst_thread *thread;      /* NULL if there are no threads */
+
+    short *ring;
+    int size, start, count;
+    int sample_rate, num_channels;  /* of what is in the ring */
+
+    short *chunk;            /* what the thread is writing */
+    int busy;                /* thread is writing a chunk */
+    cst_audiodev *ad;        /* only touched by the thread */
+    int bad_rate, bad_channels;  /* format the device wouldn't open with */
+
+    int flush_wanted, flush_done;  /* requests and replies */
+    int drain_wanted;
+    int stopped;
+    int quit;
+};
+
+static cst_audiodev *player_device(cst_audio_player *p,
+                                   int sample_rate, int num_channels)
+{
+    /* The device, reopened if the wave format has changed, but not */
+    /* tried again (or complained about) for a format it failed with */
+    cst_audiodev *ad = p->ad;
+
+    if (ad && (ad->sps == sample_rate) && (ad->channels == num_channels))
+        return ad;
+    if (ad)
+    {
+        audio_flush(ad);
+        audio_close(ad);
+    }
+    if ((sample_rate == p->bad_rate) && (num_channels == p->bad_channels))
+        return NULL;
+    ad = audio_open(sample_rate,num_channels,CST_AUDIO_LINEAR16);
+    if (ad == NULL)
+    {
+        cst_errmsg("audio_player: can't open audio device\n");
+        p->bad_rate = sample_rate;
+        p->bad_channels = num_channels;
+    }
+    return ad;
+}
+
+static void *player_thread(void *arg)
+{
+    cst_audio_player *p = (cst_audio_player *)arg;
+    int n, m, sample_rate, num_channels;
+
+    cst_mutex_lock(p->lock);
+    while (1)
+    {
+        while ((p->count == 0) && !p->drain_wanted && !p->quit &&
+               (p->flush_done == p->flush_wanted))
+            cst_cond_wait(p->more,p->lock);
+
+        if (p->drain_wanted)
+        {   /* whatever the device still has is dropped too */
+            p->drain_wanted = FALSE;
+            cst_mutex_unlock(p->lock);
+            if (p->ad)
+                audio_drain(p->ad);
+            cst_mutex_lock(p->lock);
+            cst_cond_broadcast(p->space);
+        }
+        else if (p->count > 0)
+        {   /* Copy out a chunk, so the ring has room while it is played */
+            n = p->count;
+            if (n > PLAYER_CHUNK) n = PLAYER_CHUNK;
+            m = p->size - p->start;
+            if (m > n) m = n;
+            memmove(p->chunk,p->ring+p->start,m*sizeof(short));
+            memmove(p->chunk+m,p->ring,(n-m)*sizeof(short));
+            p->start = (p->start + n) % p->size;
+            p->count -= n;
+            sample_rate = p->sample_rate;
+            num_channels = p->num_channels;
+            p->busy = TRUE;
+            cst_cond_broadcast(p->space);
+            cst_mutex_unlock(p->lock);
+
+            p->ad = player_device(p,sample_rate,num_channels);
+            if (p->ad && (audio_write(p->ad,p->chunk,n*sizeof(short)) <= 0))
+                cst_errmsg("audio_player: failed to write %d samples\n",n);
+
+            cst_mutex_lock(p->lock);
+            p->busy = FALSE;
+            cst_cond_broadcast(p->space);
+        }
+        else if (p->flush_done != p->flush_wanted)
+        {
+            n = p->flush_wanted;
+            cst_mutex_unlock(p->lock);
+            if (p->ad)
+                audio_flush(p->ad);
+            cst_mutex_lock(p->lock);
+            p->flush_done = n;
+            cst_cond_broadcast(p->space);
+        }
+        else /* quit, with nothing left to do */
+            break;
+    }
+    cst_mutex_unlock(p->lock);
+
+    if (p->ad)
+    {
+        audio_flush(p->ad);
+        audio_close(p->ad);
+        p->ad = NULL;
+    }
+    return NULL;
+}
+
+cst_audio_player *new_audio_player(int size)
+{
+    cst_audio_player *p = cst_alloc(cst_audio_player,1);
+
+    p->size = (size > PLAYER_CHUNK) ? size : PLAYER_DEFAULT_SIZE;
+    p->ring = cst_alloc(short,p->size);
+    p->chunk = cst_alloc(short,PLAYER_CHUNK);
+    p->lock = new_mutex();
+    p->more = new_cond();
+    p->space = new_cond();
+    /* Without threads everything is played as it is written */
+    p->thread = cst_thread_create(player_thread,p);
+
+    return p;
+}
+
+void delete_audio_player(cst_audio_player *p)
+{
+    if (p == NULL)
+        return;
+    if (p->thread)
+    {   /* what is still queued is played first, unless stopped */
+        cst_mutex_lock(p->lock);
+        p->quit = TRUE;
+        cst_cond_signal(p->more);
+        cst_mutex_unlock(p->lock);
+        cst_thread_join(p->thread);
+    }
+    else if (p->ad)
+    {
+        audio_flush(p->ad);
+        audio_close(p->ad);
+    }
+    delete_cond(p->space);
+    delete_cond(p->more);
+    delete_mutex(p->lock);
+    cst_free(p->chunk);
+    cst_free(p->ring);
+    cst_free(p);
+}
+
+static int player_write_direct(cst_audio_player *p, const cst_wave *w,
+                               int start, int size)
+{
+    int i, n, num_shorts;
+
+    p->ad = player_device(p,w->sample_rate,w->num_channels);
+    if (p->ad == NULL)
+        return CST_AUDIO_STREAM_CONT;
+    num_shorts = size*w->num_channels;
+    for (i=0; i < num_shorts; i += n)
+    {
+        n = num_shorts - i;
+        if (n > PLAYER_CHUNK) n = PLAYER_CHUNK;
+        /* audio_write() may swap bytes in place so it gets a copy */
+        memmove(p->chunk,&w->samples[start*w->num_channels+i],
+                n*sizeof(short));
+        if (audio_write(p->ad,p->chunk,n*sizeof(short)) <= 0)
+        {
+            cst_errmsg("audio_player: failed to write %d samples\n",n);
+            break;
+        }
+    }
+    return CST_AUDIO_STREAM_CONT;
+}
+
+int audio_player_write(cst_audio_player *p, const cst_wave *w,
+                       int start, int size)
+{
+    /* Queues size samples of w from start, waiting only while the */
+    /* ring is full                                                 */
+    const short *samples;
+    int num_shorts, n, m, end;
+
+    if (!p->thread)
+        return p->stopped ? CST_AUDIO_STREAM_STOP :
+            player_write_direct(p,w,start,size);
+
+    samples = &w->samples[start*w->num_channels];
+    num_shorts = size*w->num_channels;
+
+    cst_mutex_lock(p->lock);
+    if ((w->sample_rate != p->sample_rate) ||
+        (w->num_channels != p->num_channels))
+    {   /* the ring only holds one format at a time */
+        while (!p->stopped && ((p->count > 0) || p->busy))
+            cst_cond_wait(p->space,p->lock);
+        p->sample_rate = w->sample_rate;
+        p->num_channels = w->num_channels;
+    }
+    while (!p->stopped && (num_shorts > 0))
+    {
+        while (!p->stopped && (p->count == p->size))
+            cst_cond_wait(p->space,p->lock);
+        if (p->stopped)
+            break;
+        n = p->size - p->count;
+        if (n > num_shorts) n = num_shorts;
+        end = (p->start + p->count) % p->size;
+        m = p->size - end;
+        if (m > n) m = n;
+        memmove(p->ring+end,samples,m*sizeof(short));
+        memmove(p->ring,samples+m,(n-m)*sizeof(short));
+        p->count += n;
+        samples += n;
+        num_shorts -= n;
+        cst_cond_signal(p->more);
+    }
+    n = p->stopped;
+    cst_mutex_unlock(p->lock);
+
+    return n ? CST_AUDIO_STREAM_STOP : CST_AUDIO_STREAM_CONT;
+}
+
+int audio_player_play(cst_audio_player *p, const cst_wave *w)
+{
+    if (!w)
+        return CST_AUDIO_STREAM_CONT;
+    return audio_player_write(p,w,0,w->num_samples);
+}
+
+int audio_player_flush(cst_audio_player *p)
+{
+    /* Waits until everything queued has been played */
+    int n;
+
+    if (!p->thread)
+        return p->ad ? audio_flush(p->ad) : 0;
+
+    cst_mutex_lock(p->lock);
+    n = ++p->flush_wanted;
+    cst_cond_signal(p->more);
+    while (!p->stopped && ((p->flush_done - n) < 0))
+        cst_cond_wait(p->space,p->lock);
+    cst_mutex_unlock(p->lock);
+
+    return 0;
+}
+
+void audio_player_stop(cst_audio_player *p)
+{
+    /* May be called from any thread: what is queued is dropped, and */
+    /* writes are refused until audio_player_restart()               */
+    if (!p->thread)
+    {
+        p->stopped = TRUE;
+        if (p->ad)
+            audio_drain(p->ad);
+        return;
+    }
+    cst_mutex_lock(p->lock);
+    p->stopped = TRUE;
+    p->count = 0;
+    p->drain_wanted = TRUE;
+    cst_cond_signal(p->more);
+    cst_cond_broadcast(p->space);
+    cst_mutex_unlock(p->lock);
+}
+
+void audio_player_restart(cst_audio_player *p)
+{
+    cst_mutex_lock(p->lock);
+    p->stopped = FALSE;
+    cst_mutex_unlock(p->lock);
+}
+
+int audio_player_stopped(cst_audio_player *p)
+{
+    int s;
+
+    cst_mutex_lock(p->lock);
+    s = p->stopped;
+    cst_mutex_unlock(p->lock);
+    return s;
+}
+
+int audio_player_stream_chunk(const cst_wave *w, int start, int size,
+                              int last, cst_audio_streaming_info *asi)
+{
+    /* Like audio_stream_chunk() but with asi->userdata a player, so */
+    /* the synthesizer isn't held up by the device and stopping the  */
+    /* player stops synthesis                                         */
+    (void)last;
+    return audio_player_write((cst_audio_player *)asi->userdata,
+                              w,start,size);
+}
@@ -55,6 +55,8 @@ cst_audio_streaming_info *new_audio_streaming_info(void)
     asi->min_buffsize = 256;
     asi->asc = NULL;
     asi->userdata = NULL;
+    asi->event = NULL;
+    asi->event_seg = NULL;
 
     return asi;
 }
@@ -66,6 +68,100 @@ void delete_audio_streaming_info(cst_audio_streaming_info *asi)
     return;
 }
 
+int audio_segment_end_sample(const cst_item *seg, int sample_rate)
+{
+    if (item_feat_present(seg,"end_sample"))
+        return item_feat_int(seg,"end_sample");
+    return (int)(item_feat_float(seg,"end")*(float)sample_rate);
+}
+
+static int audio_segment_start_sample(const cst_item *seg, int sample_rate)
+{
+    if (item_prev(seg))
+        return audio_segment_end_sample(item_prev(seg),sample_rate);
+    return 0;
+}
+
+static int audio_stream_event(cst_audio_streaming_info *asi, int type,
+                              const char *name, int start, int end,
+                              const cst_item *item)
+{
+    cst_audio_event e;
+
+    e.type = type;
+    e.name = name;
+    e.start = start;
+    e.end = end;
+    e.item = item;
+
+    return (*asi->event)(&e,asi);
+}
+
+static int audio_stream_events(cst_audio_streaming_info *asi,
+                               const cst_wave *w, int upto, int last)
+{
+    /* The events for the Segments that start before upto, or all that */
+    /* are left for the last chunk                                     */
+    const cst_item *seg, *ss, *syl, *word, *tw, *final;
+    int start, rate = w->sample_rate;
+    int rc = CST_AUDIO_STREAM_CONT;
+
+    for (seg=asi->event_seg; seg; seg=item_next(seg))
+    {
+        start = audio_segment_start_sample(seg,rate);
+        if (!last && (start >= upto))
+            break;
+
+        ss = item_as(seg,"SylStructure");
+        if (ss && !item_prev(ss) &&
+            ((syl = item_parent(ss)) != NULL) && !item_prev(syl) &&
+            ((word = item_parent(syl)) != NULL))
+        {   /* the first phone of a word */
+            tw = item_as(word,"Token");
+            if (tw && !item_prev(tw) && item_parent(tw) &&
+                item_feat_present(item_parent(tw),"ssml_mark"))
+                rc = audio_stream_event(asi,CST_AUDIO_EVENT_MARK,
+                     item_feat_string(item_parent(tw),"ssml_mark"),
+                     start,start,item_parent(tw));
+            final = item_last_daughter(item_last_daughter(word));
+            if (final && (rc == CST_AUDIO_STREAM_CONT))
+                rc = audio_stream_event(asi,CST_AUDIO_EVENT_WORD,
+                     item_feat_string(word,"name"),
+                     start,audio_segment_end_sample(final,rate),word);
+        }
+        if (rc == CST_AUDIO_STREAM_CONT)
+            rc = audio_stream_event(asi,CST_AUDIO_EVENT_PHONE,
+                     item_feat_string(seg,"name"),
+                     start,audio_segment_end_sample(seg,rate),seg);
+        if (rc != CST_AUDIO_STREAM_CONT)
+            break;
+    }
+    asi->event_seg = seg;
+
+    return rc;
+}
+
+int audio_stream_send(cst_audio_streaming_info *asi, const cst_wave *w,
+                      int start, int size, int last)
+{
+    int rc;
+
+    if (asi->event)
+    {
+        if (start == 0)
+            asi->event_seg = asi->utt ?
+                relation_head(utt_relation(asi->utt,"Segment")) : NULL;
+        rc = audio_stream_events(asi,w,start+size,last);
+        if (rc != CST_AUDIO_STREAM_CONT)
+            return rc;
+    }
+
+    if (asi->asc == NULL)   /* only wanted the events */
+        return CST_AUDIO_STREAM_CONT;
+    return (*asi->asc)(w,start,size,last,asi);
+}
+
+
 int audio_stream_chunk(const cst_wave *w, int start, int size, 
                        int last, cst_audio_streaming_info *asi)
 {
@@ -77,10 +77,26 @@ int audio_close(cst_audiodev *ad)
 {
     if (ad->rateconv)
 	delete_rateconv(ad->rateconv);
+    cst_free(ad->conv[0]);
+    cst_free(ad->conv[1]);
 
     return AUDIO_CLOSE_NATIVE(ad);
 }
 
+static void *audio_conv_buffer(cst_audiodev *ad, const void *in, int num_bytes)
+{
+    /* A conversion buffer of at least num_bytes that isn't in */
+    int k = (in == ad->conv[0]) ? 1 : 0;
+
+    if (ad->conv_size[k] < num_bytes)
+    {
+	cst_free(ad->conv[k]);
+	ad->conv[k] = cst_alloc(char,num_bytes);
+	ad->conv_size[k] = num_bytes;
+    }
+    return ad->conv[k];
+}
+
 int audio_write(cst_audiodev *ad,void *buff,int num_bytes)
 {
     void *abuf = buff, *nbuf = NULL;
@@ -95,7 +111,7 @@ int audio_write(cst_audiodev *ad,void *buff,int num_bytes)
 	in = (short *)buff;
 
 	outsize = ad->rateconv->outsize;
-	nbuf = out = cst_alloc(short, outsize);
+	nbuf = out = (short *)audio_conv_buffer(ad, abuf, outsize * 2);
 	real_num_bytes = outsize * 2;
 
 	while ((n = cst_rateconv_in(ad->rateconv, in, insize)) > 0)
@@ -109,8 +125,6 @@ int audio_write(cst_audiodev *ad,void *buff,int num_bytes)
 	    }
 	}
 	real_num_bytes -= outsize * 2;
-	if (abuf != buff)
-	    cst_free(abuf);
 	abuf = nbuf;
     }
     if (ad->real_channels != ad->channels)
@@ -121,7 +135,8 @@ int audio_write(cst_audiodev *ad,void *buff,int num_bytes)
 	    cst_errmsg("audio_write: unsupported channel mapping requested (%d => %d).\n",
 		       ad->channels, ad->real_channels);
 	}
-	nbuf = cst_alloc(char, real_num_bytes * ad->real_channels / ad->channels);
+	nbuf = audio_conv_buffer(ad, abuf,
+				 real_num_bytes * ad->real_channels / ad->channels);
 
 	if (audio_bps(ad->fmt) == 2)
 	{
@@ -142,14 +157,9 @@ int audio_write(cst_audiodev *ad,void *buff,int num_bytes)
 	else
 	{
 	    cst_errmsg("audio_write: unknown format %d\n", ad->fmt);
-	    cst_free(nbuf);
-	    if (abuf != buff)
-		cst_free(abuf);
 	    cst_error();
 	}
 
-	if (abuf != buff)
-	    cst_free(abuf);
 	abuf = nbuf;
 	real_num_bytes = real_num_bytes * ad->real_channels / ad->channels;
     }
@@ -158,7 +168,7 @@ int audio_write(cst_audiodev *ad,void *buff,int num_bytes)
 	if (ad->real_fmt == CST_AUDIO_LINEAR16
 	    && ad->fmt == CST_AUDIO_MULAW)
 	{
-	    nbuf = cst_alloc(char, real_num_bytes * 2);
+	    nbuf = audio_conv_buffer(ad, abuf, real_num_bytes * 2);
 	    for (i = 0; i < real_num_bytes; ++i)
 		((short *)nbuf)[i] = cst_ulaw_to_short(((unsigned char *)abuf)[i]);
 	    real_num_bytes *= 2;
@@ -166,7 +176,7 @@ int audio_write(cst_audiodev *ad,void *buff,int num_bytes)
 	else if (ad->real_fmt == CST_AUDIO_MULAW
 		 && ad->fmt == CST_AUDIO_LINEAR16)
 	{
-	    nbuf = cst_alloc(char, real_num_bytes / 2);
+	    nbuf = audio_conv_buffer(ad, abuf, real_num_bytes / 2);
 	    for (i = 0; i < real_num_bytes / 2; ++i)
 		((unsigned char *)nbuf)[i] = cst_short_to_ulaw(((short *)abuf)[i]);
 	    real_num_bytes /= 2;
@@ -174,7 +184,7 @@ int audio_write(cst_audiodev *ad,void *buff,int num_bytes)
 	else if (ad->real_fmt == CST_AUDIO_LINEAR8
 		 && ad->fmt == CST_AUDIO_LINEAR16)
 	{
-	    nbuf = cst_alloc(char, real_num_bytes / 2);
+	    nbuf = audio_conv_buffer(ad, abuf, real_num_bytes / 2);
 	    for (i = 0; i < real_num_bytes / 2; ++i)
 		((unsigned char *)nbuf)[i] = (((short *)abuf)[i] >> 8) + 128;
 	    real_num_bytes /= 2;
@@ -183,13 +193,8 @@ int audio_write(cst_audiodev *ad,void *buff,int num_bytes)
 	{
 	    cst_errmsg("audio_write: unknown format conversion (%d => %d) requested.\n",
 		       ad->fmt, ad->real_fmt);
-	    cst_free(nbuf);
-	    if (abuf != buff)
-		cst_free(abuf);
 	    cst_error();
 	}
-	if (abuf != buff)
-	    cst_free(abuf);
 	abuf = nbuf;
     }
     if (ad->byteswap && audio_bps(ad->real_fmt) == 2)
@@ -200,9 +205,6 @@ int audio_write(cst_audiodev *ad,void *buff,int num_bytes)
     else
 	rv = 0;
 
-    if (abuf != buff)
-	cst_free(abuf);
-
     /* Callers expect to get the same num_bytes back as they passed
        in.  Funny, that ... */
     return (rv == real_num_bytes) ? num_bytes : 0;
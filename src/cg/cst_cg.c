@@ -61,6 +61,7 @@ static cst_utterance *cg_make_hmmstates(cst_utterance *utt);
 static cst_utterance *cg_make_params(cst_utterance *utt);
 static cst_utterance *cg_predict_params(cst_utterance *utt);
 static cst_utterance *cg_resynth(cst_utterance *utt);
+static cst_utterance *cg_synth_by_phrase(cst_utterance *utt);
 
 void delete_cg_db(cst_cg_db *db)
 {
@@ -166,6 +167,9 @@ cst_utterance *cg_synth(cst_utterance *utt)
 
     cg_make_hmmstates(utt);
     cg_make_params(utt);
+    if (!cg_db->spamf0 &&
+        get_param_int(utt->features,"cg_by_phrase",0))
+        return cg_synth_by_phrase(utt);
     cg_predict_params(utt);
     if (cg_db->spamf0)
     {
@@ -176,6 +180,43 @@ cst_utterance *cg_synth(cst_utterance *utt)
     return utt;
 }
 
+void cg_get_tier(const cst_features *f, cst_cg_tier *tier)
+{
+    const char *name = NULL;
+
+    if (f)
+        name = get_param_string(f,"synthesis_tier",NULL);
+
+    /* "quality" is what is always done, and is used for unknown tiers */
+    tier->num_models = 0;
+    tier->do_mlpg = 1;
+    tier->mlsa_speed_param = 0;
+    tier->pade_order = 0;     /* 5, but 4 when built with SPEED_HACK */
+    tier->postfilter_ir = 64;
+    tier->fixed_point = 0;
+
+    if (name && cst_streq(name,"balanced"))
+    {
+        tier->num_models = 1;
+        tier->pade_order = 4;
+        tier->postfilter_ir = 32;
+    }
+    else if (name && cst_streq(name,"fast"))
+    {
+        tier->num_models = 1;
+        tier->do_mlpg = 0;
+        tier->mlsa_speed_param = 10;
+        tier->pade_order = 4;
+        tier->postfilter_ir = 16;
+    }
+
+    if (f)
+        tier->mlsa_speed_param =
+            get_param_int(f,"mlsa_speed_param",tier->mlsa_speed_param);
+    if (f && cst_streq(get_param_string(f,"resynth_type","float"),"fixed"))
+        tier->fixed_point = 1;
+}
+
 static float cg_state_duration(cst_item *s, cst_cg_db *cg_db)
 {
     float zdur, dur;
@@ -241,7 +282,7 @@ static cst_utterance *cg_make_hmmstates(cst_utterance *utt)
         {
             s = relation_append(hmmstate,NULL);
             item_add_daughter(ss,s);
-            item_set_string(s,"name",cg_db->phone_states[p][sp]);
+            item_set(s,"name",atom_val(cg_db->phone_states[p][sp]));
             item_set_int(s,"statepos",sp);
         }
     }
@@ -256,7 +297,7 @@ static cst_utterance *cg_make_params(cst_utterance *utt)
     cst_cg_db *cg_db;
     cst_relation *mcep, *mcep_link;
     cst_item *s, *mcep_parent, *mcep_frame;
-    int num_frames;
+    int num_frames, framel;
     float start, end;
     float dur_stretch, tok_stretch, rdur;
 
@@ -290,9 +331,16 @@ static cst_utterance *cg_make_params(cst_utterance *utt)
         }
     }
 
-    /* Copy duration up onto Segment relation */
+    /* Copy duration up onto Segment relation, with where each ends in */
+    /* the wave: the vocoder's samples for frame n end at n*framel      */
+    /* (every state has at least one frame)                            */
+    framel = (int)(0.5 + cg_db->frame_advance*cg_db->sample_rate);
     for (s = utt_rel_head(utt,"Segment"); s; s=item_next(s))
+    {
         item_set(s,"end",ffeature(s,"R:segstate.daughtern.end"));
+        item_set_int(s,"end_sample",framel*ffeature_int(s,
+            "R:segstate.daughtern.R:mcep_link.daughtern.frame_number"));
+    }
 
     utt_set_feat_int(utt,"param_track_num_frames",num_frames);
 
@@ -356,10 +404,25 @@ static float catmull_rom_spline(float p,float p0,float p1,float p2,float p3)
     return q;
 }
 
-static void cg_F0_interpolate_spline(cst_utterance *utt,
-                                     cst_track *param_track)
-{
+/* The F0 spline is done a syllable at a time, in order, so it can */
+/* follow the parameters as they are predicted                       */
+typedef struct cg_f0_spline_struct {
+    cst_item *syl;          /* next syllable to do */
     float start_f0, mid_f0, end_f0;
+} cg_f0_spline;
+
+static void cg_F0_spline_init(cg_f0_spline *sp, cst_utterance *utt)
+{
+    sp->syl = utt_rel_head(utt,"Syllable");
+    sp->start_f0 = sp->mid_f0 = sp->end_f0 = -1.0;
+}
+
+static int cg_F0_spline_upto(cg_f0_spline *sp, cst_track *param_track,
+                             int num_frames)
+{
+    /* Spline the syllables whose frames, and the next syllable's, are */
+    /* all within the first num_frames; returns the number of frames   */
+    /* that the spline won't change again                              */
     int start_index, end_index, mid_index;
     int nsi, nei, nmi;  /* next syllable indices */
     float nmid_f0, pmid_f0;
@@ -367,35 +430,40 @@ static void cg_F0_interpolate_spline(cst_utterance *utt,
     int i;
     float m;
 
-    start_f0 = mid_f0 = end_f0 = -1.0;
-
-    for (syl=utt_rel_head(utt,"Syllable"); syl; syl=item_next(syl))
+    for (syl=sp->syl; syl; syl=item_next(syl))
     {
         start_index = ffeature_int(syl,"R:SylStructure.daughter1.R:segstate.daughter1.R:mcep_link.daughter1.frame_number");
         end_index = ffeature_int(syl,"R:SylStructure.daughtern.R:segstate.daughtern.R:mcep_link.daughtern.frame_number");
+        nsi = nei = end_index;
+        if (item_next(syl)) /* not last syllable */
+        {
+            nsi = ffeature_int(syl,"n.R:SylStructure.daughter1.R:segstate.daughter1.R:mcep_link.daughter1.frame_number");
+            nei = ffeature_int(syl,"n.R:SylStructure.daughtern.R:segstate.daughtern.R:mcep_link.daughtern.frame_number");
+        }
+        if ((end_index >= num_frames) || (nei >= num_frames))
+            break;  /* not all predicted yet */
+
         mid_index = (int)((start_index + end_index)/2.0);
         if (end_index <= start_index)
             continue;
         
-        start_f0 = param_track->frames[start_index][0];
-        if (end_f0 > 0.0)
-            start_f0 = end_f0;  /* not first time through */
-        if (mid_f0 < 0.0)
-            pmid_f0 = start_f0;  /* first time through */
+        sp->start_f0 = param_track->frames[start_index][0];
+        if (sp->end_f0 > 0.0)
+            sp->start_f0 = sp->end_f0;  /* not first time through */
+        if (sp->mid_f0 < 0.0)
+            pmid_f0 = sp->start_f0;  /* first time through */
         else
-            pmid_f0 = mid_f0;
-        mid_f0 =  param_track->frames[mid_index][0];
+            pmid_f0 = sp->mid_f0;
+        sp->mid_f0 =  param_track->frames[mid_index][0];
         if (item_next(syl)) /* not last syllable */
-            end_f0 = (param_track->frames[end_index-1][0]+
-                      param_track->frames[end_index][0])/2.0;
+            sp->end_f0 = (param_track->frames[end_index-1][0]+
+                          param_track->frames[end_index][0])/2.0;
         else
-            end_f0 = param_track->frames[end_index-1][0];
-        nmid_f0=end_f0; /* in case there is no next syl */
+            sp->end_f0 = param_track->frames[end_index-1][0];
+        nmid_f0=sp->end_f0; /* in case there is no next syl */
 
         if (item_next(syl))
         {
-            nsi = ffeature_int(syl,"n.R:SylStructure.daughter1.R:segstate.daughter1.R:mcep_link.daughter1.frame_number");
-            nei = ffeature_int(syl,"n.R:SylStructure.daughtern.R:segstate.daughtern.R:mcep_link.daughtern.frame_number");
             nmi = (int)((nsi + nei)/2.0);
             nmid_f0 = param_track->frames[nmi][0];
         }
@@ -403,14 +471,31 @@ static void cg_F0_interpolate_spline(cst_utterance *utt,
         m = 1.0 / (mid_index - start_index);
         for (i=0; ((start_index+i)<mid_index); i++)
             param_track->frames[start_index+i][0] = 
-                 catmull_rom_spline(i*m,pmid_f0,start_f0,mid_f0,end_f0);
+                 catmull_rom_spline(i*m,pmid_f0,sp->start_f0,
+                                    sp->mid_f0,sp->end_f0);
         
         /* mid syl to end */
         m = 1.0 / (end_index - mid_index);
         for (i=0; ((mid_index+i)<end_index); i++)
             param_track->frames[mid_index+i][0] = 
-                catmull_rom_spline(i*m,start_f0,mid_f0,end_f0,nmid_f0);
+                catmull_rom_spline(i*m,sp->start_f0,sp->mid_f0,
+                                   sp->end_f0,nmid_f0);
     }
+    sp->syl = syl;
+
+    if (syl)
+        return ffeature_int(syl,"R:SylStructure.daughter1.R:segstate.daughter1.R:mcep_link.daughter1.frame_number");
+    else
+        return num_frames;
+}
+
+static void cg_F0_interpolate_spline(cst_utterance *utt,
+                                     cst_track *param_track)
+{
+    cg_f0_spline sp;
+
+    cg_F0_spline_init(&sp,utt);
+    cg_F0_spline_upto(&sp,param_track,param_track->num_frames);
 
     return;
 }
@@ -445,39 +530,21 @@ static void cg_smooth_F0_naive(cst_track *param_track)
 }
 #endif
 
-static void cg_smooth_F0(cst_utterance *utt,
-                         cst_cg_db *cg_db,
-                         cst_track *param_track)
+static cst_item *cg_scale_F0(cst_utterance *utt,
+                             cst_cg_db *cg_db,
+                             cst_track *param_track,
+                             cst_item *mcep, int i, int end)
 {
-    /* Smooth F0 and mark unvoice frames as 0.0 */
-    cst_item *mcep;
-    int i;
+    /* Scale F0 of frames i to end-1 (mcep is frame i), and mark */
+    /* unvoiced frames as 0.0, returns the mcep for frame end     */
     float base_mean, base_stddev;
 
-    /* cg_smooth_F0_naive(param_track); */
-    
-    cg_F0_interpolate_spline(utt,param_track);
-
     base_mean = get_param_float(utt->features,"int_f0_target_mean", cg_db->f0_mean);
     base_mean *= get_param_float(utt->features,"f0_shift", 1.0);
     base_stddev =
         get_param_float(utt->features,"int_f0_target_stddev", cg_db->f0_stddev);
-#if 0
-    FILE *ftt; int ii, awbi;
-    ftt = cst_fopen("awb.f0",CST_OPEN_WRITE);
-    printf("awb_debug saving F0\n");
-    for (ii=0; ii<param_track->num_frames; ii++)
-    {
-        for (awbi=0; awbi<param_track->num_channels; awbi++)
-            cst_fprintf(ftt,"%f ",param_track->frames[ii][awbi]);
-        cst_fprintf(ftt,"\n");
-        /* cst_fprintf(ftt,"%f %f\n",param_track->frames[ii][0],
-           param_track->frames[ii][param_track->num_channels-2]); */
-    }
-    cst_fclose(ftt);
-#endif
 
-    for (i=0,mcep=utt_rel_head(utt,"mcep"); mcep; i++,mcep=item_next(mcep))
+    for ( ; mcep && (i < end); i++,mcep=item_next(mcep))
     {
         if (voiced_frame(mcep))
         {
@@ -514,6 +581,37 @@ static void cg_smooth_F0(cst_utterance *utt,
             param_track->frames[i][0] = 0.0;
     }
 
+    return mcep;
+}
+
+static void cg_smooth_F0(cst_utterance *utt,
+                         cst_cg_db *cg_db,
+                         cst_track *param_track)
+{
+    /* Smooth F0 and mark unvoice frames as 0.0 */
+
+    /* cg_smooth_F0_naive(param_track); */
+    
+    cg_F0_interpolate_spline(utt,param_track);
+
+#if 0
+    FILE *ftt; int ii, awbi;
+    ftt = cst_fopen("awb.f0",CST_OPEN_WRITE);
+    printf("awb_debug saving F0\n");
+    for (ii=0; ii<param_track->num_frames; ii++)
+    {
+        for (awbi=0; awbi<param_track->num_channels; awbi++)
+            cst_fprintf(ftt,"%f ",param_track->frames[ii][awbi]);
+        cst_fprintf(ftt,"\n");
+        /* cst_fprintf(ftt,"%f %f\n",param_track->frames[ii][0],
+           param_track->frames[ii][param_track->num_channels-2]); */
+    }
+    cst_fclose(ftt);
+#endif
+
+    cg_scale_F0(utt,cg_db,param_track,utt_rel_head(utt,"mcep"),
+                0,param_track->num_frames);
+
     return;
 }
 
@@ -593,23 +691,15 @@ static int unpack_model_vector(cst_cg_db *cg_db,int pm,int f,float *v)
     }
 }
 
-static cst_utterance *cg_predict_params(cst_utterance *utt)
+static void cg_new_param_tracks(cst_utterance *utt, cst_cg_db *cg_db,
+                                cst_track **param_track,
+                                cst_track **str_track)
 {
-    cst_cg_db *cg_db;
-    cst_track *param_track;
-    cst_track *str_track = NULL;
-    cst_item *mcep;
-    const cst_cart *mcep_tree, *f0_tree;
-    int i,j,f,p,o,pm;
-    const char *mname;
-    float *unpacked_vector;
-    float f0_val, f0_bit;
-    float local_gain, voicing;
     int fff;
     int extra_feats = 0;
 
-    cg_db = val_cg_db(utt_feat_val(utt,"cg_db"));
-    param_track = new_track();
+    *param_track = new_track();
+    *str_track = NULL;
     if (cg_db->do_mlpg) /* which should be the default */
         fff = 1;  /* copy details with stddevs */
     else
@@ -619,90 +709,131 @@ static cst_utterance *cg_predict_params(cst_utterance *utt)
     if (cg_db->mixed_excitation)
     {
         extra_feats += 5;
-        str_track = new_track();
-        cst_track_resize(str_track,
+        *str_track = new_track();
+        cst_track_resize(*str_track,
                          utt_feat_int(utt,"param_track_num_frames"),
                          5);
     }
     
-    cst_track_resize(param_track,
+    cst_track_resize(*param_track,
                      utt_feat_int(utt,"param_track_num_frames"),
                      (cg_db->num_channels[0]/fff)-
                        (2 * extra_feats));/* no voicing or str */
-    unpacked_vector = cst_alloc(float,cg_db->num_channels[0]);
-    f = 0;
-    for (i=0,mcep=utt_rel_head(utt,"mcep"); mcep; i++,mcep=item_next(mcep))
-    {
-        mname = item_feat_string(mcep,"name");
-        local_gain = ffeature_float(mcep,"R:mcep_link.parent.R:segstate.parent.R:SylStructure.parent.parent.R:Token.parent.local_gain");
-        if (local_gain == 0.0) local_gain = 1.0;
-        for (p=0; cg_db->types[p]; p++)
-            if (cst_streq(mname,cg_db->types[p]))
-                break;
-        if (cg_db->types[p] == NULL)
-            p=0; /* if there isn't a matching tree, use the first one */
+}
 
-        /* Predict F0 */
-        for (f0_val=pm=0; pm<cg_db->num_f0_models; pm++)
-        {
-            f0_tree = cg_db->f0_trees[pm][p];
-            f0_bit = val_float(cart_interpret(mcep,f0_tree));
-            f0_val += f0_bit;
-        }
-        param_track->frames[i][0] = f0_val/cg_db->num_f0_models;
-        if (param_track->frames[i][0] < 50.0)
-            param_track->frames[i][0] = 0.0;
-        /* what about stddev ? */
+static void cg_predict_frame(cst_cg_db *cg_db, cst_item *mcep, int i,
+                             cst_track *param_track, cst_track *str_track,
+                             float *unpacked_vector, int num_models)
+{
+    /* Predict F0, the spectral coeffs and strengths for frame i, from */
+    /* the first num_models of each model (all of them if 0)          */
+    const cst_cart *mcep_tree, *f0_tree;
+    int j,f,p,o,pm;
+    const char *mname;
+    float f0_val, f0_bit;
+    float local_gain, voicing;
+    int fff;
+    int num_f0_models, num_param_models;
 
-        /* We only have multiple models now, but the default is one model */
-        /* Predict spectral coeffs */
-        voicing = 0.0;
-        for (pm=0; pm<cg_db->num_param_models; pm++)
-        {
-            mcep_tree = cg_db->param_trees[pm][p];
-            /* printf("awb_debug mcep_tree name %s i\n",mname); */
-            f = val_int(cart_interpret(mcep,mcep_tree));
-            /* If there is one model this will be fine, if there are */
-            /* multiple models this will be the nth model */
-            item_set_int(mcep,"clustergen_param_frame",f);
-            /* printf("awb_debug name %s i %d f %d\n",mname,i,f); */
+    if (cg_db->do_mlpg)
+        fff = 1;
+    else
+        fff = 2;
+    num_f0_models = cg_db->num_f0_models;
+    num_param_models = cg_db->num_param_models;
+    if ((num_models > 0) && (num_f0_models > num_models))
+        num_f0_models = num_models;
+    if ((num_models > 0) && (num_param_models > num_models))
+        num_param_models = num_models;
+
+    mname = item_feat_string(mcep,"name");
+    local_gain = ffeature_float(mcep,"R:mcep_link.parent.R:segstate.parent.R:SylStructure.parent.parent.R:Token.parent.local_gain");
+    if (local_gain == 0.0) local_gain = 1.0;
+    for (p=0; cg_db->types[p]; p++)
+        if (cst_streq(mname,cg_db->types[p]))
+            break;
+    if (cg_db->types[p] == NULL)
+        p=0; /* if there isn't a matching tree, use the first one */
 
-            /* Unpack the model[pm][f] vector */
-            unpack_model_vector(cg_db,pm,f,unpacked_vector);
+    /* Predict F0 */
+    for (f0_val=pm=0; pm<num_f0_models; pm++)
+    {
+        f0_tree = cg_db->f0_trees[pm][p];
+        f0_bit = val_float(cart_interpret(mcep,f0_tree));
+        f0_val += f0_bit;
+    }
+    param_track->frames[i][0] = f0_val/num_f0_models;
+    if (param_track->frames[i][0] < 50.0)
+        param_track->frames[i][0] = 0.0;
+    /* what about stddev ? */
+
+    /* We only have multiple models now, but the default is one model */
+    /* Predict spectral coeffs */
+    voicing = 0.0;
+    for (pm=0; pm<num_param_models; pm++)
+    {
+        mcep_tree = cg_db->param_trees[pm][p];
+        /* printf("awb_debug mcep_tree name %s i\n",mname); */
+        f = val_int(cart_interpret(mcep,mcep_tree));
+        /* If there is one model this will be fine, if there are */
+        /* multiple models this will be the nth model */
+        item_set_int(mcep,"clustergen_param_frame",f);
+        /* printf("awb_debug name %s i %d f %d\n",mname,i,f); */
 
-            /* Old code used to average in param[0] with F0 too (???) */
+        /* Unpack the model[pm][f] vector */
+        unpack_model_vector(cg_db,pm,f,unpacked_vector);
 
-            for (j=2; j<param_track->num_channels; j++)
-            {
-                if (pm == 0) param_track->frames[i][j] = 0.0;
-                param_track->frames[i][j] += unpacked_vector[j*fff]/
+        /* Old code used to average in param[0] with F0 too (???) */
 
-                    (float)cg_db->num_param_models;
-            }
+        for (j=2; j<param_track->num_channels; j++)
+        {
+            if (pm == 0) param_track->frames[i][j] = 0.0;
+            param_track->frames[i][j] += unpacked_vector[j*fff]/
+
+                (float)num_param_models;
+        }
 
-            if (cg_db->mixed_excitation)
+        if (cg_db->mixed_excitation)
+        {
+            o = j;
+            for (j=0; j<5; j++)
             {
-                o = j;
-                for (j=0; j<5; j++)
-                {
-                    if (pm == 0) str_track->frames[i][j] = 0.0;
-                    str_track->frames[i][j] +=
-                        unpacked_vector[(o+(2*j))*fff] /
-                        (float)cg_db->num_param_models;
-                }
+                if (pm == 0) str_track->frames[i][j] = 0.0;
+                str_track->frames[i][j] +=
+                    unpacked_vector[(o+(2*j))*fff] /
+                    (float)num_param_models;
             }
-
-            /* last coefficient is average voicing for cluster */
-            voicing /= (float)(pm+1);
-            voicing += unpacked_vector[cg_db->num_channels[pm]-2] / 
-                (float)(pm+1);
         }
-        item_set_float(mcep,"voicing",voicing);
-        /* Apply local gain to c0 */
-        param_track->frames[i][2] *= local_gain;
 
-        param_track->times[i] = i * cg_db->frame_advance;
+        /* last coefficient is average voicing for cluster */
+        voicing /= (float)(pm+1);
+        voicing += unpacked_vector[cg_db->num_channels[pm]-2] / 
+            (float)(pm+1);
     }
+    item_set_float(mcep,"voicing",voicing);
+    /* Apply local gain to c0 */
+    param_track->frames[i][2] *= local_gain;
+
+    param_track->times[i] = i * cg_db->frame_advance;
+}
+
+static cst_utterance *cg_predict_params(cst_utterance *utt)
+{
+    cst_cg_db *cg_db;
+    cst_track *param_track;
+    cst_track *str_track = NULL;
+    cst_item *mcep;
+    float *unpacked_vector;
+    cst_cg_tier tier;
+    int i;
+
+    cg_db = val_cg_db(utt_feat_val(utt,"cg_db"));
+    cg_get_tier(utt->features,&tier);
+    cg_new_param_tracks(utt,cg_db,&param_track,&str_track);
+    unpacked_vector = cst_alloc(float,cg_db->num_channels[0]);
+    for (i=0,mcep=utt_rel_head(utt,"mcep"); mcep; i++,mcep=item_next(mcep))
+        cg_predict_frame(cg_db,mcep,i,param_track,str_track,unpacked_vector,
+                         tier.num_models);
 
     cst_free(unpacked_vector);
     cg_smooth_F0(utt,cg_db,param_track);
@@ -714,16 +845,47 @@ static cst_utterance *cg_predict_params(cst_utterance *utt)
     return utt;
 }
 
+static cst_track *cg_static_params(const cst_track *param_track)
+{
+    /* The static means, as mlpg() would return them without smoothing */
+    cst_track *out;
+    int i, j, dim_st;
+
+    dim_st = ((param_track->num_channels/2)-1)/2;
+    out = new_track();
+    cst_track_resize(out,param_track->num_frames,dim_st+1);
+    for (i=0; i<param_track->num_frames; i++)
+    {
+        out->times[i] = param_track->times[i];
+        out->frames[i][0] = param_track->frames[i][0]; /* F0 */
+        for (j=0; j<dim_st; j++)
+            out->frames[i][j+1] = param_track->frames[i][(j+1)*2];
+    }
+
+    return out;
+}
+
+static cst_track *cg_smooth_params(const cst_track *param_track,
+                                   cst_cg_db *cg_db,
+                                   const cst_cg_tier *tier)
+{
+    if (tier->do_mlpg)
+        return mlpg(param_track, cg_db);
+    else
+        return cg_static_params(param_track);
+}
+
 static cst_utterance *cg_resynth(cst_utterance *utt)
 {
     cst_cg_db *cg_db;
     cst_wave *w;
     cst_track *param_track;
     cst_track *str_track = NULL;
-    cst_track *smoothed_track;
+    cst_track *smoothed_track = NULL;
     const cst_val *streaming_info_val;
     cst_audio_streaming_info *asi = NULL;
-    int mlsa_speed_param = 0;
+    cst_cg_tier tier;
+    cst_mlsa *m;
 
     streaming_info_val=get_param_val(utt->features,"streaming_info",NULL);
     if (streaming_info_val)
@@ -731,11 +893,11 @@ static cst_utterance *cg_resynth(cst_utterance *utt)
         asi = val_audio_streaming_info(streaming_info_val);
         asi->utt = utt;
     }
-    /* Values 5-15 might be reasonably to speed things up.  This number */
-    /* is used to reduce the number of parameters used in the mceps      */
-    /* e.g. value 10 will speed up from 21.0 faster than real time       */
-    /* to 26.4 times faster than real time (for builtin rms) */
-    mlsa_speed_param = get_param_int(utt->features,"mlsa_speed_param",0);
+    /* mlsa_speed_param values 5-15 might be reasonably to speed things */
+    /* up.  This number is used to reduce the number of parameters used */
+    /* in the mceps e.g. value 10 will speed up from 21.0 faster than    */
+    /* real time to 26.4 times faster than real time (for builtin rms)   */
+    cg_get_tier(utt->features,&tier);
 
     cg_db = val_cg_db(utt_feat_val(utt,"cg_db"));
     param_track = val_track(utt_feat_val(utt,"param_track"));
@@ -746,15 +908,15 @@ static cst_utterance *cg_resynth(cst_utterance *utt)
 
     if (cg_db->do_mlpg)
     {
-        smoothed_track = mlpg(param_track, cg_db);
+        smoothed_track = cg_smooth_params(param_track, cg_db, &tier);
         /* cst_track_save_est(smoothed_track, "flite_post_mlpg.track"); */
-        w = mlsa_resynthesis(smoothed_track,str_track,cg_db,
-                             asi,mlsa_speed_param);
-        delete_track(smoothed_track);
+        param_track = smoothed_track;
     }
-    else
-        w=mlsa_resynthesis(param_track,str_track,cg_db,
-                           asi,mlsa_speed_param);
+    m = new_mlsa(param_track,cg_db,&tier);
+    mlsa_synth_frames(m,param_track,str_track,0,param_track->num_frames,asi);
+    w = mlsa_finish(m,asi);
+    if (smoothed_track)
+        delete_track(smoothed_track);
 
     if (w == NULL)
     {
@@ -778,5 +940,132 @@ static cst_utterance *cg_resynth(cst_utterance *utt)
     return utt;
 }
 
+/* MLPG over a piece of the track needs this many frames beyond it (on */
+/* each side) to give (nearly) the same result as over the whole track */
+#define CG_MLPG_CONTEXT 40
+
+static int cg_phrase_break(cst_item *seg)
+{
+    /* Pieces end at the middle of each pause, but the first and last */
+    /* (flite puts a pau at the end of each Phrase)                   */
+    int s, e;
+
+    if (!cst_streq("pau",item_feat_string(seg,"name")) ||
+        (item_prev(seg) == NULL) || (item_next(seg) == NULL))
+        return -1;
+    s = ffeature_int(seg,"R:segstate.daughter1.R:mcep_link.daughter1.frame_number");
+    e = ffeature_int(seg,"R:segstate.daughtern.R:mcep_link.daughtern.frame_number");
+    return (s+e)/2;
+}
+
+static cst_utterance *cg_synth_by_phrase(cst_utterance *utt)
+{
+    /* As cg_predict_params() then cg_resynth(), but phrase by phrase: */
+    /* the parameters of each phrase are predicted, smoothed and       */
+    /* vocoded (and streamed) before the next phrase is started         */
+    cst_cg_db *cg_db;
+    cst_track *param_track, *str_track = NULL;
+    cst_track *smoothed_track = NULL;
+    cst_track sub, *piece;
+    cst_item *mcep, *smcep, *seg;
+    cst_wave *w;
+    cst_mlsa *m = NULL;
+    const cst_val *streaming_info_val;
+    cst_audio_streaming_info *asi = NULL;
+    cg_f0_spline sp;
+    cst_cg_tier tier;
+    float *unpacked_vector;
+    int n, a, b, i, c, s, need;
+    int predicted, final, f;
+    int rc = CST_AUDIO_STREAM_CONT;
+
+    cg_db = val_cg_db(utt_feat_val(utt,"cg_db"));
+    streaming_info_val=get_param_val(utt->features,"streaming_info",NULL);
+    if (streaming_info_val)
+    {
+        asi = val_audio_streaming_info(streaming_info_val);
+        asi->utt = utt;
+    }
+    cg_get_tier(utt->features,&tier);
+
+    cg_new_param_tracks(utt,cg_db,&param_track,&str_track);
+    utt_set_feat(utt,"param_track",track_val(param_track));
+    if (cg_db->mixed_excitation)
+        utt_set_feat(utt,"str_track",track_val(str_track));
+    n = param_track->num_frames;
+    unpacked_vector = cst_alloc(float,cg_db->num_channels[0]);
+    cg_F0_spline_init(&sp,utt);
+
+    mcep = smcep = utt_rel_head(utt,"mcep");
+    seg = utt_rel_head(utt,"Segment");
+    predicted = final = 0;
+    for (a=0; (a < n) && (rc == CST_AUDIO_STREAM_CONT); a=b)
+    {
+        for (b=-1; seg && (b <= a); seg=item_next(seg))
+            b = cg_phrase_break(seg);
+        if (b <= a)
+            b = n;
+        if (cg_db->do_mlpg && tier.do_mlpg)
+            need = (b+CG_MLPG_CONTEXT < n) ? b+CG_MLPG_CONTEXT : n;
+        else
+            need = b;
+
+        /* Predict until the F0 of frames up to need is done */
+        while ((final < need) && mcep)
+        {
+            cg_predict_frame(cg_db,mcep,predicted,param_track,str_track,
+                             unpacked_vector,tier.num_models);
+            mcep = item_next(mcep);
+            predicted++;
+            f = cg_F0_spline_upto(&sp,param_track,predicted);
+            if (f > final)
+            {
+                smcep = cg_scale_F0(utt,cg_db,param_track,smcep,final,f);
+                final = f;
+            }
+        }
+
+        if (cg_db->do_mlpg)
+        {
+            s = (a > CG_MLPG_CONTEXT) ? a-CG_MLPG_CONTEXT : 0;
+            sub = *param_track;
+            sub.num_frames = need-s;
+            sub.times += s;
+            sub.frames += s;
+            piece = cg_smooth_params(&sub,cg_db,&tier);
+            if (smoothed_track == NULL)
+            {
+                smoothed_track = new_track();
+                cst_track_resize(smoothed_track,n,piece->num_channels);
+                for (i=0; i<n; i++)
+                    smoothed_track->times[i] = i * cg_db->frame_advance;
+            }
+            for (i=a; i<b; i++)
+                for (c=0; c<piece->num_channels; c++)
+                    smoothed_track->frames[i][c] = piece->frames[i-s][c];
+            delete_track(piece);
+        }
+        else
+            smoothed_track = param_track;
 
+        if (m == NULL)
+            m = new_mlsa(smoothed_track,cg_db,&tier);
+        rc = mlsa_synth_frames(m,smoothed_track,str_track,a,b,asi);
+    }
+    cst_free(unpacked_vector);
 
+    if (m == NULL)
+        w = new_wave();   /* no frames */
+    else if ((w = mlsa_finish(m,asi)) == NULL)
+    {
+        /* Synthesis Failed, probably because it was interrupted */
+        utt_set_feat_int(utt,"Interrupted",1);
+        w = new_wave();
+    }
+    utt_set_wave(utt,w);
+
+    if (smoothed_track != param_track)
+        delete_track(smoothed_track);
+
+    return utt;
+}
@@ -243,7 +243,7 @@ cst_cart_node* cst_read_tree_nodes(cst_file fd,int bs)
         if (vtype == CST_VAL_TYPE_STRING)
         {
             str = cst_read_string(fd,bs);
-            nodes[i].val = string_val(str);
+            nodes[i].val = atom_val(str);
             cst_free(str);
         }
         else if (vtype == CST_VAL_TYPE_INT)
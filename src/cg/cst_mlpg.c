@@ -307,21 +307,21 @@ static void get_dltmat(DMATRIX mat, DWin *dw, int dno, DMATRIX dmat)
 }
 
 
-static double *dcalloc(int x, int xoff)
+static cg_real *dcalloc(int x, int xoff)
 {
-    double *ptr;
+    cg_real *ptr;
 
-    ptr = mlpg_alloc(x,double);
+    ptr = mlpg_alloc(x,cg_real);
     /* ptr += xoff; */ /* Just not going to allow this */
     return(ptr);
 }
 
-static double **ddcalloc(int x, int y, int xoff, int yoff)
+static cg_real **ddcalloc(int x, int y, int xoff, int yoff)
 {
-    double **ptr;
+    cg_real **ptr;
     int i;
 
-    ptr = mlpg_alloc(x,double *);
+    ptr = mlpg_alloc(x,cg_real *);
     for (i = 0; i < x; i++) ptr[i] = dcalloc(y, yoff);
     /* ptr += xoff; */ /* Just not going to allow this */
     return(ptr);
@@ -344,20 +344,20 @@ static void InitDWin(PStreamChol *pst, const float *dynwin, int fsize)
     for (i = 0; i < pst->dw.num; i++)
         pst->dw.width[i] = mlpg_alloc(2,int);
 
-    pst->dw.coef = mlpg_alloc(pst->dw.num, double *);
-    pst->dw.coef_ptrs = mlpg_alloc(pst->dw.num, double *);
+    pst->dw.coef = mlpg_alloc(pst->dw.num, cg_real *);
+    pst->dw.coef_ptrs = mlpg_alloc(pst->dw.num, cg_real *);
     /* window for static parameter	WLEFT = 0, WRIGHT = 1 */
     pst->dw.width[0][WLEFT] = pst->dw.width[0][WRIGHT] = 0;
-    pst->dw.coef_ptrs[0] = mlpg_alloc(1,double);
+    pst->dw.coef_ptrs[0] = mlpg_alloc(1,cg_real);
     pst->dw.coef[0] = pst->dw.coef_ptrs[0];
     pst->dw.coef[0][0] = 1.0;
 
     /* set delta coefficients */
     for (i = 1; i < pst->dw.num; i++) {
-        pst->dw.coef_ptrs[i] = mlpg_alloc(fsize, double);
+        pst->dw.coef_ptrs[i] = mlpg_alloc(fsize, cg_real);
 	pst->dw.coef[i] = pst->dw.coef_ptrs[i];
         for (j=0; j<fsize; j++) /* FIXME make dynwin doubles for memmove */
-            pst->dw.coef[i][j] = (double)dynwin[j];
+            pst->dw.coef[i][j] = (cg_real)dynwin[j];
 	/* set pointer */
 	leng = fsize / 2;			/* L (fsize = 2 * L + 1) */
 	pst->dw.coef[i] += leng;		/* [L] -> [0]	center */
@@ -552,7 +552,7 @@ static void Choleski_backward(PStreamChol *pst, const int m)
 
 /* ML Considering Global Variance */
 #if 0
-static void varconv(double **c, const int m, const int T, const double var)
+static void varconv(cg_real **c, const int m, const int T, const double var)
 {
     int n;
     double sd, osd;
@@ -566,7 +566,7 @@ static void varconv(double **c, const int m, const int T, const double var)
     return;
 }
 
-static void calc_varstats(double **c, const int m, const int T,
+static void calc_varstats(cg_real **c, const int m, const int T,
 		   double *av, double *var, double *dif)
 {
     int i;
@@ -727,7 +727,8 @@ static DVECTOR xget_detvec_diamat2inv(DMATRIX covmat)	/* [num class][dim] */
 		/* cst_errmsg("error:(class %ld) determinant <= 0, det = %f\n", i, det); */
 	    }
 	}
-	detvec->data[i] = det;
+	/* it's only used for the likelihood, so don't let it underflow */
+	detvec->data[i] = (det < CG_REAL_MIN) ? CG_REAL_MIN : det;
     }
 
     return detvec;
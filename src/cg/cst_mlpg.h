@@ -114,8 +114,8 @@
 typedef struct _DWin {
     int	num;		/* number of static + deltas */
     int **width;	/* width [0..num-1][0(left) 1(right)] */
-    double **coef;	/* coefficient [0..num-1][length[0]..length[1]] */
-    double **coef_ptrs;	/* keeps the pointers so we can free them */
+    cg_real **coef;	/* coefficient [0..num-1][length[0]..length[1]] */
+    cg_real **coef_ptrs;	/* keeps the pointers so we can free them */
     int maxw[2];	/* max width [0(left) 1(right)] */
 } DWin;
 
@@ -125,13 +125,13 @@ typedef struct _PStreamChol {
     int T;		/* number of frames */
     int width;		/* width of WSW */
     DWin dw;
-    double **mseq;	/* sequence of mean vector */
-    double **ivseq;	/* sequence of invarsed covariance vector */
-    double ***ifvseq;	/* sequence of invarsed full covariance vector */
-    double **R;		/* WSW[T][range] */
-    double *r;		/* WSM [T] */
-    double *g;		/* g [T] */
-    double **c;		/* parameter c */
+    cg_real **mseq;	/* sequence of mean vector */
+    cg_real **ivseq;	/* sequence of invarsed covariance vector */
+    cg_real ***ifvseq;	/* sequence of invarsed full covariance vector */
+    cg_real **R;		/* WSW[T][range] */
+    cg_real *r;		/* WSM [T] */
+    cg_real *g;		/* g [T] */
+    cg_real **c;		/* parameter c */
 } PStreamChol;
 
 
@@ -169,8 +169,8 @@ static void sm_mvav(DMATRIX mat, long hlen);
 static void get_dltmat(DMATRIX mat, DWin *dw, int dno, DMATRIX dmat);
 
 
-static double *dcalloc(int x, int xoff);
-static double **ddcalloc(int x, int y, int xoff, int yoff);
+static cg_real *dcalloc(int x, int xoff);
+static cg_real **ddcalloc(int x, int y, int xoff, int yoff);
 
 /***********************************/
 /* ML using Choleski decomposition */
@@ -201,8 +201,8 @@ static void Choleski_backwardFC(PStreamChol *pst);
 /* ML Considering Global Variance */
 /**********************************/
 #if 0
-static void varconv(double **c, const int m, const int T, const double var);
-static void calc_varstats(double **c, const int m, const int T,
+static void varconv(cg_real **c, const int m, const int T, const double var);
+static void calc_varstats(cg_real **c, const int m, const int T,
 			  double *av, double *var, double *dif);
 /* Diagonal Covariance Version */
 static void mlgparaGrad(DMATRIX pdf, PStreamChol *pst, DMATRIX mlgp,
@@ -67,10 +67,9 @@
 #endif
 
 #ifdef UNDER_CE
+/* cg_real is also float here (see cst_vc.h), that and this makes */
+/* CG voices in flowm fast enough on my phone                      */
 #define SPEED_HACK
-/* This is one of those other things you shouldn't do, but it makes
-   CG voices in flowm fast enough on my phone */
-#define double float
 #endif
 
 #include "cst_vc.h"
@@ -78,13 +77,6 @@
 #include "cst_mlsa.h"
 
 
-static cst_wave *synthesis_body(const cst_track *params, 
-                                const cst_track *str, 
-                                double fs, double framem,
-                                cst_cg_db *cg_db,
-                                cst_audio_streaming_info *asi,
-                                int mlsa_speed_param);
-
 cst_wave *mlsa_resynthesis(const cst_track *params, 
                            const cst_track *str, 
                            cst_cg_db *cg_db,
@@ -92,101 +84,125 @@ cst_wave *mlsa_resynthesis(const cst_track *params,
                            int mlsa_speed_param)
 {
     /* Resynthesizes a wave from given track */
-    cst_wave *wave = 0;
-    int sr = cg_db->sample_rate;
-    double shift;
+    cst_mlsa *m;
+    cst_cg_tier tier;
+
+    cg_get_tier(NULL,&tier);
+    tier.mlsa_speed_param = mlsa_speed_param;
+    m = new_mlsa(params,cg_db,&tier);
+    mlsa_synth_frames(m,params,str,0,params->num_frames,asi);
+
+    return mlsa_finish(m,asi);
+}
+
+cst_mlsa *new_mlsa(const cst_track *params, /* f0 + mcep */
+                   cst_cg_db *cg_db,
+                   const cst_cg_tier *tier)
+{
+    cst_mlsa *m;
+    int mlsa_speed_param = tier->mlsa_speed_param;
+    int framel;
+    double fs = cg_db->sample_rate;    /* sampling frequency (Hz) */
+    double framem;                     /* frame size */
 
     if (params->num_frames > 1)
-        shift = 1000.0*(params->times[1]-params->times[0]);
+        framem = 1000.0*(params->times[1]-params->times[0]);
     else
-        shift = 5.0;
+        framem = 5.0;
+
+    m = cst_alloc(cst_mlsa,1);
+    m->cg_db = cg_db;
+    m->rc = CST_AUDIO_STREAM_CONT;
+    m->num_mcep = params->num_channels-1;
+    if ((m->num_mcep > mlsa_speed_param) &&
+        ((m->num_mcep - mlsa_speed_param) > 4))
+        /* Basically ignore some of the higher coeffs */
+        /* It'll sound worse, but it will be faster */
+        m->num_mcep -= mlsa_speed_param;
+    framel = (int)(0.5 + (framem * fs / 1000.0)); /* 80 for 16KHz */
+    init_vocoder(fs, framel, m->num_mcep, &m->vs, cg_db, tier);
 
-    wave = synthesis_body(params,str,sr,shift,cg_db,asi,mlsa_speed_param);
+    /* synthesize waveforms by MLSA filter */
+    m->wave = new_wave();
+    cst_wave_resize(m->wave,params->num_frames * framel,1);
+    m->wave->sample_rate = fs; 
 
-    return wave;
+    m->mcep = cst_alloc(cg_real,m->num_mcep+1);
+
+    return m;
 }
 
-static cst_wave *synthesis_body(const cst_track *params, /* f0 + mcep */
-                                const cst_track *str,
-                                double fs,	/* sampling frequency (Hz) */
-                                double framem,	/* frame size */
-                                cst_cg_db *cg_db,
-                                cst_audio_streaming_info *asi,
-                                int mlsa_speed_param)
+int mlsa_synth_frames(cst_mlsa *m,
+                      const cst_track *params,
+                      const cst_track *str,
+                      int start, int end,
+                      cst_audio_streaming_info *asi)
 {
-    long t, pos;
-    int framel, i;
+    int t, i;
     double f0;
-    VocoderSetup vs;
-    cst_wave *wave = 0;
-    double *mcep;
-    int stream_mark;
-    int rc = CST_AUDIO_STREAM_CONT;
-    int num_mcep;
-    double ffs = fs;
-
-    num_mcep = params->num_channels-1;
-    if ((num_mcep > mlsa_speed_param) &&
-        ((num_mcep - mlsa_speed_param) > 4))
-        /* Basically ignore some of the higher coeffs */
-        /* It'll sound worse, but it will be faster */
-        num_mcep -= mlsa_speed_param;
-    framel = (int)(0.5 + (framem * ffs / 1000.0)); /* 80 for 16KHz */
-    init_vocoder(ffs, framel, num_mcep, &vs, cg_db);
 
     if (str != NULL)
-        vs.gauss = MFALSE;
-
-    /* synthesize waveforms by MLSA filter */
-    wave = new_wave();
-    cst_wave_resize(wave,params->num_frames * framel,1);
-    wave->sample_rate = fs; 
+        m->vs.gauss = MFALSE;
 
-    mcep = cst_alloc(double,num_mcep+1);
-
-    for (t = 0, stream_mark = pos = 0; 
-         (rc == CST_AUDIO_STREAM_CONT) && (t < params->num_frames);
-         t++) 
+    for (t = start; (m->rc == CST_AUDIO_STREAM_CONT) && (t < end); t++) 
     {
         f0 = (double)params->frames[t][0];
-        for (i=1; i<num_mcep+1; i++)
-            mcep[i-1] = params->frames[t][i];
-        mcep[i-1] = 0;
-
-        if (str)
-            vocoder(f0, mcep, str->frames[t], num_mcep, cg_db, &vs, wave, &pos);
+        for (i=1; i<m->num_mcep+1; i++)
+            m->mcep[i-1] = params->frames[t][i];
+        m->mcep[i-1] = 0;
+
+        if (m->vs.fixed)
+            vocoder_fixed(f0, m->mcep, (str ? str->frames[t] : NULL),
+                          m->num_mcep, m->cg_db, &m->vs, m->wave, &m->pos);
+        else if (str)
+            vocoder(f0, m->mcep, str->frames[t], m->num_mcep, m->cg_db,
+                    &m->vs, m->wave, &m->pos);
         else
-            vocoder(f0, mcep, NULL, num_mcep, cg_db, &vs, wave, &pos);
+            vocoder(f0, m->mcep, NULL, m->num_mcep, m->cg_db,
+                    &m->vs, m->wave, &m->pos);
 
-        if (asi && (pos-stream_mark > asi->min_buffsize))
+        if (asi && (m->pos-m->stream_mark > asi->min_buffsize))
         {
-            rc=(*asi->asc)(wave,stream_mark,pos-stream_mark,0,asi);
-            stream_mark = pos;
+            m->rc=audio_stream_send(asi,m->wave,m->stream_mark,
+                                    m->pos-m->stream_mark,0);
+            m->stream_mark = m->pos;
         }
     }
-    wave->num_samples = pos;
 
-    if (asi && (rc == CST_AUDIO_STREAM_CONT))
+    return m->rc;
+}
+
+cst_wave *mlsa_finish(cst_mlsa *m, cst_audio_streaming_info *asi)
+{
+    cst_wave *wave = m->wave;
+
+    wave->num_samples = m->pos;
+
+    if (asi && (m->rc == CST_AUDIO_STREAM_CONT))
     {   /* drain the last part of the waveform */
-        (*asi->asc)(wave,stream_mark,pos-stream_mark,1,asi);
+        audio_stream_send(asi,wave,m->stream_mark,m->pos-m->stream_mark,1);
     }
 
     /* memory free */
-    cst_free(mcep);
-    free_vocoder(&vs);
+    cst_free(m->mcep);
+    free_vocoder(&m->vs);
 
-    if (rc == CST_AUDIO_STREAM_STOP)
+    if (m->rc == CST_AUDIO_STREAM_STOP)
     {
         delete_wave(wave);
-        return NULL;
+        wave = NULL;
     }
-    else
-        return wave;
+    cst_free(m);
+
+    return wave;
 }
 
 static void init_vocoder(double fs, int framel, int m, 
-                         VocoderSetup *vs, cst_cg_db *cg_db)
+                         VocoderSetup *vs, cst_cg_db *cg_db,
+                         const cst_cg_tier *tier)
 {
+    int i, j;
+
     /* initialize global parameter */
     vs->fprd = framel;
     vs->iprd = 1;
@@ -197,6 +213,8 @@ static void init_vocoder(double fs, int framel, int m,
 #else
     vs->pd   = 5;
 #endif
+    if ((tier->pade_order == 4) || (tier->pade_order == 5))
+        vs->pd = tier->pade_order;  /* the only orders in pade[] */
 
     vs->next =1;
     vs->gauss = MTRUE;
@@ -211,7 +229,7 @@ static void init_vocoder(double fs, int framel, int m,
     vs->pade[20]=0.00003041721;
 
     vs->rate = fs;
-    vs->c = cst_alloc(double,3 * (m + 1) + 3 * (vs->pd + 1) + vs->pd * (m + 2));
+    vs->c = cst_alloc(cg_real,3 * (m + 1) + 3 * (vs->pd + 1) + vs->pd * (m + 2));
    
     vs->p1 = -1;
     vs->sw = 0;
@@ -222,56 +240,192 @@ static void init_vocoder(double fs, int framel, int m,
     vs->o  = 0;
     vs->d  = NULL;
     vs->irleng= 64;
+    /* Only used for the gain of the postfilter, so a shorter impulse */
+    /* response (and a lower order freqt to get it) does well enough   */
+    if ((tier->postfilter_ir > 1) && (tier->postfilter_ir < vs->irleng))
+        vs->irleng = tier->postfilter_ir;
    
     /* for MIXED EXCITATION */
     vs->ME_order = cg_db->ME_order;
     vs->ME_num = cg_db->ME_num;
-    vs->hpulse = cst_alloc(double,vs->ME_order);
-    vs->hnoise = cst_alloc(double,vs->ME_order);
-    vs->xpulsesig = cst_alloc(double,vs->ME_order);
-    vs->xnoisesig = cst_alloc(double,vs->ME_order);
+    vs->hpulse = cst_alloc(cg_real,vs->ME_order);
+    vs->hnoise = cst_alloc(cg_real,vs->ME_order);
+    vs->hsum = cst_alloc(cg_real,vs->ME_order);
+    vs->me_str = cst_alloc(float,vs->ME_num);
+    vs->xnoisesig = cst_alloc(cg_real,2*(vs->ME_order+1));
+    vs->me_pos = 0;
+    vs->num_pulses = 0;
+    vs->pulse_t = cst_alloc(long,vs->ME_order+1);
+    vs->pulse_amp = cst_alloc(cg_real,vs->ME_order+1);
+    vs->me_t = 0;
+    vs->me_noise = cst_alloc(cg_real,framel);
+    vs->me_pulse_at = cst_alloc(int,framel+1);
+    vs->me_pulse_amp = cst_alloc(cg_real,framel);
+    vs->me_rand = 0x55555555;
     vs->h = cg_db->me_h;
 
+    if (cg_db->mixed_excitation)
+    {
+        for (j=0; j<vs->ME_num; j++)
+        {
+            for (i=0; i<vs->ME_order; i++)
+                vs->hsum[i] += vs->h[j][i];
+            vs->me_str[j] = -1.0;  /* so the first frame builds hpulse */
+        }
+    }
+
+    vs->fixed = tier->fixed_point;
+    if (vs->fixed)
+    {
+        vs->fx_c = cst_alloc(int,3*(m+1) + 3*(vs->pd+1) + vs->pd*(m+2));
+        vs->fx_mc = cst_alloc(int,m+1);
+        for (i=0; i<=vs->pd; i++)
+            vs->fx_pade[i] = FX_Q(vs->pade[vs->pd*(vs->pd+1)/2+i]);
+        vs->fx_alpha = FX_Q(cg_db->mlsa_alpha);
+        vs->fx_aa = FX_Q(1.0-cg_db->mlsa_alpha*cg_db->mlsa_alpha);
+        vs->fx_beta1 = FX_Q(1.0+cg_db->mlsa_beta);
+        vs->fx_beta_alpha = FX_Q(cg_db->mlsa_beta*cg_db->mlsa_alpha);
+        vs->fx_p1 = -1;
+        vs->fx_hpulse = cst_alloc(int,vs->ME_order);
+        vs->fx_hnoise = cst_alloc(int,vs->ME_order);
+        vs->fx_noisesig = cst_alloc(int,2*(vs->ME_order+1));
+        vs->fx_pulse_amp = cst_alloc(int,vs->ME_order+1);
+        vs->fx_me_noise = cst_alloc(int,framel);
+        vs->fx_me_pulse_amp = cst_alloc(int,framel);
+    }
+
     return;
 }
 
-static double plus_or_minus_one()
+static void me_filters(VocoderSetup *vs, const float *str)
 {
-    /* Randomly return 1 or -1 */
-    /* not sure rand() is portable */
-    if (rand() > RAND_MAX/2.0)
-        return 1.0;
-    else
-        return -1.0;
+    /* Build hpulse and hnoise for this frame's strengths, unless */
+    /* they are the same as last time                              */
+    int i, j;
+    cg_real s;
+    const double *h;
+
+    if (memcmp(str,vs->me_str,sizeof(float)*vs->ME_num) == 0)
+        return;
+    memmove(vs->me_str,str,sizeof(float)*vs->ME_num);
+
+    for (i=0; i<vs->ME_order; i++)
+        vs->hpulse[i] = 0.0;
+    for (j=0; j<vs->ME_num; j++)
+    {
+        s = str[j];
+        h = vs->h[j];
+        for (i=0; i<vs->ME_order; i++)
+            vs->hpulse[i] += s * h[i];
+    }
+    for (i=0; i<vs->ME_order; i++)
+        vs->hnoise[i] = vs->hsum[i] - vs->hpulse[i];
+
+    if (vs->fixed)
+    {
+        for (i=0; i<vs->ME_order; i++)
+        {
+            vs->fx_hpulse[i] = FX_Q(vs->hpulse[i]);
+            vs->fx_hnoise[i] = FX_Q(vs->hnoise[i]);
+        }
+    }
+}
+
+static void me_excitation(VocoderSetup *vs, cg_real inc)
+{
+    /* Make the whole frame's excitation before it's filtered: a +1/-1 */
+    /* noise at every sample, from 32 bits of xorshift at a time, and   */
+    /* in voiced frames a pulse at each pitch period                    */
+    unsigned int r, bits;
+    cg_real p1;
+    int i, j, k;
+
+    r = vs->me_rand;
+    for (j=0; j<vs->fprd; j+=32)
+    {
+        r ^= r << 13;
+        r ^= r >> 17;
+        r ^= r << 5;
+        for (bits=r, k=j; (k < j+32) && (k < vs->fprd); k++, bits >>= 1)
+            vs->me_noise[k] = (bits & 1) ? 1.0 : -1.0;
+    }
+    vs->me_rand = r;
+
+    k = 0;
+    if (vs->p1 != 0.0)
+    {   /* p1 moves as it does in vocoder() */
+        for (p1=vs->p1, j=0, i=(vs->iprd+1)/2; j<vs->fprd; j++)
+        {
+            if ((vs->pc += 1.0) >= p1)
+            {
+                vs->me_pulse_at[k] = j;
+                vs->me_pulse_amp[k++] = sqrt(p1);
+                vs->pc = vs->pc - p1;
+            }
+            if (!--i)
+            {
+                p1 += inc;
+                i = vs->iprd;
+            }
+        }
+    }
+    vs->me_pulse_at[k] = -1;
 }
 
-static void vocoder(double p, double *mc, 
+static cg_real me_filter(VocoderSetup *vs, cg_real xnoise, cg_real xpulse)
+{
+    /* Apply the shaping filters to one sample of pulse and noise.  As */
+    /* it always has, h[0] is applied to this sample and h[k] to the    */
+    /* one k+1 back, the last sample isn't used                         */
+    int a, k, n = vs->ME_order;
+    cg_real fxpulse, fxnoise;
+
+    if (vs->me_pos == 0)
+        vs->me_pos = n+1;
+    vs->me_pos--;
+    vs->xnoisesig[vs->me_pos] = vs->xnoisesig[vs->me_pos+n+1] = xnoise;
+    fxnoise = cg_dot(vs->hnoise+1,vs->xnoisesig+vs->me_pos+2,n-1);
+    fxnoise += vs->hnoise[0] * xnoise;
+
+    for (k=0; (k < vs->num_pulses) && (vs->me_t-vs->pulse_t[k] > n); k++);
+    if (k > 0)
+    {   /* these have gone all the way through */
+        vs->num_pulses -= k;
+        memmove(vs->pulse_t,vs->pulse_t+k,sizeof(long)*vs->num_pulses);
+        memmove(vs->pulse_amp,vs->pulse_amp+k,sizeof(cg_real)*vs->num_pulses);
+    }
+    if (xpulse != 0.0)
+    {
+        vs->pulse_t[vs->num_pulses] = vs->me_t;
+        vs->pulse_amp[vs->num_pulses++] = xpulse;
+    }
+    for (fxpulse=0.0, k=0; k<vs->num_pulses; k++)
+    {
+        a = vs->me_t - vs->pulse_t[k];
+        if (a == 0)
+            fxpulse += vs->hpulse[0] * vs->pulse_amp[k];
+        else if (a > 1)
+            fxpulse += vs->hpulse[a-1] * vs->pulse_amp[k];
+    }
+    vs->me_t++;
+
+    return fxpulse + fxnoise; /* excitation is pulse plus noise */
+}
+
+static void vocoder(cg_real p, cg_real *mc, 
                     const float *str,
                     int m, cst_cg_db *cg_db,
                     VocoderSetup *vs, cst_wave *wav, long *pos)
 {
-    double inc, x, e1, e2;
-    int i, j, k; 
-    double xpulse, xnoise;
-    double fxpulse, fxnoise;
+    cg_real inc, x, e1, e2;
+    int i, j, k, np;
     float gain=1.0;
 
     if (cg_db->gain != 0.0)
         gain = cg_db->gain;
    
     if (str != NULL)     /* MIXED-EXCITATION */
-    {
-        /* Copy in str's and build hpulse and hnoise for this frame */
-        for (i=0; i<vs->ME_order; i++)
-        {
-            vs->hpulse[i] = vs->hnoise[i] = 0.0;
-            for (j=0; j<vs->ME_num; j++)
-            {
-                vs->hpulse[i] += str[j] * vs->h[j][i];
-                vs->hnoise[i] += (1 - str[j]) * vs->h[j][i];
-            }
-        }
-    }
+        me_filters(vs,str);
 
     if (p != 0.0)
 	p = vs->rate / p;  /* f0 -> pitch */
@@ -313,62 +467,36 @@ static void vocoder(double p, double *mc,
 
     for (k=0; k<=m; k++)
 	vs->cinc[k] = (vs->cc[k] - vs->c[k]) *
-	    (double)vs->iprd / (double)vs->fprd;
+	    (cg_real)vs->iprd / (cg_real)vs->fprd;
 
     if (vs->p1!=0.0 && p!=0.0) {
-	inc = (p - vs->p1) * (double)vs->iprd / (double)vs->fprd;
+	inc = (p - vs->p1) * (cg_real)vs->iprd / (cg_real)vs->fprd;
     } else {
 	inc = 0.0;
 	vs->pc = p;
 	vs->p1 = 0.0;
     }
 
-    for (j = vs->fprd, i = (vs->iprd + 1) / 2; j--;) {
-	if (vs->p1 == 0.0) {
-	    if (vs->gauss)
-		x = (double) nrandom(vs);
-	    else
-		x = plus_or_minus_one();
-            if (str != NULL)             /* MIXED EXCITATION */
-            {
-                xnoise = x;
-                xpulse = 0.0;
-            }
+    if (str != NULL)     /* MIXED EXCITATION */
+        me_excitation(vs,inc);
+
+    for (j = 0, np = 0, i = (vs->iprd + 1) / 2; j < vs->fprd; j++) {
+        if (str != NULL) {   /* MIXED EXCITATION */
+            /* The real work -- apply shaping filters to pulse and noise */
+            if (j == vs->me_pulse_at[np])
+                x = me_filter(vs,vs->me_noise[j],vs->me_pulse_amp[np++]);
+            else
+                x = me_filter(vs,vs->me_noise[j],0.0);
+        } else if (vs->p1 == 0.0) {
+            x = (cg_real) nrandom(vs);
 	} else {
 	    if ((vs->pc += 1.0) >= vs->p1) {
 		x = sqrt (vs->p1);
 		vs->pc = vs->pc - vs->p1;
 	    } else 
                 x = 0.0;
-
-            if (str != NULL)  /* MIXED EXCITATION */
-            {
-                xpulse = x;
-                xnoise = plus_or_minus_one();
-            }
 	}
 
-        /* MIXED EXCITATION */
-        /* The real work -- apply shaping filters to pulse and noise */
-        if (str != NULL)
-        {
-            fxpulse = fxnoise = 0.0;
-            for (k=vs->ME_order-1; k>0; k--)
-            {
-                fxpulse += vs->hpulse[k] * vs->xpulsesig[k];
-                fxnoise += vs->hnoise[k] * vs->xnoisesig[k];
-
-                vs->xpulsesig[k] = vs->xpulsesig[k-1];
-                vs->xnoisesig[k] = vs->xnoisesig[k-1];
-            }
-            fxpulse += vs->hpulse[0] * xpulse;
-            fxnoise += vs->hnoise[0] * xnoise;
-            vs->xpulsesig[0] = xpulse;
-            vs->xnoisesig[0] = xnoise;
-
-            x = fxpulse + fxnoise; /* excitation is pulse plus noise */
-        }
-
         if (cg_db->sample_rate == 8000)
             /* 8KHz voices are too quiet: this is probably not general */
             x *= exp(vs->c[0])*2.0;
@@ -388,12 +516,12 @@ static void vocoder(double p, double *mc,
     }
    
     vs->p1 = p;
-    memmove(vs->c,vs->cc,sizeof(double)*(m+1));
+    memmove(vs->c,vs->cc,sizeof(cg_real)*(m+1));
    
     return;
 }
 
-static double mlsadf(double x, double *b, int m, double a, int pd, double *d, VocoderSetup *vs)
+static cg_real mlsadf(cg_real x, cg_real *b, int m, cg_real a, int pd, cg_real *d, VocoderSetup *vs)
 {
 
    vs->ppade = &(vs->pade[pd*(pd+1)/2]);
@@ -404,9 +532,9 @@ static double mlsadf(double x, double *b, int m, double a, int pd, double *d, Vo
    return(x);
 }
 
-static double mlsadf1(double x, double *b, int m, double a, int pd, double *d, VocoderSetup *vs)
+static cg_real mlsadf1(cg_real x, cg_real *b, int m, cg_real a, int pd, cg_real *d, VocoderSetup *vs)
 {
-   double v, out = 0.0, *pt, aa;
+   cg_real v, out = 0.0, *pt, aa;
    int i;
 
    aa = 1 - a*a;
@@ -426,9 +554,9 @@ static double mlsadf1(double x, double *b, int m, double a, int pd, double *d, V
    return(out);
 }
 
-static double mlsadf2 (double x, double *b, int m, double a, int pd, double *d, VocoderSetup *vs)
+static cg_real mlsadf2 (cg_real x, cg_real *b, int m, cg_real a, int pd, cg_real *d, VocoderSetup *vs)
 {
-  double v, out = 0.0, *pt;
+  cg_real v, out = 0.0, *pt;
   int i;
     
    pt = &d[pd * (m+2)];
@@ -448,10 +576,10 @@ static double mlsadf2 (double x, double *b, int m, double a, int pd, double *d,
    return(out);
 }
 
-static double mlsafir (double x, double *b, int m, double a, double *d)
+static cg_real mlsafir (cg_real x, cg_real *b, int m, cg_real a, cg_real *d)
 {  
-   double y = 0.0;
-   double aa;
+   cg_real y = 0.0;
+   cg_real aa;
    int i;
 
    aa = 1 - a*a;
@@ -469,7 +597,391 @@ static double mlsafir (double x, double *b, int m, double a, double *d)
    return(y);
 }
 
-static double nrandom (VocoderSetup *vs)
+static void vocoder_fixed(cg_real p, cg_real *mc, 
+                          const float *str,
+                          int m, cst_cg_db *cg_db,
+                          VocoderSetup *vs, cst_wave *wav, long *pos)
+{
+    /* As vocoder() but with integers at each sample: the excitation,  */
+    /* its gain, the MLSA filter and the coefficients moving from one   */
+    /* frame's to the next.  The unvoiced excitation is +1/-1 noise, as  */
+    /* in mixed excitation, rather than nrandom()'s gaussian             */
+    int x, fxp, inc, gain;
+    int i, j, k, np;
+    unsigned int r;
+    long long y;
+
+    if (cg_db->sample_rate == 8000)
+        /* 8KHz voices are too quiet: this is probably not general */
+        gain = 2 << 16;
+    else if (cg_db->gain != 0.0)
+        gain = (int)(cg_db->gain * 65536.0 + 0.5);
+    else
+        gain = 1 << 16;
+
+    if (str != NULL)     /* MIXED-EXCITATION */
+        me_filters(vs,str);
+
+    fxp = 0;
+    if (p != 0.0)
+    {   /* f0 -> pitch, in Q16 samples */
+        p = vs->rate / p;
+        if (p > 16384.0)
+            p = 16384.0;
+        fxp = (int)(p * 65536.0 + 0.5);
+    }
+
+    for (k=0; k<=m; k++)
+        vs->fx_mc[k] = FX_Q(mc[k]);
+
+    if (vs->fx_p1 < 0) {
+	vs->fx_p1 = fxp;
+	vs->fx_pc = vs->fx_p1;
+	vs->fx_cc   = vs->fx_c + m + 1;
+	vs->fx_cinc = vs->fx_cc + m + 1;
+	vs->fx_d1   = vs->fx_cinc + m + 1;
+	vs->cc = vs->c + m + 1;   /* for postfilter_fixed() */
+
+	mc2b_fixed(vs->fx_mc, vs->fx_c, m, vs->fx_alpha);
+        postfilter_fixed(mc, vs->fx_c, m, cg_db, vs);
+
+	return;
+    }
+
+    mc2b_fixed(vs->fx_mc, vs->fx_cc, m, vs->fx_alpha);
+    postfilter_fixed(mc, vs->fx_cc, m, cg_db, vs);
+
+    for (k=0; k<=m; k++)
+	vs->fx_cinc[k] = (vs->fx_cc[k] - vs->fx_c[k]) * vs->iprd / vs->fprd;
+
+    if (vs->fx_p1 != 0 && fxp != 0) {
+	inc = (fxp - vs->fx_p1) * vs->iprd;
+        inc = (inc + ((inc < 0) ? -vs->fprd : vs->fprd)/2) / vs->fprd;
+    } else {
+	inc = 0;
+	vs->fx_pc = fxp;
+	vs->fx_p1 = 0;
+    }
+
+    if (str != NULL)     /* MIXED EXCITATION */
+        me_excitation_fixed(vs,inc);
+
+    for (j = 0, np = 0, i = (vs->iprd + 1) / 2; j < vs->fprd; j++) {
+        if (str != NULL) {   /* MIXED EXCITATION */
+            if (j == vs->me_pulse_at[np])
+                x = me_filter_fixed(vs,vs->fx_me_noise[j],
+                                    vs->fx_me_pulse_amp[np++]);
+            else
+                x = me_filter_fixed(vs,vs->fx_me_noise[j],0);
+        } else if (vs->fx_p1 == 0) {
+            r = vs->me_rand;
+            r ^= r << 13;
+            r ^= r >> 17;
+            r ^= r << 5;
+            vs->me_rand = r;
+            x = (r & 1) ? (1 << FX_S) : -(1 << FX_S);
+	} else {
+	    if ((vs->fx_pc += 1 << 16) >= vs->fx_p1) {
+		x = fx_sqrt(vs->fx_p1);
+		vs->fx_pc = vs->fx_pc - vs->fx_p1;
+	    } else 
+                x = 0;
+	}
+
+        y = ((long long)fx_exp_scale(x,vs->fx_c[0]) * gain) >> 16;
+        if (y > (1 << 30))
+            y = 1 << 30;
+        else if (y < -(1 << 30))
+            y = -(1 << 30);
+
+	x = mlsadf_fixed((int)y, vs->fx_c, m, vs->fx_alpha, vs->pd,
+                         vs->fx_d1, vs);
+
+        x = (x + (1 << (FX_S-1))) >> FX_S;
+        if (x > 32767)
+            x = 32767;
+        else if (x < -32768)
+            x = -32768;
+        wav->samples[*pos] = (short)x;
+	*pos += 1;
+
+	if (!--i) {
+	    vs->fx_p1 += inc;
+	    for (k = 0; k <= m; k++) vs->fx_c[k] += vs->fx_cinc[k];
+	    i = vs->iprd;
+	}
+    }
+   
+    vs->fx_p1 = fxp;
+    memmove(vs->fx_c,vs->fx_cc,sizeof(int)*(m+1));
+   
+    return;
+}
+
+static int mlsadf_fixed(int x, const int *b, int m, int a, int pd, int *d,
+                        VocoderSetup *vs)
+{
+   x = mlsadf1_fixed(x, b, m, a, pd, d, vs);
+   x = mlsadf2_fixed(x, b, m, a, pd, &d[2*(pd+1)], vs);
+
+   return(x);
+}
+
+static int mlsadf1_fixed(int x, const int *b, int m, int a, int pd, int *d,
+                         VocoderSetup *vs)
+{
+   int v, out = 0, *pt;
+   int i;
+
+   pt = &d[pd+1];
+
+   for (i=pd; i>=1; i--) {
+      d[i] = FX_MUL(vs->fx_aa,pt[i-1]) + FX_MUL(a,d[i]);
+      pt[i] = FX_MUL(d[i],b[1]);
+      v = FX_MUL(pt[i],vs->fx_pade[i]);
+      x += (1 & i) ? v : -v;
+      out += v;
+   }
+
+   pt[0] = x;
+   out += x;
+
+   return(out);
+}
+
+static int mlsadf2_fixed(int x, const int *b, int m, int a, int pd, int *d,
+                         VocoderSetup *vs)
+{
+   int v, out = 0, *pt;
+   int i;
+    
+   pt = &d[pd * (m+2)];
+
+   for (i=pd; i>=1; i--) {
+       pt[i] = mlsafir_fixed(pt[i-1], b, m, a, vs->fx_aa, &d[(i-1)*(m+2)]);
+
+       v = FX_MUL(pt[i],vs->fx_pade[i]);
+
+       x  += (1&i) ? v : -v;
+       out += v;
+   }
+    
+   pt[0] = x;
+   out  += x;
+
+   return(out);
+}
+
+static int mlsafir_fixed(int x, const int *b, int m, int a, int aa, int *d)
+{  
+   long long y = 0;
+   int i;
+
+   d[0] = x;
+   d[1] = FX_MUL(aa,d[0]) + FX_MUL(a,d[1]);
+   for (i=2; i<= m; i++) {
+      d[i] = d[i] + FX_MUL(a,d[i+1]-d[i-1]);
+      y += (long long)d[i]*b[i];
+   }
+
+   for (i=m+1; i>1; i--) 
+      d[i] = d[i-1];
+
+   return (int)((y + (1 << (FX_B-1))) >> FX_B);
+}
+
+static void me_excitation_fixed(VocoderSetup *vs, int inc)
+{
+    /* me_excitation() for vocoder_fixed(), the same noise, and pulses */
+    /* of sqrt(period) in Q8                                           */
+    unsigned int r, bits;
+    int p1;
+    int i, j, k;
+
+    r = vs->me_rand;
+    for (j=0; j<vs->fprd; j+=32)
+    {
+        r ^= r << 13;
+        r ^= r >> 17;
+        r ^= r << 5;
+        for (bits=r, k=j; (k < j+32) && (k < vs->fprd); k++, bits >>= 1)
+            vs->fx_me_noise[k] = (bits & 1) ? 1 : -1;
+    }
+    vs->me_rand = r;
+
+    k = 0;
+    if (vs->fx_p1 != 0)
+    {
+        for (p1=vs->fx_p1, j=0, i=(vs->iprd+1)/2; j<vs->fprd; j++)
+        {
+            if ((vs->fx_pc += 1 << 16) >= p1)
+            {
+                vs->me_pulse_at[k] = j;
+                vs->fx_me_pulse_amp[k++] = fx_sqrt(p1);
+                vs->fx_pc = vs->fx_pc - p1;
+            }
+            if (!--i)
+            {
+                p1 += inc;
+                i = vs->iprd;
+            }
+        }
+    }
+    vs->me_pulse_at[k] = -1;
+}
+
+static int me_filter_fixed(VocoderSetup *vs, int xnoise, int xpulse)
+{
+    /* me_filter() with Q24 filters, xnoise is +1/-1 and xpulse Q8, */
+    /* the excitation is returned in Q8                              */
+    int a, k, n = vs->ME_order;
+    int fxnoise;
+    long long fxpulse;
+
+    if (vs->me_pos == 0)
+        vs->me_pos = n+1;
+    vs->me_pos--;
+    vs->fx_noisesig[vs->me_pos] = vs->fx_noisesig[vs->me_pos+n+1] = xnoise;
+    fxnoise = cst_dsp->dot_int(vs->fx_hnoise+1,
+                               vs->fx_noisesig+vs->me_pos+2,n-1);
+    fxnoise += vs->fx_hnoise[0] * xnoise;
+
+    for (k=0; (k < vs->num_pulses) && (vs->me_t-vs->pulse_t[k] > n); k++);
+    if (k > 0)
+    {   /* these have gone all the way through */
+        vs->num_pulses -= k;
+        memmove(vs->pulse_t,vs->pulse_t+k,sizeof(long)*vs->num_pulses);
+        memmove(vs->fx_pulse_amp,vs->fx_pulse_amp+k,
+                sizeof(int)*vs->num_pulses);
+    }
+    if (xpulse != 0)
+    {
+        vs->pulse_t[vs->num_pulses] = vs->me_t;
+        vs->fx_pulse_amp[vs->num_pulses++] = xpulse;
+    }
+    for (fxpulse=0, k=0; k<vs->num_pulses; k++)
+    {
+        a = vs->me_t - vs->pulse_t[k];
+        if (a == 0)
+            fxpulse += (long long)vs->fx_hpulse[0] * vs->fx_pulse_amp[k];
+        else if (a > 1)
+            fxpulse += (long long)vs->fx_hpulse[a-1] * vs->fx_pulse_amp[k];
+    }
+    vs->me_t++;
+
+    fxpulse += (long long)fxnoise << FX_S;
+    return (int)((fxpulse + (1 << (FX_B-1))) >> FX_B);
+}
+
+/* mc2b() in Q24 */
+static void mc2b_fixed(const int *mc, int *b, int m, int a)
+{
+   b[m] = mc[m];
+    
+   for (m--; m>=0; m--)
+      b[m] = mc[m] - FX_MUL(a,b[m+1]);
+   
+   return;
+}
+
+static void postfilter_fixed(cg_real *mc, int *b, int m, cst_cg_db *cg_db,
+                             VocoderSetup *vs)
+{
+    /* The postfilter as in vocoder(), its gain is still found with */
+    /* b2en() on a cg_real copy, that is only once a frame           */
+    cg_real e1, e2;
+    int k;
+
+    if (cg_db->mlsa_beta <= 0.0 || m <= 1)
+        return;
+
+    for (k=0; k<=m; k++)
+        vs->cc[k] = FX_REAL(b[k]);
+    e1 = b2en(vs->cc, m, cg_db->mlsa_alpha, vs);
+    b[1] -= FX_MUL(vs->fx_beta_alpha,vs->fx_mc[2]);
+    for (k=2; k<=m; k++)
+        b[k] = FX_MUL(vs->fx_beta1,b[k]);
+    for (k=0; k<=m; k++)
+        vs->cc[k] = FX_REAL(b[k]);
+    e2 = b2en(vs->cc, m, cg_db->mlsa_alpha, vs);
+    b[0] += FX_Q(log(e1/e2)/2.0);
+}
+
+/* 2^(i/64) in Q29 */
+static const int fx_exp2_table[65] = {
+    536870912, 542717053, 548626854, 554601009, 560640218,
+    566745190, 572916640, 579155293, 585461881, 591837143,
+    598281827, 604796689, 611382493, 618040012, 624770026,
+    631573326, 638450708, 645402981, 652430958, 659535466,
+    666717336, 673977412, 681316545, 688735596, 696235434,
+    703816941, 711481005, 719228525, 727060411, 734977579,
+    742980960, 751071493, 759250125, 767517817, 775875538,
+    784324269, 792865000, 801498734, 810226483, 819049271,
+    827968132, 836984114, 846098274, 855311680, 864625413,
+    874040567, 883558244, 893179563, 902905651, 912737649,
+    922676710, 932724001, 942880699, 953147997, 963527098,
+    974019220, 984625594, 995347464, 1006186087, 1017142735,
+    1028218693, 1039415261, 1050733751, 1062175491, 1073741824
+};
+#define FX_LOG2E 24204406   /* log2(e) in Q24 */
+
+static int fx_exp_scale(int x, int c)
+{
+    /* x*exp(c) for Q24 c, as x*2^(c*log2(e)): the whole part of the */
+    /* power is a shift, the rest is from the table                  */
+    long long l, y;
+    int ip, f, t, shift;
+
+    l = ((long long)c * FX_LOG2E) >> FX_B;
+    ip = (int)(l >> FX_B);
+    f = (int)(l & ((1 << FX_B)-1));
+    t = f >> (FX_B-6);
+    f &= (1 << (FX_B-6))-1;
+    y = fx_exp2_table[t] +
+        ((((long long)(fx_exp2_table[t+1]-fx_exp2_table[t])) * f)
+         >> (FX_B-6));
+
+    y *= x;
+    shift = 29 - ip;
+    if (shift >= 62)
+        return 0;
+    else if (shift > 0)
+        y = (y + (1LL << (shift-1))) >> shift;
+    else if (shift > -16)
+        y <<= -shift;
+    else
+        y = (x < 0) ? -(1LL << 31) : (1LL << 31);
+
+    if (y > 0x7fffffff)
+        return 0x7fffffff;
+    else if (y < -0x7fffffff)
+        return -0x7fffffff;
+    return (int)y;
+}
+
+static int fx_sqrt(int p)
+{
+    /* sqrt of a Q16 pitch period, in Q8 */
+    unsigned int v = (unsigned int)p, r = 0, b = 1u << 30;
+
+    while (b > v)
+        b >>= 2;
+    while (b)
+    {
+        if (v >= r + b)
+        {
+            v -= r + b;
+            r = (r >> 1) + b;
+        }
+        else
+            r >>= 1;
+        b >>= 2;
+    }
+
+    return (int)r;
+}
+
+static cg_real nrandom (VocoderSetup *vs)
 {
    if (vs->sw == 0) {
       vs->sw = 1;
@@ -490,9 +1002,9 @@ static double nrandom (VocoderSetup *vs)
    }
 }
 
-static double rnd (unsigned long *next)
+static cg_real rnd (unsigned long *next)
 {
-   double r;
+   cg_real r;
 
    *next = *next * 1103515245L + 12345;
    r = (*next / 65536L) % 32768L;
@@ -506,7 +1018,7 @@ static unsigned long srnd ( unsigned long seed )
 }
 
 /* mc2b : transform mel-cepstrum to MLSA digital fillter coefficients */
-static void mc2b (double *mc, double *b, int m, double a)
+static void mc2b (cg_real *mc, cg_real *b, int m, cg_real a)
 {
    b[m] = mc[m];
     
@@ -517,16 +1029,16 @@ static void mc2b (double *mc, double *b, int m, double a)
 }
 
 
-static double b2en (double *b, int m, double a, VocoderSetup *vs)
+static cg_real b2en (cg_real *b, int m, cg_real a, VocoderSetup *vs)
 {
-   double en;
+   cg_real en;
    int k;
    
    if (vs->o<m) {
       if (vs->mc != NULL)
           cst_free(vs->mc);
     
-      vs->mc = cst_alloc(double,(m + 1) + 2 * vs->irleng);
+      vs->mc = cst_alloc(cg_real,(m + 1) + 2 * vs->irleng);
       vs->cep = vs->mc + m+1;
       vs->ir  = vs->cep + vs->irleng;
    }
@@ -544,9 +1056,9 @@ static double b2en (double *b, int m, double a, VocoderSetup *vs)
 
 
 /* b2bc : transform MLSA digital filter coefficients to mel-cepstrum */
-static void b2mc (double *b, double *mc, int m, double a)
+static void b2mc (cg_real *b, cg_real *mc, int m, cg_real a)
 {
-  double d, o;
+  cg_real d, o;
         
   d = mc[m] = b[m];
   for (m--; m>=0; m--) {
@@ -559,21 +1071,21 @@ static void b2mc (double *b, double *mc, int m, double a)
 }
 
 /* freqt : frequency transformation */
-static void freqt (double *c1, int m1, double *c2, int m2, double a, VocoderSetup *vs)
+static void freqt (cg_real *c1, int m1, cg_real *c2, int m2, cg_real a, VocoderSetup *vs)
 {
    int i, j;
-   double b;
+   cg_real b;
     
    if (vs->d==NULL) {
       vs->size = m2;
-      vs->d    = cst_alloc(double,vs->size + vs->size + 2);
+      vs->d    = cst_alloc(cg_real,vs->size + vs->size + 2);
       vs->g    = vs->d+vs->size+1;
    }
 
    if (m2>vs->size) {
        cst_free(vs->d);
       vs->size = m2;
-      vs->d    = cst_alloc(double,vs->size + vs->size + 2);
+      vs->d    = cst_alloc(cg_real,vs->size + vs->size + 2);
       vs->g    = vs->d+vs->size+1;
    }
     
@@ -590,16 +1102,16 @@ static void freqt (double *c1, int m1, double *c2, int m2, double a, VocoderSetu
          vs->g[j] = vs->d[j-1]+a*((vs->d[j]=vs->g[j])-vs->g[j-1]);
    }
 
-   memmove(c2,vs->g,sizeof(double)*(m2+1));
+   memmove(c2,vs->g,sizeof(cg_real)*(m2+1));
    
    return;
 }
 
 /* c2ir : The minimum phase impulse response is evaluated from the minimum phase cepstrum */
-static void c2ir (double *c, int nc, double *h, int leng)
+static void c2ir (cg_real *c, int nc, cg_real *h, int leng)
 {
    int n, k, upl;
-   double  d;
+   cg_real  d;
 
    h[0] = exp(c[0]);
    for (n=1; n<leng; n++) {
@@ -633,8 +1145,23 @@ static void free_vocoder(VocoderSetup *vs)
 
     cst_free(vs->hpulse);
     cst_free(vs->hnoise);
-    cst_free(vs->xpulsesig);
+    cst_free(vs->hsum);
+    cst_free(vs->me_str);
     cst_free(vs->xnoisesig);
+    cst_free(vs->pulse_t);
+    cst_free(vs->pulse_amp);
+    cst_free(vs->me_noise);
+    cst_free(vs->me_pulse_at);
+    cst_free(vs->me_pulse_amp);
+
+    cst_free(vs->fx_c);
+    cst_free(vs->fx_mc);
+    cst_free(vs->fx_hpulse);
+    cst_free(vs->fx_hnoise);
+    cst_free(vs->fx_noisesig);
+    cst_free(vs->fx_pulse_amp);
+    cst_free(vs->fx_me_noise);
+    cst_free(vs->fx_me_pulse_amp);
 
    
     return;
@@ -61,6 +61,15 @@
 #define   B31_       0x7fffffff
 #define   Z          0x00000000
 
+/* The fixed point vocoder has filter coefficients (and the Pade and */
+/* excitation filters) in Q24, and samples in Q8                    */
+#define FX_B 24
+#define FX_S 8
+#define FX_Q(X) ((int)((X)*(double)(1<<FX_B) + (((X) < 0) ? -0.5 : 0.5)))
+#define FX_REAL(I) ((cg_real)(I)/(cg_real)(1<<FX_B))
+#define FX_MUL(A,B) \
+    ((int)((((long long)(A)*(B)) + (1<<(FX_B-1))) >> FX_B))
+
 typedef struct _VocoderSetup {
    
    int fprd;
@@ -69,64 +78,129 @@ typedef struct _VocoderSetup {
    int pd;
    unsigned long next;
    Boolean gauss;
-   double p1;
-   double pc;
-   double pj;
-   double pade[21];
-   double *ppade;
-   double *c, *cc, *cinc, *d1;
-   double rate;
+   cg_real p1;
+   cg_real pc;
+   cg_real pj;
+   cg_real pade[21];
+   cg_real *ppade;
+   cg_real *c, *cc, *cinc, *d1;
+   cg_real rate;
    
    int sw;
-   double r1, r2, s;
+   cg_real r1, r2, s;
    
    int x;
    
    /* for postfiltering */
    int size;
-   double *d; 
-   double *g;
-   double *mc;
-   double *cep;
-   double *ir;
+   cg_real *d; 
+   cg_real *g;
+   cg_real *mc;
+   cg_real *cep;
+   cg_real *ir;
    int o;
    int irleng;
    
     /* for MIXED EXCITATION */
     int ME_order;
     int ME_num;
-    double *hpulse;
-    double *hnoise;
+    cg_real *hpulse;
+    cg_real *hnoise;
+    cg_real *hsum;          /* sum of the band filters, hnoise is hsum-hpulse */
+    float *me_str;         /* strengths hpulse was last built for */
+
+    /* The noise delay line is circular, and written twice so the last */
+    /* ME_order+1 samples are always contiguous from xnoisesig+me_pos   */
+    cg_real *xnoisesig;
+    int me_pos;
+
+    /* Pulses are sparse, so only those still in the filter are kept */
+    int num_pulses;
+    long *pulse_t;
+    cg_real *pulse_amp;
+    long me_t;             /* samples filtered so far */
 
-    double *xpulsesig;
-    double *xnoisesig;
+    /* Each frame's excitation is made before it is filtered */
+    cg_real *me_noise;
+    int *me_pulse_at;      /* sample in the frame, ends with -1 */
+    cg_real *me_pulse_amp;
+    unsigned int me_rand;  /* xorshift state for the noise */
 
     const double * const *h;  
 
+    /* The fixed point vocoder: everything done at each sample is in */
+    /* integers, once a frame the mceps are converted and the pitch   */
+    /* and postfilter gain found as above                             */
+    int fixed;
+    int *fx_c, *fx_cc, *fx_cinc, *fx_d1;
+    int *fx_mc;
+    int fx_pade[6];        /* the row of pade[] for pd */
+    int fx_alpha, fx_aa;
+    int fx_beta1, fx_beta_alpha;  /* 1+beta and beta*alpha */
+    int fx_p1, fx_pc;      /* pitch period in samples, Q16 */
+    int *fx_hpulse, *fx_hnoise;
+    int *fx_noisesig;      /* +1/-1, as xnoisesig */
+    int *fx_pulse_amp;
+    int *fx_me_noise;
+    int *fx_me_pulse_amp;
+
 } VocoderSetup;
 
+struct cst_mlsa_struct {
+    VocoderSetup vs;
+    cst_cg_db *cg_db;
+    cst_wave *wave;
+    cg_real *mcep;
+    int num_mcep;
+    long pos;           /* samples so far */
+    long stream_mark;   /* samples given to the streaming callback */
+    int rc;
+};
+
 static void init_vocoder(double fs, int framel, int m, 
-                         VocoderSetup *vs, cst_cg_db *cg_db);
-static void vocoder(double p, double *mc, 
+                         VocoderSetup *vs, cst_cg_db *cg_db,
+                         const cst_cg_tier *tier);
+static void vocoder(cg_real p, cg_real *mc, 
                     const float *str,
                     int m, cst_cg_db *cg_db,
                      VocoderSetup *vs, cst_wave *wav, long *pos);
-static double mlsadf(double x, double *b, int m, double a, int pd, double *d,
+static void vocoder_fixed(cg_real p, cg_real *mc,
+                          const float *str,
+                          int m, cst_cg_db *cg_db,
+                          VocoderSetup *vs, cst_wave *wav, long *pos);
+static cg_real mlsadf(cg_real x, cg_real *b, int m, cg_real a, int pd, cg_real *d,
 		     VocoderSetup *vs);
-static double mlsadf1(double x, double *b, int m, double a, int pd, double *d,
+static cg_real mlsadf1(cg_real x, cg_real *b, int m, cg_real a, int pd, cg_real *d,
 		      VocoderSetup *vs);
-static double mlsadf2(double x, double *b, int m, double a, int pd, double *d,
+static cg_real mlsadf2(cg_real x, cg_real *b, int m, cg_real a, int pd, cg_real *d,
 		      VocoderSetup *vs);
-static double mlsafir (double x, double *b, int m, double a, double *d);
-static double nrandom (VocoderSetup *vs);
-static double rnd (unsigned long *next);
+static cg_real mlsafir (cg_real x, cg_real *b, int m, cg_real a, cg_real *d);
+static void me_filters(VocoderSetup *vs, const float *str);
+static void me_excitation(VocoderSetup *vs, cg_real inc);
+static cg_real me_filter(VocoderSetup *vs, cg_real xnoise, cg_real xpulse);
+static int mlsadf_fixed(int x, const int *b, int m, int a, int pd, int *d,
+                        VocoderSetup *vs);
+static int mlsadf1_fixed(int x, const int *b, int m, int a, int pd, int *d,
+                         VocoderSetup *vs);
+static int mlsadf2_fixed(int x, const int *b, int m, int a, int pd, int *d,
+                         VocoderSetup *vs);
+static int mlsafir_fixed(int x, const int *b, int m, int a, int aa, int *d);
+static void me_excitation_fixed(VocoderSetup *vs, int inc);
+static int me_filter_fixed(VocoderSetup *vs, int xnoise, int xpulse);
+static void mc2b_fixed(const int *mc, int *b, int m, int a);
+static void postfilter_fixed(cg_real *mc, int *b, int m, cst_cg_db *cg_db,
+                             VocoderSetup *vs);
+static int fx_exp_scale(int x, int c);
+static int fx_sqrt(int p);
+static cg_real nrandom (VocoderSetup *vs);
+static cg_real rnd (unsigned long *next);
 static unsigned long srnd (unsigned long seed);
-static void mc2b (double *mc, double *b, int m, double a);
-static double b2en (double *b, int m, double a, VocoderSetup *vs);
-static void b2mc (double *b, double *mc, int m, double a);
-static void freqt (double *c1, int m1, double *c2, int m2, double a,
+static void mc2b (cg_real *mc, cg_real *b, int m, cg_real a);
+static cg_real b2en (cg_real *b, int m, cg_real a, VocoderSetup *vs);
+static void b2mc (cg_real *b, cg_real *mc, int m, cg_real a);
+static void freqt (cg_real *c1, int m1, cg_real *c2, int m2, cg_real a,
 		   VocoderSetup *vs);
-static void c2ir (double *c, int nc, double *h, int leng);
+static void c2ir (cg_real *c, int nc, cg_real *h, int leng);
 
 static void free_vocoder(VocoderSetup *vs);
 
@@ -88,7 +88,7 @@ DVECTOR xdvalloc(long length)
 
     length = MAX(length, 0);
     x = cst_alloc(struct DVECTOR_STRUCT,1);
-    x->data = cst_alloc(double,MAX(length, 1));
+    x->data = cst_alloc(cg_real,MAX(length, 1));
     x->imag = NULL;
     x->length = length;
 
@@ -115,7 +115,7 @@ void dvialloc(DVECTOR x)
     if (x->imag != NULL) {
 	cst_free(x->imag);
     }
-    x->imag = cst_alloc(double,x->length);
+    x->imag = cst_alloc(cg_real,x->length);
 
     return;
 }
@@ -155,9 +155,9 @@ DMATRIX xdmalloc(long row, long col)
     int i;
 
     matrix = cst_alloc(struct DMATRIX_STRUCT,1);
-    matrix->data = cst_alloc(double *,row);
+    matrix->data = cst_alloc(cg_real *,row);
     for (i=0; i<row; i++)
-        matrix->data[i] = cst_alloc(double,col);
+        matrix->data[i] = cst_alloc(cg_real,col);
     matrix->imag = NULL;
     matrix->row = row;
     matrix->col = col;
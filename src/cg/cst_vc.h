@@ -42,6 +42,21 @@
 #ifndef __CST_VC_H
 #define __CST_VC_H
 
+/* The arithmetic type for CG parameter generation and the MLSA vocoder. */
+/* Building with -DCST_CG_FLOAT makes it float, which halves the memory */
+/* they move and doubles the SIMD width, for some numeric drift         */
+#include <float.h>
+#include "cst_dsp.h"
+#if defined(CST_CG_FLOAT) || defined(UNDER_CE)
+typedef float cg_real;
+#define CG_REAL_MIN FLT_MIN
+#define cg_dot(A,B,N) (cst_dsp->dot_float((A),(B),(N)))
+#else
+typedef double cg_real;
+#define CG_REAL_MIN DBL_MIN
+#define cg_dot(A,B,N) (cst_dsp->dot((A),(B),(N)))
+#endif
+
 typedef struct LVECTOR_STRUCT {
     long length;
     long *data;
@@ -50,15 +65,15 @@ typedef struct LVECTOR_STRUCT {
 
 typedef struct DVECTOR_STRUCT {
     long length;
-    double *data;
-    double *imag;
+    cg_real *data;
+    cg_real *imag;
 } *DVECTOR;
 
 typedef struct DMATRIX_STRUCT {
     long row;
     long col;
-    double **data;
-    double **imag;
+    cg_real **data;
+    cg_real **imag;
 } *DMATRIX;
 
 #define XBOOL int
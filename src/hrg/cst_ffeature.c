@@ -187,6 +187,34 @@ static const void *internal_ff(const cst_item *item,
     return void_v;
 }
 
+void ff_bind(const cst_features *ffunctions, const char * const *names,
+             int num_names, cst_ffunction *ff)
+{
+    const cst_val *v;
+    int i;
+
+    for (i=0; i<num_names; i++)
+    {
+        v = feat_val(ffunctions,names[i]);
+        ff[i] = (v ? val_ffunc(v) : NULL);
+    }
+}
+
+const cst_val *ffeature_at(const cst_item *item, const char *name,
+                           cst_ffunction ff)
+{
+    const cst_val *v;
+
+    if (item == NULL)
+        v = NULL;
+    else if (ff)
+        v = (*ff)(item);
+    else
+        v = item_feat(item,name);
+
+    return (v ? v : &ffeature_default_val);
+}
+
 void ff_register(cst_features *ffunctions, const char *name, cst_ffunction f)
 {
     /* Register features functions */
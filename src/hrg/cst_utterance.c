@@ -73,6 +73,20 @@ void delete_utterance(cst_utterance *u)
     }
 }
 
+void utt_reset(cst_utterance *u)
+{
+    /* Back to how new_utterance() left it, but the memory for items, */
+    /* relations and features stays in u's context to be reused       */
+    cst_featvalpair *fp;
+
+    for (fp=u->relations->head; fp; fp=fp->next)
+	delete_relation(val_relation(fp->val));
+    feat_clear(u->relations);
+    feat_clear(u->features);
+    feat_clear(u->ffunctions);
+    u->phoneset_accel = NULL;
+}
+
 cst_relation *utt_relation_create(cst_utterance *u,const char *name)
 {
     cst_relation *r;
@@ -41,6 +41,8 @@
 #include "cst_features.h"
 #include "cst_lexicon.h"
 #include "cst_tokenstream.h"
+#include "cst_synth_stats.h"
+#include "cst_thread.h"
 
 CST_VAL_REGISTER_TYPE_NODEL(lexicon,cst_lexicon)
 
@@ -62,16 +64,124 @@ cst_lexicon *new_lexicon()
     return l;
 }
 
+static void delete_lex_cache(cst_lex_cache *c);
+
 void delete_lexicon(cst_lexicon *lex)
 {   /* But I doubt if this will ever be called, lexicons are mapped */
     /* This probably isn't complete */
     if (lex)
     {
+        delete_lex_cache(lex->cache);
 	cst_free(lex->data);
 	cst_free(lex);
     }
 }
 
+/* The cache is direct mapped: a word goes in the slot given by its */
+/* hash, replacing whatever was there                                */
+typedef struct cst_lex_cache_slot_struct {
+    char key[WP_SIZE];          /* pos[0] then word, as for lex_lookup */
+    cst_lex_pron pron;
+} cst_lex_cache_slot;
+
+struct cst_lex_cache_struct {
+    int size;                   /* a power of 2 */
+    cst_lex_cache_slot *slots;
+    cst_mutex *lock;
+};
+
+cst_lex_cache *lex_cache(cst_lexicon *l, int size)
+{
+    cst_lex_cache *c;
+    int n;
+
+    if ((size <= 0) || (l->lts_function != NULL))
+        return NULL;
+
+    cst_global_lock();
+    if (l->cache == NULL)
+    {
+        for (n=1; n < size; n*=2);
+        c = cst_alloc(cst_lex_cache,1);
+        c->size = n;
+        c->slots = cst_alloc(cst_lex_cache_slot,n);
+        c->lock = new_mutex();
+        l->cache = c;
+    }
+    c = l->cache;
+    cst_global_unlock();
+
+    return c;
+}
+
+static void delete_lex_cache(cst_lex_cache *c)
+{
+    if (c)
+    {
+        cst_free(c->slots);
+        delete_mutex(c->lock);
+        cst_free(c);
+    }
+}
+
+static cst_lex_cache_slot *lex_cache_slot(cst_lex_cache *c, const char *wp)
+{
+    unsigned int h = 5381;
+    const char *k;
+
+    for (k=wp; *k; k++)
+        h = (h*33) ^ (unsigned char)*k;
+    return &c->slots[h&(c->size-1)];
+}
+
+static int lex_cache_key(char *wp, const char *word, const char *pos)
+{
+    /* FALSE if the word is too long to be cached */
+    if (cst_strlen(word)+2 > WP_SIZE)
+        return FALSE;
+    wp[0] = (pos ? pos[0] : '0');
+    strcpy(wp+1,word);
+    return TRUE;
+}
+
+int lex_cache_lookup(cst_lex_cache *c, const char *word, const char *pos,
+                     cst_lex_pron *p)
+{
+    char wp[WP_SIZE];
+    cst_lex_cache_slot *s;
+    int found = FALSE;
+
+    if (!lex_cache_key(wp,word,pos))
+        return FALSE;
+    s = lex_cache_slot(c,wp);
+    cst_mutex_lock(c->lock);
+    if (cst_streq(s->key,wp))
+    {
+        memmove(p,&s->pron,sizeof(*p));
+        found = TRUE;
+    }
+    cst_mutex_unlock(c->lock);
+
+    if (found)
+        cst_synth_stats_add(CST_STAT_LEX_CACHE_HITS,1);
+    return found;
+}
+
+void lex_cache_add(cst_lex_cache *c, const char *word, const char *pos,
+                   const cst_lex_pron *p)
+{
+    char wp[WP_SIZE];
+    cst_lex_cache_slot *s;
+
+    if (!lex_cache_key(wp,word,pos))
+        return;
+    s = lex_cache_slot(c,wp);
+    cst_mutex_lock(c->lock);
+    strcpy(s->key,wp);
+    memmove(&s->pron,p,sizeof(*p));
+    cst_mutex_unlock(c->lock);
+}
+
 cst_val *cst_lex_load_addenda(const cst_lexicon *lex, const char *lexfile)
 {   /* Load an addend from given file, check its phones wrt lex */
     cst_tokenstream *lf;
@@ -264,39 +374,45 @@ cst_val *lex_lookup(const cst_lexicon *l, const char *word, const char *pos,
     cst_val *phones = 0;
     int found = FALSE;
 
+    cst_synth_stats_add(CST_STAT_LEX_LOOKUPS,1);
     wp = cst_alloc(char,cst_strlen(word)+2);
     cst_sprintf(wp,"%c%s",(pos ? pos[0] : '0'),word);
 
     if (l->addenda)
 	phones = lex_lookup_addenda(wp,l,&found);
 
-    if (!found)
+    if (found)
+        cst_synth_stats_add(CST_STAT_LEX_HITS,1);
+    else
     {
 	index = lex_lookup_bsearch(l,wp);
 
 	if (index >= 0)
 	{
+            cst_synth_stats_add(CST_STAT_LEX_HITS,1);
 	    if (l->phone_hufftable)
 	    {
 		for (p=index-2; l->data[p]; p--)
 		    for (q=l->phone_hufftable[l->data[p]]; *q; q++)
-			phones = cons_val(string_val(l->phone_table[(unsigned char)*q]),
+			phones = cons_val(atom_val(l->phone_table[(unsigned char)*q]),
 				  phones);
 	    }
 	    else  /* no compression -- should we still support this ? */
 	    {
 		for (p=index-2; l->data[p]; p--)
-		    phones = cons_val(string_val(l->phone_table[l->data[p]]),
+		    phones = cons_val(atom_val(l->phone_table[l->data[p]]),
 				      phones);
 	    }
 	    phones = val_reverse(phones);
 	}
 	else if (l->lts_function)
 	{
+            cst_synth_stats_add(CST_STAT_LEX_LTS,1);
 	    phones = (l->lts_function)(l,word,"",feats);
 	}
 	else if (l->lts_rule_set)
 	{
+            cst_synth_stats_add(CST_STAT_LEX_LTS,1);
 	    phones = lts_apply(word,
 			       "",  /* more features if we had them */
 			       l->lts_rule_set);
@@ -325,7 +441,7 @@ static cst_val *lex_lookup_addenda(const char *wp,const cst_lexicon *l,
 	    (cst_streq(wp+1,l->addenda[i][0]+1)))
 	{
 	    for (j=1; l->addenda[i][j]; j++)
-		phones = cons_val(string_val(l->addenda[i][j]),phones);
+		phones = cons_val(atom_val(l->addenda[i][j]),phones);
 	    *found = TRUE;
 	    return val_reverse(phones);
 	}
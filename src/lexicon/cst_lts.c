@@ -99,7 +99,6 @@ cst_val *lts_apply(const char *word,const char *feats,const cst_lts_rules *r)
     cst_lts_letter *fval_buff;
     cst_lts_letter *full_buff;
     cst_lts_phone phone;
-    char *left, *right;
     const char *p;
     char hash;
     char zeros[8];
@@ -175,18 +174,12 @@ cst_val *lts_apply(const char *word,const char *feats,const cst_lts_rules *r)
 	    continue;
 	else if ((p=strchr(r->phone_table[phone],'-')) != NULL)
 	{
-	    left = cst_substr(r->phone_table[phone],0,
-			      cst_strlen(r->phone_table[phone])-cst_strlen(p));
-	    right = cst_substr(r->phone_table[phone],
-			       (cst_strlen(r->phone_table[phone])-cst_strlen(p))+1,
-			       (cst_strlen(p)-1));
-	    phones = cons_val(string_val(left),
-			      cons_val(string_val(right),phones));
-	    cst_free(left);
-	    cst_free(right);
+	    phones = cons_val(atom_val_n(r->phone_table[phone],
+					 p-r->phone_table[phone]),
+			      cons_val(atom_val(p+1),phones));
 	}
 	else
-	    phones = cons_val(string_val(r->phone_table[phone]),phones);
+	    phones = cons_val(atom_val(r->phone_table[phone]),phones);
     }
 
     cst_free(full_buff);
@@ -38,6 +38,7 @@
 /*                                                                       */
 /*************************************************************************/
 #include "cst_string.h"
+#include "cst_math.h"
 #include "cst_val.h"
 #include "cst_wave.h"
 
@@ -129,3 +130,103 @@ cst_wave *concat_wave(cst_wave *dest, const cst_wave *src)
 
     return dest;
 }
+
+#define SD_PI 3.14159265358979323846
+#define SD_FRAME 512   /* a power of 2 */
+#define SD_SILENCE 1.0e4  /* frames quieter than this in both are skipped */
+
+static void sd_fft(float *re, float *im, int n)
+{
+    /* In place radix 2 FFT */
+    int i, j, k, m;
+    float tr, ti, wr, wi, a;
+
+    for (i=1, j=0; i<n; i++)
+    {
+        for (k=n>>1; j&k; k>>=1)
+            j ^= k;
+        j ^= k;
+        if (i < j)
+        {
+            tr = re[i]; re[i] = re[j]; re[j] = tr;
+            ti = im[i]; im[i] = im[j]; im[j] = ti;
+        }
+    }
+    for (m=2; m<=n; m<<=1)
+        for (k=0; k<m/2; k++)
+        {
+            a = -2.0*SD_PI*k/m;
+            wr = cos(a);
+            wi = sin(a);
+            for (i=k; i<n; i+=m)
+            {
+                j = i+m/2;
+                tr = wr*re[j] - wi*im[j];
+                ti = wr*im[j] + wi*re[j];
+                re[j] = re[i] - tr;
+                im[j] = im[i] - ti;
+                re[i] += tr;
+                im[i] += ti;
+            }
+        }
+}
+
+static void sd_power(const cst_wave *w, int start, float *window,
+                     float *re, float *im)
+{
+    int i;
+
+    for (i=0; i<SD_FRAME; i++)
+    {
+        re[i] = window[i] * w->samples[(start+i)*w->num_channels];
+        im[i] = 0.0;
+    }
+    sd_fft(re,im,SD_FRAME);
+    for (i=0; i<=SD_FRAME/2; i++)
+        re[i] = re[i]*re[i] + im[i]*im[i];
+}
+
+float cst_wave_spectral_distance(const cst_wave *a, const cst_wave *b)
+{
+    float *window, *pa, *pb, *im;
+    double d, e, ea, eb, sum;
+    int i, start, n, frames;
+
+    if (a->sample_rate != b->sample_rate)
+    {
+        cst_errmsg("cst_wave_spectral_distance: sample rate mismatch (%d != %d)\n",
+                   a->sample_rate, b->sample_rate);
+        return -1.0;
+    }
+    n = (a->num_samples < b->num_samples) ? a->num_samples : b->num_samples;
+
+    window = cst_alloc(float,SD_FRAME*4);
+    pa = window+SD_FRAME;
+    pb = pa+SD_FRAME;
+    im = pb+SD_FRAME;
+    for (i=0; i<SD_FRAME; i++)  /* Hanning */
+        window[i] = 0.5 - 0.5*cos(2.0*SD_PI*i/(SD_FRAME-1));
+
+    for (sum=0.0, frames=0, start=0; start+SD_FRAME <= n; start+=SD_FRAME/2)
+    {
+        sd_power(a,start,window,pa,im);
+        sd_power(b,start,window,pb,im);
+        for (ea=eb=0.0, i=0; i<=SD_FRAME/2; i++)
+        {
+            ea += pa[i];
+            eb += pb[i];
+        }
+        if ((ea < SD_SILENCE*SD_FRAME) && (eb < SD_SILENCE*SD_FRAME))
+            continue;
+        for (d=0.0, i=0; i<=SD_FRAME/2; i++)
+        {
+            e = 10.0*log10((pa[i]+1.0)/(pb[i]+1.0));
+            d += e*e;
+        }
+        sum += sqrt(d/(SD_FRAME/2+1));
+        frames++;
+    }
+    cst_free(window);
+
+    return (frames > 0) ? sum/frames : 0.0;
+}
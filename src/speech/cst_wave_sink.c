@@ -0,0 +1,348 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Wave output sinks: a run of waves written to one open file, through  */
+/*  a buffer, with the header fixed up at the end (or at checkpoints)    */
+/*                                                                       */
+/*************************************************************************/
+#include "cst_string.h"
+#include "cst_wave.h"
+
+#define SINK_RIFF   0
+#define SINK_RAW    1
+#define SINK_SND    2
+#define SINK_STREAM 3
+
+#define SINK_BUFFER_SIZE (64*1024)
+#define SINK_UNKNOWN_SIZE 0xffffffff
+
+struct cst_wave_sink_struct {
+    cst_file fd;
+    int own_fd;             /* opened here, so closed here */
+    int type;
+    int seekable;           /* so the header can be fixed up */
+    long header_pos;        /* where the header starts in fd */
+    int header_written;
+    int sample_rate;
+    int num_channels;
+    unsigned int data_bytes;
+    float checkpoint;       /* seconds between header fix ups, 0 for none */
+    int since_checkpoint;   /* samples */
+    unsigned char *buf;
+    int buf_len;
+    int error;
+};
+
+static void put_le32(unsigned char *b, unsigned int v)
+{
+    b[0] = v & 0xff; b[1] = (v >> 8) & 0xff;
+    b[2] = (v >> 16) & 0xff; b[3] = (v >> 24) & 0xff;
+}
+
+static void put_le16(unsigned char *b, unsigned int v)
+{
+    b[0] = v & 0xff; b[1] = (v >> 8) & 0xff;
+}
+
+static void put_be32(unsigned char *b, unsigned int v)
+{
+    b[0] = (v >> 24) & 0xff; b[1] = (v >> 16) & 0xff;
+    b[2] = (v >> 8) & 0xff; b[3] = v & 0xff;
+}
+
+static int sink_header(const cst_wave_sink *s, unsigned char *h,
+                       unsigned int data_bytes)
+{
+    /* Fills in h, and returns its size */
+    if (s->type == SINK_RIFF)
+    {
+        memmove(h,"RIFF",4);
+        if (data_bytes == SINK_UNKNOWN_SIZE)
+            put_le32(h+4,SINK_UNKNOWN_SIZE);
+        else
+            put_le32(h+4,data_bytes+8+16+12);
+        memmove(h+8,"WAVEfmt ",8);
+        put_le32(h+16,16);
+        put_le16(h+20,RIFF_FORMAT_PCM);
+        put_le16(h+22,s->num_channels);
+        put_le32(h+24,s->sample_rate);
+        put_le32(h+28,s->sample_rate*s->num_channels*sizeof(short));
+        put_le16(h+32,s->num_channels*sizeof(short));
+        put_le16(h+34,2*8);
+        memmove(h+36,"data",4);
+        put_le32(h+40,data_bytes);
+        return 44;
+    }
+    else if (s->type == SINK_SND)
+    {
+        put_be32(h,CST_SND_MAGIC);
+        put_be32(h+4,24);
+        put_be32(h+8,data_bytes);
+        put_be32(h+12,CST_SND_SHORT);
+        put_be32(h+16,s->sample_rate);
+        put_be32(h+20,s->num_channels);
+        return 24;
+    }
+    return 0;
+}
+
+static void sink_flush(cst_wave_sink *s)
+{
+    if ((s->buf_len > 0) &&
+        (cst_fwrite(s->fd,s->buf,1,s->buf_len) != s->buf_len))
+        s->error = TRUE;
+    s->buf_len = 0;
+}
+
+static void sink_put(cst_wave_sink *s, const void *data, int n)
+{
+    if (s->buf_len + n > SINK_BUFFER_SIZE)
+        sink_flush(s);
+    if (n >= SINK_BUFFER_SIZE)
+    {   /* big enough to go straight out */
+        if (cst_fwrite(s->fd,data,1,n) != n)
+            s->error = TRUE;
+    }
+    else
+    {
+        memmove(s->buf+s->buf_len,data,n);
+        s->buf_len += n;
+    }
+}
+
+static void sink_put_samples(cst_wave_sink *s, const short *samples, int n,
+                             int big_endian)
+{
+    /* In the file's byte order, which may not be ours */
+    unsigned char *b;
+    int i, m;
+
+    if ((big_endian && CST_BIG_ENDIAN) || (!big_endian && CST_LITTLE_ENDIAN))
+    {
+        sink_put(s,samples,n*sizeof(short));
+        return;
+    }
+    while (n > 0)
+    {
+        if (s->buf_len + 2 > SINK_BUFFER_SIZE)
+            sink_flush(s);
+        m = (SINK_BUFFER_SIZE - s->buf_len) / 2;
+        if (m > n) m = n;
+        b = s->buf + s->buf_len;
+        if (big_endian)
+            for (i=0; i < m; i++)
+            {
+                b[2*i] = (samples[i] >> 8) & 0xff;
+                b[2*i+1] = samples[i] & 0xff;
+            }
+        else
+            for (i=0; i < m; i++)
+            {
+                b[2*i] = samples[i] & 0xff;
+                b[2*i+1] = (samples[i] >> 8) & 0xff;
+            }
+        s->buf_len += m*2;
+        samples += m;
+        n -= m;
+    }
+}
+
+static void sink_fix_header(cst_wave_sink *s)
+{
+    /* Write the header again, now the sizes are known */
+    unsigned char h[44];
+    int n;
+    long end;
+
+    sink_flush(s);
+    n = sink_header(s,h,s->data_bytes);
+    if ((n == 0) || !s->seekable)
+        return;
+    end = cst_ftell(s->fd);
+    cst_fseek(s->fd,s->header_pos,CST_SEEK_ABSOLUTE);
+    if (cst_fwrite(s->fd,h,1,n) != n)
+        s->error = TRUE;
+    cst_fseek(s->fd,end,CST_SEEK_ABSOLUTE);
+}
+
+static cst_wave_sink *new_wave_sink(cst_file fd, const char *type)
+{
+    cst_wave_sink *s;
+    int t;
+
+    if (cst_streq(type,"riff"))
+        t = SINK_RIFF;
+    else if (cst_streq(type,"raw"))
+        t = SINK_RAW;
+    else if (cst_streq(type,"snd") || cst_streq(type,"au"))
+        t = SINK_SND;
+    else if (cst_streq(type,"stream"))
+        t = SINK_STREAM;
+    else
+    {
+	cst_errmsg("cst_wave_sink: unsupported wavetype \"%s\"\n",
+		   type);
+	return NULL;
+    }
+
+    s = cst_alloc(cst_wave_sink,1);
+    s->fd = fd;
+    s->type = t;
+    /* fd may already have something before us */
+    s->header_pos = cst_ftell(fd);
+    s->seekable = (s->header_pos >= 0);
+    s->sample_rate = 16000;  /* if nothing is ever written */
+    s->num_channels = 1;
+    s->buf = cst_alloc(unsigned char,SINK_BUFFER_SIZE);
+
+    return s;
+}
+
+cst_wave_sink *cst_wave_sink_open(const char *filename, const char *type)
+{
+    cst_file fd;
+    cst_wave_sink *s;
+
+    if ((fd = cst_fopen(filename,CST_OPEN_WRITE|CST_OPEN_BINARY)) == NULL)
+    {
+	cst_errmsg("cst_wave_sink: can't open file \"%s\"\n",
+		   filename);
+	return NULL;
+    }
+    if ((s = new_wave_sink(fd,type)) == NULL)
+    {
+        cst_fclose(fd);
+        return NULL;
+    }
+    s->own_fd = TRUE;
+
+    return s;
+}
+
+cst_wave_sink *cst_wave_sink_open_fd(cst_file fd, const char *type)
+{
+    return new_wave_sink(fd,type);
+}
+
+void cst_wave_sink_set_checkpoint(cst_wave_sink *s, float seconds)
+{
+    s->checkpoint = seconds;
+}
+
+int cst_wave_sink_write(cst_wave_sink *s, const cst_wave *w)
+{
+    unsigned char h[44];
+    int n, num;
+
+    num = cst_wave_num_samples(w)*cst_wave_num_channels(w);
+    if (!s->header_written)
+    {
+        s->sample_rate = w->sample_rate;
+        s->num_channels = w->num_channels;
+        n = sink_header(s,h,s->seekable ? 0 : SINK_UNKNOWN_SIZE);
+        sink_put(s,h,n);
+        s->header_written = TRUE;
+    }
+    else if (s->type != SINK_STREAM)
+        /* The header has room for one, so like cst_wave_append_riff() */
+        /* it ends up with the last one                                */
+        s->sample_rate = w->sample_rate;
+
+    if (s->type == SINK_STREAM)
+    {   /* each wave is a frame of its own */
+        memmove(h,"WAVF",4);
+        put_le32(h+4,w->sample_rate);
+        put_le32(h+8,w->num_channels);
+        put_le32(h+12,num);
+        sink_put(s,h,16);
+    }
+
+    if (num > 0)
+        sink_put_samples(s,w->samples,num,
+                         (s->type == SINK_SND) ||
+                         ((s->type == SINK_RAW) && CST_BIG_ENDIAN));
+    s->data_bytes += num*sizeof(short);
+
+    s->since_checkpoint += cst_wave_num_samples(w);
+    if ((s->checkpoint > 0) &&
+        (s->since_checkpoint >= s->checkpoint*s->sample_rate))
+    {
+        sink_fix_header(s);
+        s->since_checkpoint = 0;
+    }
+
+    return s->error ? -1 : 0;
+}
+
+int cst_wave_sink_checkpoint(cst_wave_sink *s)
+{
+    sink_fix_header(s);
+    s->since_checkpoint = 0;
+    return s->error ? -1 : 0;
+}
+
+int cst_wave_sink_close(cst_wave_sink *s)
+{
+    unsigned char h[44];
+    int n, rv;
+
+    if (s == NULL)
+        return -1;
+
+    if (s->type == SINK_STREAM)
+    {   /* an empty frame marks the end */
+        memmove(h,"WAVF",4);
+        put_le32(h+4,s->sample_rate);
+        put_le32(h+8,s->num_channels);
+        put_le32(h+12,0);
+        sink_put(s,h,16);
+    }
+    else if (!s->header_written)
+    {   /* nothing was written, so an empty wave */
+        n = sink_header(s,h,0);
+        sink_put(s,h,n);
+        s->header_written = TRUE;
+    }
+    sink_fix_header(s);
+
+    rv = s->error ? -1 : 0;
+    if (s->own_fd)
+        cst_fclose(s->fd);
+    cst_free(s->buf);
+    cst_free(s);
+
+    return rv;
+}
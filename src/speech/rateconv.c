@@ -154,6 +154,7 @@
 #include "cst_alloc.h"
 #include "cst_error.h"
 #include "cst_wave.h"
+#include "cst_dsp.h"
 
 /*
  *	adaptable defines and globals
@@ -177,26 +178,7 @@
 static void
 fir_mono(int *inp, int *coep, int firlen, int *outp)
 {
-	int akku = 0, *endp;
-	int n1 = (firlen / 8) * 8, n0 = firlen % 8;
-
-	endp = coep + n1;
-	while (coep != endp) {
-		akku += *inp++ * *coep++;
-		akku += *inp++ * *coep++;
-		akku += *inp++ * *coep++;
-		akku += *inp++ * *coep++;
-		akku += *inp++ * *coep++;
-		akku += *inp++ * *coep++;
-		akku += *inp++ * *coep++;
-		akku += *inp++ * *coep++;
-	}
-
-	endp = coep + n0;
-	while (coep != endp) {
-		akku += *inp++ * *coep++;
-	}
-	*outp = akku;
+	*outp = cst_dsp->dot_int(inp, coep, firlen);
 }
 
 static void
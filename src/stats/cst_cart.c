@@ -40,8 +40,10 @@
 
 #include "cst_regex.h"
 #include "cst_cart.h"
+#include "cst_synth_stats.h"
 
 CST_VAL_REGISTER_TYPE_NODEL(cart,cst_cart)
+CST_VAL_REGISTER_TYPE_NODEL(cart_compiled,cst_cart_compiled)
 
 /* Make this 1 if you want to debug some cart calls */
 #define CART_DEBUG 0
@@ -108,6 +110,7 @@ const cst_val *cart_interpret(cst_item *item, const cst_cart *tree)
     int r=0;
     int node=0;
 
+    cst_synth_stats_add(CST_STAT_CART_EVALS,1);
     fcache = new_features_local(item_utt(item)->ctx);
 
     while (cst_cart_node_op(node,tree) != CST_CART_OP_LEAF)
@@ -170,3 +173,11 @@ const cst_val *cart_interpret(cst_item *item, const cst_cart *tree)
     return cst_cart_node_val(node,tree);	
 
 }
+
+const cst_val *cart_interpret_compiled(cst_item *item,
+                                       const cst_cart_compiled *c,
+                                       const cst_ffunction *ff)
+{
+    cst_synth_stats_add(CST_STAT_CART_EVALS,1);
+    return (c->interpret)(item,ff);
+}
@@ -50,6 +50,11 @@ static void vit_add_paths(cst_viterbi *vd,
 static void vit_add_path(cst_viterbi *vd,cst_vit_point *p, cst_vit_path *np);
 static cst_vit_path *find_best_path(cst_viterbi *vd);
 static int betterthan(cst_viterbi *v,int a, int b);
+static void vit_add_beam_paths(cst_vit_point *point, cst_vit_path *path);
+static void vit_prune_beam(cst_viterbi *vd, cst_vit_point *point);
+static int vit_beam_threshold(cst_viterbi *vd, int *scores, int n);
+static void viterbi_decode_array(cst_viterbi *vd);
+static int vit_best_state(cst_viterbi *vd);
 
 cst_vit_cand *new_vit_cand()
 {
@@ -139,12 +144,27 @@ cst_viterbi *new_viterbi(cst_vit_cand_f_t *cand_func,
     return v;
 }
 
+cst_viterbi *new_viterbi_array(cst_vit_states_f_t *states_func,
+                               cst_vit_join_f_t *join_func)
+{
+    cst_viterbi *v = cst_alloc(struct cst_viterbi_struct,1);
+
+    v->states_func = states_func;
+    v->join_func = join_func;
+    v->f = new_features();
+    v->pool = new_pool(16384);
+    return v;
+}
+
 void delete_viterbi(cst_viterbi *vd)
 {
     if (vd)
     {
 	delete_vit_point(vd->timeline);
 	delete_features(vd->f);
+        if (vd->pool)
+            delete_pool(vd->pool);
+        cst_free(vd->scratch);
 	cst_free(vd);
     }
 
@@ -156,6 +176,17 @@ void viterbi_initialise(cst_viterbi *vd,cst_relation *r)
     cst_item *i;
     cst_vit_point *last = 0;
     cst_vit_point *n = 0;
+    int t;
+
+    if (vd->join_func)
+    {   /* array based, just a column for each item */
+        for (vd->num_columns=0,i=relation_head(r); i; i=item_next(i))
+            vd->num_columns++;
+        vd->columns = cst_pool_new(vd->pool,cst_vit_column,vd->num_columns);
+        for (t=0,i=relation_head(r); i; i=item_next(i),t++)
+            vd->columns[t].item = i;
+        return;
+    }
 
     /* Construct the timeline with points for each item in relation */
     /* initiallising the state tables at each point                 */
@@ -209,8 +240,15 @@ void viterbi_decode(cst_viterbi *vd)
     cst_vit_point *p;
     cst_vit_path *np;
     cst_vit_cand *c;
+    cst_vit_path *t;
     int i;
 
+    if (vd->join_func)
+    {
+        viterbi_decode_array(vd);
+        return;
+    }
+
     /* For each time point */
     for (p=vd->timeline; p->next != NULL; p=p->next)
     {
@@ -235,21 +273,285 @@ void viterbi_decode(cst_viterbi *vd)
 	}
 	else                      /* general beam search */
 	{
-	    cst_errmsg("viterbi, general beam search not implemented\n");
-/*
 	    for (t=p->paths; t; t=t->next)
 	    {
 		for (c=p->cands; c; c=c->next)
 		{
-		    np = (vd->path_func)(t,c,vd);
-		    add_path(p->next,np);
+		    np = (*vd->path_func)(t,c,vd);
+		    vit_add_beam_paths(p->next,np);
 		}
 	    }
-*/
+            vit_prune_beam(vd,p->next);
 	}
     }
 }
 
+static void vit_add_beam_paths(cst_vit_point *point, cst_vit_path *path)
+{
+    cst_vit_path *p, *next_p;
+
+    for (p=path; p; p=next_p)
+    {
+	next_p = p->next;
+        p->next = point->paths;
+        point->paths = p;
+        point->num_paths++;
+    }
+}
+
+static void vit_prune_beam(cst_viterbi *vd, cst_vit_point *point)
+{
+    /* Keep the best beam_width paths, earlier ones win ties */
+    cst_vit_path **paths, *p;
+    int *scores;
+    int i, n, threshold, keep_equal;
+
+    if ((vd->beam_width <= 0) || (point->num_paths <= vd->beam_width))
+        return;
+
+    n = point->num_paths;
+    paths = cst_alloc(cst_vit_path *,n);
+    scores = cst_alloc(int,n);
+    /* the list was built backwards, so put it back in order */
+    for (i=n-1,p=point->paths; p; p=p->next,i--)
+    {
+        paths[i] = p;
+        scores[i] = p->score;
+    }
+    threshold = vit_beam_threshold(vd,scores,n);
+    for (keep_equal=vd->beam_width,i=0; i<n; i++)
+        if (betterthan(vd,paths[i]->score,threshold))
+            keep_equal--;
+
+    point->paths = 0;
+    point->num_paths = 0;
+    for (i=n-1; i>=0; i--)
+        paths[i]->next = 0;
+    for (i=0; i<n; i++)
+    {
+        if (betterthan(vd,paths[i]->score,threshold) ||
+            ((paths[i]->score == threshold) && (keep_equal-- > 0)))
+            vit_add_beam_paths(point,paths[i]);
+        else
+            delete_vit_path(paths[i]);
+    }
+    cst_free(scores);
+    cst_free(paths);
+}
+
+static int vit_beam_threshold(cst_viterbi *vd, int *scores, int n)
+{
+    /* Find the score of the beam_width'th best, partially sorting */
+    /* scores as a side effect                                      */
+    int i, j, b, x;
+
+    for (i=0; i<vd->beam_width; i++)
+    {
+        for (b=i,j=i+1; j<n; j++)
+            if (betterthan(vd,scores[j],scores[b]))
+                b = j;
+        x = scores[i];
+        scores[i] = scores[b];
+        scores[b] = x;
+    }
+    return scores[vd->beam_width-1];
+}
+
+cst_vit_state *viterbi_add_state(cst_viterbi *vd, cst_vit_column *col,
+                                 int ival, int score)
+{
+    /* Candidates are collected in a scratch array that is reused for */
+    /* every column, the decoder copies them into the pool after      */
+    cst_vit_state *s;
+
+    if (col->num_states == vd->scratch_size)
+    {
+        vd->scratch_size = (vd->scratch_size == 0) ? 64 : vd->scratch_size*2;
+        vd->scratch = cst_realloc(vd->scratch,cst_vit_state,vd->scratch_size);
+    }
+    col->states = vd->scratch;
+    s = &vd->scratch[col->num_states++];
+    s->ival = ival;
+    s->score = score;
+    s->path_score = 0;
+    s->from = -1;
+    s->prev_move = s->this_move = -1;
+
+    return s;
+}
+
+static void vit_column_score(cst_viterbi *vd,
+                             const cst_vit_column *prev,
+                             cst_vit_column *col,
+                             int start, int end)
+{
+    /* Best path to states start .. end-1 in col, earlier states in prev */
+    /* win ties just like the order paths are added in the list based    */
+    /* version.  Each state only depends on prev so ranges can be done   */
+    /* in parallel and still give exactly the same answer                */
+    cst_vit_state *c;
+    const cst_vit_state *p;
+    int i, k, cost, score, prev_move, this_move;
+
+    for (k=start; k < end; k++)
+    {
+        c = &col->states[k];
+        if (prev == NULL)
+        {
+            c->path_score = c->score;
+            continue;
+        }
+        for (i=0; i < prev->num_states; i++)
+        {
+            p = &prev->states[i];
+            prev_move = this_move = -1;
+            cost = (*vd->join_func)(p,c,&prev_move,&this_move,vd);
+            score = cost + c->score + p->path_score;
+            if ((c->from == -1) || betterthan(vd,score,c->path_score))
+            {
+                c->path_score = score;
+                c->from = i;
+                c->prev_move = prev_move;
+                c->this_move = this_move;
+            }
+        }
+    }
+}
+
+/* Minimum number of joins in a column before it is split over threads */
+#define VIT_PARALLEL_MIN_JOINS 64
+
+typedef struct vit_column_job_struct {
+    cst_viterbi *vd;
+    const cst_vit_column *prev;
+    cst_vit_column *col;
+    int chunk;
+} vit_column_job;
+
+static void vit_column_task(void *arg, int task)
+{
+    vit_column_job *job = (vit_column_job *)arg;
+    int start, end;
+
+    start = task * job->chunk;
+    end = start + job->chunk;
+    if (end > job->col->num_states)
+        end = job->col->num_states;
+    vit_column_score(job->vd,job->prev,job->col,start,end);
+}
+
+static void vit_column_score_parallel(cst_viterbi *vd,
+                                      const cst_vit_column *prev,
+                                      cst_vit_column *col)
+{
+    vit_column_job job;
+    int num_tasks;
+
+    if ((vd->workers == NULL) || (prev == NULL) ||
+        (thread_pool_size(vd->workers) < 2) ||
+        (prev->num_states * col->num_states < VIT_PARALLEL_MIN_JOINS))
+    {
+        vit_column_score(vd,prev,col,0,col->num_states);
+        return;
+    }
+
+    /* a few tasks per thread so uneven join costs balance out */
+    num_tasks = thread_pool_size(vd->workers) * 4;
+    if (num_tasks > col->num_states)
+        num_tasks = col->num_states;
+    job.vd = vd;
+    job.prev = prev;
+    job.col = col;
+    job.chunk = (col->num_states + num_tasks - 1) / num_tasks;
+    num_tasks = (col->num_states + job.chunk - 1) / job.chunk;
+
+    thread_pool_run(vd->workers,vit_column_task,&job,num_tasks);
+}
+
+static void vit_column_prune(cst_viterbi *vd, cst_vit_column *col)
+{
+    /* Keep the best beam_width states, keeping their order */
+    int *scores;
+    int i, n, threshold, keep_equal;
+
+    scores = cst_pool_new(vd->pool,int,col->num_states);
+    for (i=0; i<col->num_states; i++)
+        scores[i] = col->states[i].path_score;
+    threshold = vit_beam_threshold(vd,scores,col->num_states);
+    for (keep_equal=vd->beam_width,i=0; i<col->num_states; i++)
+        if (betterthan(vd,col->states[i].path_score,threshold))
+            keep_equal--;
+
+    for (n=0,i=0; i<col->num_states; i++)
+        if (betterthan(vd,col->states[i].path_score,threshold) ||
+            ((col->states[i].path_score == threshold) && (keep_equal-- > 0)))
+            col->states[n++] = col->states[i];
+    col->num_states = n;
+}
+
+static void viterbi_decode_array(cst_viterbi *vd)
+{
+    cst_vit_column *prev = NULL, *col;
+    cst_vit_state *states;
+    int t;
+
+    for (t=0; t < vd->num_columns; t++)
+    {
+        col = &vd->columns[t];
+        col->num_states = 0;
+        col->states = NULL;
+        (*vd->states_func)(col->item,prev,col,vd);
+        if ((prev != NULL) && (prev->num_states == 0))
+            col->num_states = 0;  /* no way to get here */
+        if (col->num_states > 0)
+        {
+            states = cst_pool_new(vd->pool,cst_vit_state,col->num_states);
+            memmove(states,col->states,col->num_states*sizeof(cst_vit_state));
+            col->states = states;
+        }
+
+        vit_column_score_parallel(vd,prev,col);
+        if ((vd->beam_width > 0) && (col->num_states > vd->beam_width))
+            vit_column_prune(vd,col);
+        prev = col;
+    }
+}
+
+static int vit_best_state(cst_viterbi *vd)
+{
+    const cst_vit_column *last;
+    int i, best;
+
+    last = &vd->columns[vd->num_columns-1];
+    for (best=-1,i=0; i < last->num_states; i++)
+        if ((best == -1) ||
+            betterthan(vd,last->states[i].path_score,
+                       last->states[best].path_score))
+            best = i;
+
+    return best;
+}
+
+void viterbi_copy_moves(cst_viterbi *vd,
+                        const char *prev_name, const char *this_name)
+{
+    /* copy the join points on the best path to the related items */
+    const cst_vit_state *s;
+    int t, b;
+
+    if (vd->num_columns == 0)
+        return;
+    for (b=vit_best_state(vd),t=vd->num_columns-1; (b != -1) && (t >= 0); t--)
+    {
+        s = &vd->columns[t].states[b];
+        if (s->prev_move != -1)
+            item_set_int(vd->columns[t].item,prev_name,s->prev_move);
+        if (s->this_move != -1)
+            item_set_int(vd->columns[t].item,this_name,s->this_move);
+        b = s->from;
+    }
+}
+
 static void vit_add_paths(cst_viterbi *vd,
 			  cst_vit_point *point,
 			  cst_vit_path *path)
@@ -284,6 +586,26 @@ int viterbi_result(cst_viterbi *vd,const char *n)
     /* Find best path through the decoder, adding field to item named n */
     /* with choising value                                              */
     cst_vit_path *p;
+    const cst_vit_state *s;
+    int t, b;
+
+    if (vd->join_func)
+    {
+        if (vd->num_columns == 0)
+            return TRUE;
+        b = vit_best_state(vd);
+        if (b == -1)
+            return FALSE;
+        for (t=vd->num_columns-1; t >= 0; t--)
+        {
+            s = &vd->columns[t].states[b];
+            item_set_int(vd->columns[t].item,"cl_total_score",s->path_score);
+            item_set_int(vd->columns[t].item,"cl_cand_score",s->score);
+            item_set_int(vd->columns[t].item,n,s->ival);
+            b = s->from;
+        }
+        return TRUE;
+    }
 
     if ((vd->timeline == 0) || (vd->timeline->next == 0))
 	return TRUE;  /* it has succeeded in the null case */
@@ -322,7 +644,7 @@ static cst_vit_path *find_best_path(cst_viterbi *vd)
 {
     cst_vit_point *t;
     int best,worst;
-    cst_vit_path *best_p=NULL;
+    cst_vit_path *best_p=NULL, *p;
     int i;
 
     if (vd->big_is_good)
@@ -333,7 +655,16 @@ static cst_vit_path *find_best_path(cst_viterbi *vd)
 
     t = vd->last_point;
 
-    if (vd->num_states != 0)
+    if (vd->num_states == 0)
+    {
+        for (p=t->paths; p; p=p->next)
+            if (p->cand && betterthan(vd,p->score,best))
+            {
+                best = p->score;
+                best_p = p;
+            }
+    }
+    else
     {
 	for (i=0; i<t->num_states; i++)
 	{
@@ -62,35 +62,35 @@ DEF_STATIC_CONST_VAL_STRING(val_string_empty,"");
 
 const cst_val *ph_vc(const cst_item *p)
 {
-    return phone_feature(item_phoneset(p),item_name(p),"vc");
+    return item_phone_feature(p,"vc");
 }
 const cst_val *ph_vlng(const cst_item *p)
 {
-    return phone_feature(item_phoneset(p),item_name(p),"vlng");
+    return item_phone_feature(p,"vlng");
 }
 const cst_val *ph_vheight(const cst_item *p)
 {
-   return phone_feature(item_phoneset(p),item_name(p),"vheight");
+   return item_phone_feature(p,"vheight");
 }
 const cst_val *ph_vrnd(const cst_item *p)
 {
-    return phone_feature(item_phoneset(p),item_name(p),"vrnd");
+    return item_phone_feature(p,"vrnd");
 }
 const cst_val *ph_vfront(const cst_item *p)
 {
-    return phone_feature(item_phoneset(p),item_name(p),"vfront");
+    return item_phone_feature(p,"vfront");
 }
 const cst_val *ph_ctype(const cst_item *p)
 {
-    return phone_feature(item_phoneset(p),item_name(p),"ctype");
+    return item_phone_feature(p,"ctype");
 }
 const cst_val *ph_cplace(const cst_item *p)
 {
-    return phone_feature(item_phoneset(p),item_name(p),"cplace");
+    return item_phone_feature(p,"cplace");
 }
 const cst_val *ph_cvox(const cst_item *p)
 {
-    return phone_feature(item_phoneset(p),item_name(p),"cvox");
+    return item_phone_feature(p,"cvox");
 }
 
 const cst_val *cg_duration(const cst_item *p)
@@ -286,12 +286,12 @@ const cst_val *syl_vowel(const cst_item *p)
 	{
             if (cst_streq("+",val_string(ph_vc(s))))
             { 
-                return string_val(item_name(s));
+                return atom_val(item_name(s));
             }
 	}
 	if (cst_streq("+",val_string(ph_vc(s))))
         { 
-            return string_val(item_name(s));
+            return atom_val(item_name(s));
         }
 	return (cst_val *) NULL;
 }
@@ -349,17 +349,17 @@ static const cst_val *accented(const cst_item *syl)
 static const cst_val *seg_coda_ctype(const cst_item *seg, const char *ctype)
 {
     const cst_item *s;
-    const cst_phoneset *ps = item_phoneset(seg);
+    const cst_phoneset_accel *pa = item_phoneset_accel(seg);
     
     for (s=item_last_daughter(item_parent(item_as(seg,"SylStructure")));
 	 s;
 	 s=item_prev(s))
     {
-	if (cst_streq("+",phone_feature_string(ps,item_feat_string(s,"name"),
-					       "vc")))
+	if (cst_streq("+",val_string(phoneset_accel_feature(pa,
+                                     item_feat_string(s,"name"),"vc"))))
 	    return VAL_STRING_0;
-	if (cst_streq(ctype,phone_feature_string(ps,item_feat_string(s,"name"),
-					       "ctype")))
+	if (cst_streq(ctype,val_string(phoneset_accel_feature(pa,
+                                     item_feat_string(s,"name"),"ctype"))))
 	    return VAL_STRING_1;
     }
 
@@ -369,17 +369,17 @@ static const cst_val *seg_coda_ctype(const cst_item *seg, const char *ctype)
 static const cst_val *seg_onset_ctype(const cst_item *seg, const char *ctype)
 {
     const cst_item *s;
-    const cst_phoneset *ps = item_phoneset(seg);
+    const cst_phoneset_accel *pa = item_phoneset_accel(seg);
     
     for (s=item_daughter(item_parent(item_as(seg,"SylStructure")));
 	 s;
 	 s=item_next(s))
     {
-	if (cst_streq("+",phone_feature_string(ps,item_feat_string(s,"name"),
-					       "vc")))
+	if (cst_streq("+",val_string(phoneset_accel_feature(pa,
+                                     item_feat_string(s,"name"),"vc"))))
 	    return VAL_STRING_0;
-	if (cst_streq(ctype,phone_feature_string(ps,item_feat_string(s,"name"),
-						 "ctype")))
+	if (cst_streq(ctype,val_string(phoneset_accel_feature(pa,
+                                     item_feat_string(s,"name"),"ctype"))))
 	    return VAL_STRING_1;
     }
 
@@ -433,15 +433,16 @@ static const cst_val *seg_onset_glide(const cst_item *seg)
 static const cst_val *seg_onsetcoda(const cst_item *seg)
 {
     const cst_item *s;
-    const cst_phoneset *ps = item_phoneset(seg);
+    const cst_phoneset_accel *pa;
 
     if (!seg) return VAL_STRING_0;
+    pa = item_phoneset_accel(seg);
     for (s=item_next(item_as(seg,"SylStructure"));
 	 s;
 	 s=item_next(s))
     {
-	if (cst_streq("+",phone_feature_string(ps,item_feat_string(s,"name"),
-					       "vc")))
+	if (cst_streq("+",val_string(phoneset_accel_feature(pa,
+                                     item_feat_string(s,"name"),"vc"))))
 	    return (cst_val *)&val_string_onset;
     }
     return (cst_val *)&val_string_coda;
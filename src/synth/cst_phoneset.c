@@ -43,6 +43,7 @@
 #include "cst_phoneset.h"
 
 CST_VAL_REGISTER_TYPE_NODEL(phoneset,cst_phoneset)
+CST_VAL_REGISTER_TYPE(phoneset_accel,cst_phoneset_accel)
 
 cst_phoneset *new_phoneset()
 {
@@ -122,4 +123,135 @@ const cst_phoneset *item_phoneset(const cst_item *p)
     return val_phoneset(feat_val(item_utt(p)->features,"phoneset"));
 }
 
+static unsigned int phone_name_hash(const char *s)
+{
+    unsigned int h = 5381;
+
+    for ( ; *s; s++)
+        h = (h*33) ^ (unsigned char)*s;
+    return h;
+}
+
+static short *phone_name_table(const char * const *names, int n, int *size)
+{
+    /* Open addressing, at most half full */
+    short *t;
+    unsigned int j;
+    int i;
+
+    for (*size=2; *size < n*2; *size *= 2);
+    t = cst_alloc(short,*size);
+    for (i=0; i<n; i++)
+    {
+        for (j=phone_name_hash(names[i])&(*size-1);
+             t[j] != 0;
+             j=(j+1)&(*size-1))
+            if (cst_streq(names[t[j]-1],names[i]))
+                break;   /* the first one wins, as in the scans */
+        if (t[j] == 0)
+            t[j] = i+1;
+    }
+    return t;
+}
+
+static int phone_name_lookup(const char * const *names, const short *t,
+                             int size, const char *name)
+{
+    unsigned int j;
+
+    for (j=phone_name_hash(name)&(size-1); t[j] != 0; j=(j+1)&(size-1))
+        if (cst_streq(names[t[j]-1],name))
+            return t[j]-1;
+    return 0;
+}
+
+cst_phoneset_accel *new_phoneset_accel(const cst_phoneset *ps)
+{
+    cst_phoneset_accel *pa = cst_alloc(cst_phoneset_accel,1);
+    int i, j;
+
+    pa->ps = ps;
+    for (pa->num_feats=0; ps->featnames[pa->num_feats]; pa->num_feats++);
+    pa->phone_hash = phone_name_table(ps->phonenames,ps->num_phones,
+                                      &pa->phone_hash_size);
+    pa->feat_hash = phone_name_table(ps->featnames,pa->num_feats,
+                                     &pa->feat_hash_size);
+    pa->table = cst_alloc(const cst_val *,ps->num_phones*pa->num_feats);
+    for (i=0; i < ps->num_phones; i++)
+        for (j=0; j < pa->num_feats; j++)
+            pa->table[i*pa->num_feats+j] = ps->featvals[ps->fvtable[i][j]];
+
+    return pa;
+}
+
+void delete_phoneset_accel(cst_phoneset_accel *pa)
+{
+    if (pa)
+    {
+        cst_free(pa->phone_hash);
+        cst_free(pa->feat_hash);
+        cst_free(pa->table);
+        cst_free(pa);
+    }
+}
+
+int phoneset_accel_phone_id(const cst_phoneset_accel *pa,
+                            const char *phonename)
+{
+    return phone_name_lookup(pa->ps->phonenames,pa->phone_hash,
+                             pa->phone_hash_size,phonename);
+}
+
+int phoneset_accel_feat_id(const cst_phoneset_accel *pa,
+                           const char *featname)
+{
+    return phone_name_lookup(pa->ps->featnames,pa->feat_hash,
+                             pa->feat_hash_size,featname);
+}
+
+const cst_val *phoneset_accel_feature(const cst_phoneset_accel *pa,
+                                      const char *phonename,
+                                      const char *featname)
+{
+    return pa->table[phoneset_accel_phone_id(pa,phonename)*pa->num_feats+
+                     phoneset_accel_feat_id(pa,featname)];
+}
+
+void phoneset_set(cst_features *f, const cst_phoneset *ps)
+{
+    feat_set(f,"phoneset",phoneset_val(ps));
+    feat_set(f,"phoneset_accel",phoneset_accel_val(new_phoneset_accel(ps)));
+}
+
+const cst_phoneset_accel *item_phoneset_accel(const cst_item *p)
+{
+    cst_utterance *u = item_utt(p);
+    const cst_phoneset *ps;
+    const cst_val *v;
+    cst_phoneset_accel *pa;
+
+    if (u->phoneset_accel)
+        return u->phoneset_accel;
+
+    ps = val_phoneset(feat_val(u->features,"phoneset"));
+    v = feat_val(u->features,"phoneset_accel");
+    if (v && (val_phoneset_accel(v)->ps == ps))
+        u->phoneset_accel = val_phoneset_accel(v);
+    else
+    {
+        /* The phoneset was set some other way, so the tables are */
+        /* built just for this utterance                          */
+        pa = new_phoneset_accel(ps);
+        feat_set(u->features,"phoneset_accel",phoneset_accel_val(pa));
+        u->phoneset_accel = pa;
+    }
+    return u->phoneset_accel;
+}
+
+const cst_val *item_phone_feature(const cst_item *p, const char *featname)
+{
+    return phoneset_accel_feature(item_phoneset_accel(p),item_name(p),
+                                  featname);
+}
+
 
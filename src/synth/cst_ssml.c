@@ -59,14 +59,100 @@
 /*                                                                       */
 /*************************************************************************/
 
+#include <ctype.h>
 #include "flite.h"
 #include "cst_tokenstream.h"
+#include "cst_thread.h"
 
 static const char * const ssml_singlecharsymbols_general = "<>&/\";";
 static const char * const ssml_singlecharsymbols_inattr = "=>;/\"";
 
 #define SSML_DEBUG 0
 
+/* Tags are recognized as they are read, without regard to case, and */
+/* their attributes are copied into a buffer kept by the parser, so   */
+/* nothing is allocated for each tag                                  */
+#define SSML_TAG_OTHER   0
+#define SSML_TAG_AUDIO   1
+#define SSML_TAG_BREAK   2
+#define SSML_TAG_PROSODY 3
+#define SSML_TAG_PHONEME 4
+#define SSML_TAG_SUB     5
+#define SSML_TAG_VOICE   6
+#define SSML_TAG_MARK    7
+
+static const char * const ssml_tags[] = {
+    "AUDIO", "BREAK", "PROSODY", "PHONEME", "SUB", "VOICE", "MARK", NULL };
+
+#define SSML_MAX_ATTRIBUTES 16
+
+typedef struct ssml_attributes_struct {
+    const char *type;                /* start, end or startend */
+    int num;
+    int name[SSML_MAX_ATTRIBUTES];   /* offsets into buf */
+    int val[SSML_MAX_ATTRIBUTES];    /* -1 if it has no value */
+    char *buf;
+    int buf_size, buf_len;
+} ssml_attributes;
+
+static int ssml_tag_id(const char *token)
+{
+    const char *s, *t;
+    int i;
+
+    for (i=0; ssml_tags[i]; i++)
+    {
+        for (s=token,t=ssml_tags[i]; *s && (toupper((int)*s) == *t); s++,t++);
+        if ((*s == '\0') && (*t == '\0'))
+            return i+1;
+    }
+    return SSML_TAG_OTHER;
+}
+
+static int ssml_attributes_add(ssml_attributes *a, const char *s)
+{
+    /* Copies s into the buffer and returns its offset */
+    int n = cst_strlen(s)+1;
+    int offset = a->buf_len;
+
+    if (a->buf_len + n > a->buf_size)
+    {
+        a->buf_size = 2*(a->buf_len + n);
+        a->buf = cst_realloc(a->buf,char,a->buf_size);
+    }
+    memmove(a->buf+a->buf_len,s,n);
+    a->buf_len += n;
+
+    return offset;
+}
+
+static const char *ssml_attribute(const ssml_attributes *a, const char *name)
+{
+    /* The value given for name, NULL if there isn't one */
+    int i;
+
+    for (i=a->num-1; i >= 0; i--)
+        if ((a->val[i] >= 0) && (cst_streq(name,a->buf+a->name[i])))
+            return a->buf+a->val[i];
+    return NULL;
+}
+
+static const char *ssml_attribute_or_last(const ssml_attributes *a,
+                                          const char *name)
+{
+    /* For tags that have always just taken the value of their only */
+    /* attribute, whatever it was called                            */
+    const char *v;
+    int i;
+
+    if ((v = ssml_attribute(a,name)) != NULL)
+        return v;
+    for (i=a->num-1; i >= 0; i--)
+        if (a->val[i] >= 0)
+            return a->buf+a->val[i];
+    return NULL;
+}
+
 static const char *ts_get_quoted_remainder(cst_tokenstream *ts)
 {
     const char *q;
@@ -76,12 +162,15 @@ static const char *ts_get_quoted_remainder(cst_tokenstream *ts)
     return q;
 }
 
-static cst_features *ssml_get_attributes(cst_tokenstream *ts)
+static int ssml_get_attributes(cst_tokenstream *ts, ssml_attributes *a)
 {
-    cst_features *a = new_features();
-    const char* name, *val;
-    const char *fnn,*vnn;
-    int i=0;
+    /* Reads up to the closing ">", FALSE if the file ends first */
+    const char *name, *val;
+    int i;
+
+    a->type = "start";
+    a->num = 0;
+    a->buf_len = 0;
 
     set_charclasses(ts,
                     ts->p_whitespacesymbols,
@@ -92,43 +181,31 @@ static cst_features *ssml_get_attributes(cst_tokenstream *ts)
     name = ts_get(ts);
     while (!cst_streq(">",name))
     {
-        /* I want names and values to be const */
-        fnn = "_name0";
-        vnn = "_val0";
-        // Tags with more than one attribute need to have additional
-        // attributes defined here.
-        if (cst_streq("volume", name))
-        {
-            fnn = "_name1"; vnn = "_val1";
-        }
-        else if (cst_streq("pitch", name))
-        {
-            fnn = "_name2"; vnn = "_val2";
-        }
-        else if (cst_streq("range", name))
-        {
-            fnn = "_name3"; vnn = "_val3";
-        }
 	if (cst_streq(name,"/"))
-	    feat_set_string(a,"_type","startend");
+	    a->type = "startend";
 	else
 	{
-	    feat_set_string(a,"_type","start");
-	    feat_set_string(a,fnn,name);
+	    a->type = "start";
+            i = -1;
+            if (a->num < SSML_MAX_ATTRIBUTES)
+            {
+                i = a->num++;
+                a->name[i] = ssml_attributes_add(a,name);
+                a->val[i] = -1;
+            }
 	    if (cst_streq("=",ts_get(ts)))
 	    {
                 val = ts_get_quoted_remainder(ts);
-                feat_set_string(a,vnn,val);
+                if (i >= 0)
+                    a->val[i] = ssml_attributes_add(a,val);
             }
 	}
 	if (ts_eof(ts))
 	{
 	    fprintf(stderr,"ssml: unexpected EOF\n");
-	    delete_features(a);
-	    return 0;
+	    break;
 	}
         name = ts_get(ts);
-        i++;
     }
 	
     set_charclasses(ts,
@@ -137,39 +214,49 @@ static cst_features *ssml_get_attributes(cst_tokenstream *ts)
                     ts->p_prepunctuationsymbols,
                     ts->p_postpunctuationsymbols);
 
-    return a;
+    return cst_streq(">",name);
 }
 
-static cst_utterance *ssml_apply_tag(const char *tag,
-                                     cst_features *attributes,
+static cst_utterance *ssml_apply_tag(int tag,
+                                     const ssml_attributes *attributes,
                                      cst_utterance *u,
                                      cst_features *word_feats,
                                      cst_features *feats)
 {
     const char *wavefilename;
     const char *vname;
+    const char *v;
     cst_voice *nvoice;
     cst_wave *wave;
     cst_item *t;
     cst_relation *r;
     float break_size;
+    int start, end;
 
 #if SSML_DEBUG
-    printf("SSML TAG %s\n",tag);
-    cst_feat_print(stdout,attributes);
+    int i;
+    printf("SSML TAG %s %s\n",
+           tag ? ssml_tags[tag-1] : "OTHER",attributes->type);
+    for (i=0; i < attributes->num; i++)
+        printf("  %s=%s\n",attributes->buf+attributes->name[i],
+               (attributes->val[i] < 0) ? "" :
+               attributes->buf+attributes->val[i]);
     printf("...\n");
 #endif
 
-    if (cst_streq("AUDIO",tag))
+    start = cst_streq("start",attributes->type);
+    end = cst_streq("end",attributes->type);
+
+    if (tag == SSML_TAG_AUDIO)
     {
-        if ((cst_streq("start",feat_string(attributes,"_type"))) ||
-            (cst_streq("startend",feat_string(attributes,"_type"))))
+        if (start || cst_streq("startend",attributes->type))
         {
-            wavefilename = feat_string(attributes,"_val0");
+            wavefilename = ssml_attribute_or_last(attributes,"src");
             wave = new_wave();
-            if (cst_wave_load_riff(wave,wavefilename) == CST_OK_FORMAT)
+            if (wavefilename &&
+                (cst_wave_load_riff(wave,wavefilename) == CST_OK_FORMAT))
             {
-                if (cst_streq("start",feat_string(attributes,"_type")))
+                if (start)
                 {
                     feat_set_string(word_feats,"ssml_comment","1");
                 }
@@ -179,53 +266,43 @@ static cst_utterance *ssml_apply_tag(const char *tag,
                 delete_wave(wave);
             return NULL; /* Cause eou */
         }
-        else if (cst_streq("end",feat_string(attributes,"_type")))
+        else if (end)
         {
             feat_remove(word_feats,"ssml_comment");
             return NULL; /* Cause eou */
         }
     }
-    else if (cst_streq("BREAK",tag))
+    else if (tag == SSML_TAG_BREAK)
     {
         if (u && 
             ((r = utt_relation(u,"Token")) != NULL) &&
             ((t = relation_tail(r)) != NULL))
         {
             item_set_string(t,"break","1");
-            /* cst_feat_print(stdout,attributes); */
-            if (cst_streq("size",get_param_string(attributes,"_name0","")))
+            if ((v = ssml_attribute(attributes,"size")) != NULL)
             {
-                break_size=feat_float(attributes,"_val0");
+                break_size=cst_atof(v);
                 item_set_float(t,"break_size",break_size);
             }
         }
     }
-    else if (cst_streq("PROSODY",tag))
+    else if (tag == SSML_TAG_PROSODY)
     {
-        if (cst_streq("start",feat_string(attributes,"_type")))
+        if (start)
         {
             /* Note SSML doesn't do stretch it does reciprical of stretch */
-            if (cst_streq("rate",get_param_string(attributes,"_name0","")))
+            if ((v = ssml_attribute(attributes,"rate")) != NULL)
                 feat_set_float(word_feats,"local_duration_stretch",
-                               1.0/feat_float(attributes,"_val0"));
-            // volume is stored in _name1
-            if (cst_streq("volume",get_param_string(attributes,"_name1","")))
-                feat_set_float(word_feats,"local_gain",
-                               feat_float(attributes,"_val1")/100.0);
-            // pitch is stored in _name2
-            if (cst_streq("pitch", get_param_string(attributes, "_name2", "")))
-            {
-                feat_set_float(word_feats, "local_f0_mean", feat_float(attributes, "_val2"));
-            }
-            // range is stored in _name3
-            if (cst_streq("range", get_param_string(attributes, "_name3", "")))
-            {
-                feat_set_float(word_feats, "local_f0_range",
-                               // shift by + 1.0 to allow 0.0 to be passed.
-                               feat_float(attributes, "_val3") + 1.0);
-            }
+                               1.0/cst_atof(v));
+            if ((v = ssml_attribute(attributes,"volume")) != NULL)
+                feat_set_float(word_feats,"local_gain",cst_atof(v)/100.0);
+            if ((v = ssml_attribute(attributes,"pitch")) != NULL)
+                feat_set_float(word_feats,"local_f0_mean",cst_atof(v));
+            if ((v = ssml_attribute(attributes,"range")) != NULL)
+                /* shift by + 1.0 to allow 0.0 to be passed. */
+                feat_set_float(word_feats,"local_f0_range",cst_atof(v)+1.0);
         }
-        else if (cst_streq("end",feat_string(attributes,"_type")))
+        else if (end)
         {
             feat_remove(word_feats,"local_duration_stretch");
             feat_remove(word_feats,"local_gain");
@@ -234,50 +311,48 @@ static cst_utterance *ssml_apply_tag(const char *tag,
         }
 
     }
-    else if (cst_streq("PHONEME",tag))
+    else if (tag == SSML_TAG_PHONEME)
     {
-        if (cst_streq("start",feat_string(attributes,"_type")))
+        if (start)
         {
-            if (cst_streq("ph",get_param_string(attributes,"_name0","")))
-            {
-                const char *ph;
-                ph = feat_string(attributes,"_val0");
-                feat_set_string(word_feats,"phones",ph);
-            }
+            if ((v = ssml_attribute(attributes,"ph")) != NULL)
+                feat_set_string(word_feats,"phones",v);
         }
-        else if (cst_streq("end",feat_string(attributes,"_type")))
+        else if (end)
         {
             feat_remove(word_feats,"phones");
         }
 
     }
-    else if (cst_streq("SUB",tag))
+    else if (tag == SSML_TAG_SUB)
     {
-        if (cst_streq("start",feat_string(attributes,"_type")))
+        if (start)
         {
-            if (cst_streq("alias",get_param_string(attributes,"_name0","")))
-            {
-                const char *alias;
-                alias = feat_string(attributes,"_val0");
-                feat_set_string(word_feats,"ssml_alias",alias);
-            }
+            if ((v = ssml_attribute(attributes,"alias")) != NULL)
+                feat_set_string(word_feats,"ssml_alias",v);
         }
-        else if (cst_streq("end",feat_string(attributes,"_type")))
+        else if (end)
         {
             feat_remove(word_feats,"ssml_alias");
         }
 
     }
-    else if (cst_streq("VOICE",tag))
+    else if (tag == SSML_TAG_MARK)
+    {   /* goes on the next token, for streaming events */
+        if ((start || cst_streq("startend",attributes->type)) &&
+            ((v = ssml_attribute_or_last(attributes,"name")) != NULL))
+            feat_set_string(word_feats,"ssml_mark",v);
+    }
+    else if (tag == SSML_TAG_VOICE)
     {
-        if (cst_streq("start",feat_string(attributes,"_type")))
+        if (start)
         {
-            vname = get_param_string(attributes,"_val0","");
-            nvoice = flite_voice_select(vname);
+            vname = ssml_attribute_or_last(attributes,"name");
+            nvoice = flite_voice_select(vname ? vname : "");
             feat_set(feats,"current_voice",userdata_val(nvoice));
             return NULL;  /* cause an utterance break */
         }
-        else if (cst_streq("end",feat_string(attributes,"_type")))
+        else if (end)
         {
             /* Hmm we should really have a stack of these */
             nvoice = 
@@ -299,20 +374,254 @@ static cst_utterance *ssml_apply_tag(const char *tag,
 
     return u;
 }
-			       
+
+static void ssml_copy_word_feats(const cst_features *from, cst_features *to)
+{
+    /* Like feat_copy_into() but the token gets vals of its own, as it */
+    /* may be synthesized on another thread while from is changed      */
+    const cst_featvalpair *p;
+    const cst_val *v;
+
+    for (p=from->head; p; p=p->next)
+    {
+        v = p->val;
+        if (CST_VAL_TYPE(v) == CST_VAL_TYPE_INT)
+            feat_set(to,p->name,int_val(val_int(v)));
+        else if (CST_VAL_TYPE(v) == CST_VAL_TYPE_FLOAT)
+            feat_set(to,p->name,float_val(val_float(v)));
+        else if (val_stringp(v))
+            feat_set(to,p->name,string_val(val_string(v)));
+        else
+            feat_set(to,p->name,v);
+    }
+}
+
+/* The synthesis stage.  The parser hands it each utterance (its tokens */
+/* with their word features, or an inserted wave) with the voice to say */
+/* it, and it is synthesized and output in order.  With ssml_threads    */
+/* set, worker threads synthesize up to twice that many utterances      */
+/* ahead of the output, otherwise it's all done as they arrive          */
+typedef struct ssml_job_struct {
+    cst_utterance *utt;
+    cst_voice *voice;
+    int synth;              /* FALSE if utt already has its wave */
+    int done;
+} ssml_job;
+
+typedef struct ssml_pipeline_struct {
+    const char *outtype;
+    cst_wave_sink *sink;
+    cst_audio_player *player;
+    float durs;
+    int interrupted;
+
+    cst_mutex *lock;        /* protects the jobs */
+    cst_cond *queued;       /* a job was added, or quit */
+    cst_cond *finished;     /* a job was synthesized */
+    ssml_job *jobs;         /* a ring, oldest first */
+    int size, head, count;
+    int taken;              /* the first taken jobs are with workers */
+    int quit;
+    cst_thread **workers;
+    int num_workers;
+} ssml_pipeline;
+
+static void ssml_synth_job(ssml_job *j)
+{
+    if (j->synth)
+        j->utt = flite_do_synth(j->utt,j->voice,utt_synth_tokens);
+}
+
+static void *ssml_worker(void *arg)
+{
+    ssml_pipeline *p = (ssml_pipeline *)arg;
+    ssml_job *j;
+
+    cst_mutex_lock(p->lock);
+    while (1)
+    {
+        while (!p->quit && (p->taken == p->count))
+            cst_cond_wait(p->queued,p->lock);
+        if (p->quit)
+            break;
+        j = &p->jobs[(p->head + p->taken) % p->size];
+        p->taken++;
+        cst_mutex_unlock(p->lock);
+
+        ssml_synth_job(j);
+
+        cst_mutex_lock(p->lock);
+        j->done = TRUE;
+        cst_cond_broadcast(p->finished);
+    }
+    cst_mutex_unlock(p->lock);
+
+    return NULL;
+}
+
+static void ssml_output(ssml_pipeline *p, cst_utterance *utt)
+{
+    if ((utt == NULL) || feat_present(utt->features,"Interrupted"))
+        p->interrupted = TRUE;
+    else if (p->sink)
+        p->durs += flite_sink_output(utt,p->sink);
+    else if (p->player)
+        p->durs += flite_player_output(utt,p->player);
+    else
+        p->durs += flite_process_output(utt,p->outtype,TRUE);
+    delete_utterance(utt);
+}
+
+static void ssml_output_oldest(ssml_pipeline *p)
+{
+    ssml_job j;
+
+    cst_mutex_lock(p->lock);
+    while (!p->jobs[p->head].done)
+        cst_cond_wait(p->finished,p->lock);
+    j = p->jobs[p->head];
+    p->head = (p->head + 1) % p->size;
+    p->count--;
+    p->taken--;
+    cst_mutex_unlock(p->lock);
+
+    if (p->interrupted)   /* nothing after that is wanted */
+        delete_utterance(j.utt);
+    else
+        ssml_output(p,j.utt);
+}
+
+static void ssml_pipeline_flush(ssml_pipeline *p)
+{
+    while (p->count > 0)
+        ssml_output_oldest(p);
+}
+
+static int ssml_pipeline_streams(ssml_pipeline *p, cst_voice *voice)
+{
+    /* Streamed audio goes out as it is synthesized, so such voices */
+    /* are synthesized here, in order, once everything before is out */
+    if (get_param_val(voice->features,"streaming_info",NULL) == NULL)
+        return FALSE;
+    ssml_pipeline_flush(p);
+    return TRUE;
+}
+
+static int ssml_emit(ssml_pipeline *p, cst_utterance *utt, cst_voice *voice,
+                     int synth)
+{
+    /* FALSE once synthesis has been interrupted */
+    ssml_job j;
+
+    if (p->interrupted)
+    {
+        delete_utterance(utt);
+        return FALSE;
+    }
+    j.utt = utt;
+    j.voice = voice;
+    j.synth = synth;
+    j.done = FALSE;
+
+    if ((p->num_workers == 0) || ssml_pipeline_streams(p,voice))
+    {
+        ssml_synth_job(&j);
+        ssml_output(p,j.utt);
+        return !p->interrupted;
+    }
+
+    if (p->count == p->size)
+        ssml_output_oldest(p);
+    if (p->interrupted)
+    {
+        delete_utterance(utt);
+        return FALSE;
+    }
+    cst_mutex_lock(p->lock);
+    p->jobs[(p->head + p->count) % p->size] = j;
+    p->count++;
+    cst_cond_signal(p->queued);
+    cst_mutex_unlock(p->lock);
+
+    return TRUE;
+}
+
+static ssml_pipeline *new_ssml_pipeline(cst_voice *voice,
+                                        const char *outtype,
+                                        cst_wave_sink *sink,
+                                        cst_audio_player *player)
+{
+    ssml_pipeline *p = cst_alloc(ssml_pipeline,1);
+    int i, n;
+
+    p->outtype = outtype;
+    p->sink = sink;
+    p->player = player;
+
+    n = get_param_int(voice->features,"ssml_threads",0);
+    if (n > 0)
+    {
+        p->size = 2*n;
+        p->jobs = cst_alloc(ssml_job,p->size);
+        p->lock = new_mutex();
+        p->queued = new_cond();
+        p->finished = new_cond();
+        p->workers = cst_alloc(cst_thread *,n);
+        for (i=0; i < n; i++)
+        {   /* without threads it's all done in the caller */
+            if ((p->workers[p->num_workers] =
+                 cst_thread_create(ssml_worker,p)) != NULL)
+                p->num_workers++;
+        }
+    }
+
+    return p;
+}
+
+static float delete_ssml_pipeline(ssml_pipeline *p, int *interrupted)
+{
+    /* Outputs what is left, unless interrupted, and returns the total */
+    /* duration output                                                 */
+    float durs;
+    int i;
+
+    if (p->jobs)
+    {
+        if (!p->interrupted)
+            ssml_pipeline_flush(p);
+        cst_mutex_lock(p->lock);
+        p->quit = TRUE;
+        cst_cond_broadcast(p->queued);
+        cst_mutex_unlock(p->lock);
+        for (i=0; i < p->num_workers; i++)
+            cst_thread_join(p->workers[i]);
+        for (i=0; i < p->count; i++)
+            delete_utterance(p->jobs[(p->head + i) % p->size].utt);
+        cst_free(p->workers);
+        delete_cond(p->finished);
+        delete_cond(p->queued);
+        delete_mutex(p->lock);
+        cst_free(p->jobs);
+    }
+    durs = p->durs;
+    *interrupted = p->interrupted;
+    cst_free(p);
+
+    return durs;
+}
+
 static float flite_ssml_to_speech_ts(cst_tokenstream *ts,
                                      cst_voice *voice,
-                                     const char *outtype)
+                                     const char *outtype,
+                                     cst_wave_sink *sink)
 {
-    /* This is a very ugly function, that might be better written with gotos */
-    /* This just doesn't seem to be properly functions -- perhaps a proper */
-    /* consumer/producer threaded model might be better here -- but its */
-    /* not clear.  There is so much have-to-be-done-now vs note-for-later */
-    /* code, that the code is far from clear, and probably not right */
+    /* The markup is parsed here a tag at a time, tags changing the    */
+    /* word features given to the following tokens, and each utterance */
+    /* is handed to the synthesis stage (ssml_emit()) when it ends     */
     cst_features *ssml_feats, *ssml_word_feats;
-    cst_features *attributes;
+    ssml_attributes attributes;
     const char *token = "";
-    char *tag=NULL;
+    int tag;
     cst_utterance *utt;
     cst_relation *tokrel;
     int num_tokens;
@@ -323,8 +632,11 @@ static float flite_ssml_to_speech_ts(cst_tokenstream *ts,
     cst_voice *current_voice; 
     int ssml_eou = 0;
     const cst_wave *wave;
-    cst_wave *w;
+    cst_audio_player *player;
+    ssml_pipeline *pipeline;
+    int interrupted;
 
+    memset(&attributes,0,sizeof(attributes));
     ssml_feats = new_features();
     feat_set(ssml_feats,"current_voice",userdata_val(voice));
     feat_set(ssml_feats,"default_voice",userdata_val(voice));
@@ -342,18 +654,8 @@ static float flite_ssml_to_speech_ts(cst_tokenstream *ts,
     if (feat_present(voice->features,"utt_user_callback"))
 	utt_user_callback = val_uttfunc(feat_val(voice->features,"utt_user_callback"));
 
-    /* If its a file to write to, create and save an empty wave file */
-    /* as we are going to incrementally append to it                 */
-    if (!cst_streq(outtype,"play") && 
-        !cst_streq(outtype,"none") &&
-        !cst_streq(outtype,"stream"))
-    {
-	w = new_wave();
-	cst_wave_resize(w,0,1);
-	cst_wave_set_sample_rate(w,16000);
-	cst_wave_save_riff(w,outtype);  /* an empty wave */
-	delete_wave(w);
-    }
+    player = flite_open_player(outtype,voice);
+    pipeline = new_ssml_pipeline(voice,outtype,sink,player);
 
     num_tokens = 0;
     utt = new_utterance();
@@ -363,7 +665,6 @@ static float flite_ssml_to_speech_ts(cst_tokenstream *ts,
     {
         current_voice = 
             (cst_voice *)val_userdata(feat_val(ssml_feats,"current_voice"));
-        /* printf("awb_debug prewhile %d %s\n",ssml_eou,token); */
         if (ssml_eou == 0)
             token = ts_get(ts);
         else
@@ -374,25 +675,31 @@ static float flite_ssml_to_speech_ts(cst_tokenstream *ts,
         }
 	while ((cst_streq("<",token)) && (ssml_eou == 0))
 	{   /* A tag -- look ahead and process it to find out how to advance */
-	    tag = cst_upcase(ts_get(ts));
-            /* printf("awb_debug tag is %s\n",tag); */
-            if (cst_streq("/",tag)) /* an end tag */
+            token = ts_get(ts);
+            if (cst_streq("/",token)) /* an end tag */
             {
-                cst_free(tag); tag=NULL;
-                tag = cst_upcase(ts_get(ts));
-                attributes = ssml_get_attributes(ts);
-                feat_set_string(attributes,"_type","end");
+                tag = ssml_tag_id(ts_get(ts));
+                if (!ssml_get_attributes(ts,&attributes))
+                {
+                    token = "";
+                    break;
+                }
+                attributes.type = "end";
             }
             else
-                attributes = ssml_get_attributes(ts);
-            token = ts_get(ts);  /* skip ">" */
-	    if (ssml_apply_tag(tag,attributes,utt,ssml_word_feats,ssml_feats))
+            {
+                tag = ssml_tag_id(token);
+                if (!ssml_get_attributes(ts,&attributes))
+                {
+                    token = "";
+                    break;
+                }
+            }
+            token = ts_get(ts);  /* the one after ">" */
+	    if (ssml_apply_tag(tag,&attributes,utt,ssml_word_feats,ssml_feats))
                 ssml_eou = 0;
             else
                 ssml_eou = 1;
-            
-            delete_features(attributes);
-	    cst_free(tag); tag=NULL;
 	}
 
         if ((cst_strlen(token) == 0) ||
@@ -405,19 +712,13 @@ static float flite_ssml_to_speech_ts(cst_tokenstream *ts,
             if (utt_user_callback)
                 utt = (utt_user_callback)(utt);
             
-            if (utt)
+            if ((utt == NULL) ||
+                !ssml_emit(pipeline,utt,current_voice,TRUE))
             {
-                utt = flite_do_synth(utt,current_voice,utt_synth_tokens);
-                if (feat_present(utt->features,"Interrupted"))
-                {
-                    delete_utterance(utt); utt = NULL;
-                    break;
-                }
-                durs += flite_process_output(utt,outtype,TRUE);
-                delete_utterance(utt); utt = NULL;
-            }
-            else 
+                utt = NULL;
                 break;
+            }
+            utt = NULL;
 
             if (ts_eof(ts)) break;
             
@@ -432,11 +733,12 @@ static float flite_ssml_to_speech_ts(cst_tokenstream *ts,
             /* Should create an utterances with the waveform in it */
             /* Have to stream it if there is streaming */
             if (utt) delete_utterance(utt);
+            ssml_pipeline_streams(pipeline,current_voice);
             utt = utt_synth_wave(copy_wave(wave),current_voice);
             if (utt_user_callback)
                 utt = (utt_user_callback)(utt);
-            durs += flite_process_output(utt,outtype,TRUE);
-            delete_utterance(utt); utt = NULL;
+            if (utt)
+                ssml_emit(pipeline,utt,current_voice,FALSE);
 
             utt = new_utterance();
             tokrel = utt_relation_create(utt, "Token");
@@ -450,9 +752,9 @@ static float flite_ssml_to_speech_ts(cst_tokenstream *ts,
 
             t = relation_append(tokrel, NULL);
             item_set_string(t,"name",token);
-            item_set_string(t,"whitespace",ts->whitespace);
-            item_set_string(t,"prepunctuation",ts->prepunctuation);
-            item_set_string(t,"punc",ts->postpunctuation);
+            item_set(t,"whitespace",ts_part_val(ts->whitespace));
+            item_set(t,"prepunctuation",ts_part_val(ts->prepunctuation));
+            item_set(t,"punc",ts_part_val(ts->postpunctuation));
             /* Mark it at the beginning of the token */
             item_set_int(t,"file_pos",
                  ts->file_pos-(1+ /* as we are already on the next char */
@@ -460,11 +762,20 @@ static float flite_ssml_to_speech_ts(cst_tokenstream *ts,
                                cst_strlen(ts->prepunctuation)+
                                cst_strlen(ts->postpunctuation)));
             item_set_int(t,"line_number",ts->line_number);
-            feat_copy_into(ssml_word_feats,item_feats(t));
+            ssml_copy_word_feats(ssml_word_feats,item_feats(t));
+            feat_remove(ssml_word_feats,"ssml_mark");
         }
     }
 
     delete_utterance(utt);
+    durs = delete_ssml_pipeline(pipeline,&interrupted);
+    if (player)
+    {   /* the rest is played first, unless synthesis was stopped */
+        if (interrupted)
+            audio_player_stop(player);
+        delete_audio_player(player);
+    }
+    cst_free(attributes.buf);
     delete_features(ssml_feats);
     delete_features(ssml_word_feats);
     return durs;
@@ -476,10 +787,10 @@ float flite_ssml_file_to_speech(const char *filename,
 {
     cst_tokenstream *ts;
     int fp;
-    cst_wave *w;
+    cst_wave_sink *sink;
     float d;
 
-    if ((ts = ts_open(filename,
+    if ((ts = ts_open_mapped(filename,
 	      get_param_string(voice->features,"text_whitespace",NULL),
 	      get_param_string(voice->features,"text_singlecharsymbols",NULL),
 	      get_param_string(voice->features,"text_prepunctuation",NULL),
@@ -494,20 +805,11 @@ float flite_ssml_file_to_speech(const char *filename,
     if (fp > 0)
         ts_set_stream_pos(ts,fp);
 
-    /* If its a file to write to, create and save an empty wave file */
-    /* as we are going to incrementally append to it                 */
-    if (!cst_streq(outtype,"play") && 
-        !cst_streq(outtype,"none") &&
-        !cst_streq(outtype,"stream"))
-    {
-	w = new_wave();
-	cst_wave_resize(w,0,1);
-	cst_wave_set_sample_rate(w,16000);
-	cst_wave_save_riff(w,outtype);  /* an empty wave */
-	delete_wave(w);
-    }
-
-    d = flite_ssml_to_speech_ts(ts,voice,outtype);
+    if ((sink = flite_open_sink(outtype,voice)) != NULL)
+        outtype = "none";
+    d = flite_ssml_to_speech_ts(ts,voice,outtype,sink);
+    if (sink)
+        cst_wave_sink_close(sink);
 
     ts_close(ts);
     
@@ -521,7 +823,7 @@ float flite_ssml_text_to_speech(const char *text,
 {
     cst_tokenstream *ts;
     int fp;
-    cst_wave *w;
+    cst_wave_sink *sink;
     float d;
 
     if ((ts = ts_open_string(text,
@@ -537,20 +839,11 @@ float flite_ssml_text_to_speech(const char *text,
     if (fp > 0)
         ts_set_stream_pos(ts,fp);
 
-    /* If its a file to write to, create and save an empty wave file */
-    /* as we are going to incrementally append to it                 */
-    if (!cst_streq(outtype,"play") && 
-        !cst_streq(outtype,"none") &&
-        !cst_streq(outtype,"stream"))
-    {
-	w = new_wave();
-	cst_wave_resize(w,0,1);
-	cst_wave_set_sample_rate(w,16000);
-	cst_wave_save_riff(w,outtype);  /* an empty wave */
-	delete_wave(w);
-    }
-
-    d = flite_ssml_to_speech_ts(ts,voice,outtype);
+    if ((sink = flite_open_sink(outtype,voice)) != NULL)
+        outtype = "none";
+    d = flite_ssml_to_speech_ts(ts,voice,outtype,sink);
+    if (sink)
+        cst_wave_sink_close(sink);
 
     ts_close(ts);
     
@@ -558,4 +851,9 @@ float flite_ssml_text_to_speech(const char *text,
 
 }
 
-
+float flite_ssml_ts_to_sink(cst_tokenstream *ts,
+                            cst_voice *voice,
+                            cst_wave_sink *sink)
+{
+    return flite_ssml_to_speech_ts(ts,voice,"none",sink);
+}
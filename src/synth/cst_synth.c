@@ -46,6 +46,8 @@
 #include "cst_units.h"
 #include "cst_synth.h"
 #include "cst_phoneset.h"
+#include "cst_synth_stats.h"
+#include "cst_thread.h"
 #include <assert.h>
 
 CST_VAL_REGISTER_FUNCPTR(breakfunc,cst_breakfunc)
@@ -137,7 +139,7 @@ cst_utterance *utt_synth_wave(cst_wave *w,cst_voice *v)
     if (!asi) return u;  /* no stream */
 
     /* Do streaming */
-    (*asi->asc)(w,0,w->num_samples,1,asi);
+    audio_stream_send(asi,w,0,w->num_samples,1);
 
     return u;
 }
@@ -155,9 +157,40 @@ cst_utterance *apply_synth_module(cst_utterance *u,
     return u;
 }
 
+static cst_utterance *apply_synth_method_stats(cst_utterance *u,
+                                               const cst_synth_module meth[])
+{
+    /* As apply_synth_method, but timing each module */
+    cst_synth_stats run, *outer;
+    cst_alloc_counts a0, a1;
+    double wall, cpu;
+
+    outer = synth_stats_start(&run);
+    while (meth->hookname)
+    {
+        cst_alloc_thread_stats(&a0);
+        wall = cst_clock_wall();
+        cpu = cst_clock_thread_cpu();
+	u = apply_synth_module(u, meth);
+        wall = cst_clock_wall() - wall;
+        cpu = cst_clock_thread_cpu() - cpu;
+        cst_alloc_thread_stats(&a1);
+        synth_stats_module(&run,meth->hookname,wall,cpu,&a0,&a1);
+	if (u == NULL)
+	    break;
+	++meth;
+    }
+    synth_stats_end(u,&run,outer);
+
+    return u;
+}
+
 cst_utterance *apply_synth_method(cst_utterance *u,
 				  const cst_synth_module meth[])
 {
+    if (cst_synth_stats_on)
+        return apply_synth_method_stats(u,meth);
+
     while (meth->hookname)
     {
 	if ((u = apply_synth_module(u, meth)) == NULL)
@@ -224,9 +257,9 @@ cst_utterance *default_tokenization(cst_utterance *u)
 	{
 	    t = relation_append(r,NULL);
 	    item_set_string(t,"name",token);
-	    item_set_string(t,"whitespace",fd->whitespace);
-	    item_set_string(t,"prepunctuation",fd->prepunctuation);
-	    item_set_string(t,"punc",fd->postpunctuation);
+	    item_set(t,"whitespace",ts_part_val(fd->whitespace));
+	    item_set(t,"prepunctuation",ts_part_val(fd->prepunctuation));
+	    item_set(t,"punc",ts_part_val(fd->postpunctuation));
 	    item_set_int(t,"file_pos",fd->file_pos);
 	    item_set_int(t,"line_number",fd->line_number);
 	}
@@ -298,7 +331,7 @@ cst_utterance *default_phrasing(cst_utterance *u)
 	{
 	    p = relation_append(r,NULL);
             lp = p;
-            item_set_string(p,"name","B");
+            item_set(p,"name",atom_val("B"));
 	}
 	item_add_daughter(p,w);
         if (phrasing_cart)
@@ -310,7 +343,7 @@ cst_utterance *default_phrasing(cst_utterance *u)
     }
 
     if (lp && item_prev(lp)) /* follow festival */
-        item_set_string(lp,"name","BB");
+        item_set(lp,"name",atom_val("BB"));
     
     return u;
 }
@@ -330,7 +363,7 @@ cst_utterance *default_pause_insertion(cst_utterance *u)
 	s = relation_append(utt_relation(u,"Segment"),NULL);
     else
 	s = item_prepend(s,NULL);
-    item_set_string(s,"name",silence);
+    item_set(s,"name",atom_val(silence));
 
     for (p=relation_head(utt_relation(u,"Phrase")); p; p=item_next(p))
     {
@@ -340,7 +373,7 @@ cst_utterance *default_pause_insertion(cst_utterance *u)
 	    if (s)
 	    {
 		s = item_append(s,NULL);
-		item_set_string(s,"name",silence);
+		item_set(s,"name",atom_val(silence));
 		break;
 	    }
 	}
@@ -349,9 +382,32 @@ cst_utterance *default_pause_insertion(cst_utterance *u)
     return u;
 }
 
+static const cst_cart_compiled *compiled_cart(cst_utterance *u,
+                                              const char *name,
+                                              const cst_cart *tree,
+                                              cst_ffunction *ff)
+{
+    /* The compiled version of tree, if there is one and it's wanted */
+    const cst_val *v;
+    const cst_cart_compiled *c;
+
+    if (!get_param_int(u->features,"compiled_prosody",TRUE) ||
+        ((v = get_param_val(u->features,name,NULL)) == NULL))
+        return NULL;
+    c = val_cart_compiled(v);
+    if (c->tree != tree)
+        return NULL;  /* the voice has its own tree */
+    ff_bind(u->ffunctions,c->ffunc_names,c->num_feats,ff);
+
+    return c;
+}
+
 cst_utterance *cart_intonation(cst_utterance *u)
 {
     cst_cart *accents, *tones;
+    const cst_cart_compiled *caccents, *ctones;
+    cst_ffunction accents_ff[CST_CART_COMPILED_MAX_FEATS];
+    cst_ffunction tones_ff[CST_CART_COMPILED_MAX_FEATS];
     cst_item *s;
     const cst_val *v;
 
@@ -360,13 +416,21 @@ cst_utterance *cart_intonation(cst_utterance *u)
 
     accents = val_cart(feat_val(u->features,"int_cart_accents"));
     tones = val_cart(feat_val(u->features,"int_cart_tones"));
+    caccents = compiled_cart(u,"int_cart_accents_compiled",accents,accents_ff);
+    ctones = compiled_cart(u,"int_cart_tones_compiled",tones,tones_ff);
     
     for (s=relation_head(utt_relation(u,"Syllable")); s; s=item_next(s))
     {
-	v = cart_interpret(s,accents);
+        if (caccents)
+            v = cart_interpret_compiled(s,caccents,accents_ff);
+        else
+            v = cart_interpret(s,accents);
 	if (!cst_streq("NONE",val_string(v)))
 	    item_set_string(s,"accent",val_string(v));
-	v = cart_interpret(s,tones);
+        if (ctones)
+            v = cart_interpret_compiled(s,ctones,tones_ff);
+        else
+            v = cart_interpret(s,tones);
 	if (!cst_streq("NONE",val_string(v)))
 	    item_set_string(s,"endtone",val_string(v));
 	DPRINTF(0,("word %s gpos %s stress %s ssyl_in %s ssyl_out %s accent %s endtone %s\n",
@@ -397,6 +461,8 @@ const dur_stat *phone_dur_stat(const dur_stats *ds,const char *ph)
 cst_utterance *cart_duration(cst_utterance *u)
 {
     cst_cart *dur_tree;
+    const cst_cart_compiled *cdur_tree;
+    cst_ffunction dur_ff[CST_CART_COMPILED_MAX_FEATS];
     cst_item *s;
     float zdur, dur_stretch, local_dur_stretch, dur;
     float end;
@@ -409,12 +475,16 @@ cst_utterance *cart_duration(cst_utterance *u)
         return u;  /* not all methods need segment durations */
 
     dur_tree = val_cart(feat_val(u->features,"dur_cart"));
+    cdur_tree = compiled_cart(u,"dur_cart_compiled",dur_tree,dur_ff);
     dur_stretch = get_param_float(u->features,"duration_stretch", 1.0);
     ds = val_dur_stats(feat_val(u->features,"dur_stats"));
     
     for (s=relation_head(utt_relation(u,"Segment")); s; s=item_next(s))
     {
-	zdur = val_float(cart_interpret(s,dur_tree));
+        if (cdur_tree)
+            zdur = val_float(cart_interpret_compiled(s,cdur_tree,dur_ff));
+        else
+            zdur = val_float(cart_interpret(s,dur_tree));
 	dur_stat = phone_dur_stat(ds,item_name(s));
 
 	local_dur_stretch = ffeature_float(s, "R:SylStructure.parent.parent."
@@ -458,6 +528,33 @@ cst_utterance *default_pos_tagger(cst_utterance *u)
     return u;
 }
 
+static void lex_insert_pron(cst_relation *syl, cst_relation *seg,
+                            cst_item *ssword, const cst_lex_pron *pron)
+{
+    /* The same items default_lexical_insertion() builds from phones */
+    cst_item *sylitem = NULL, *sssyl = NULL, *segitem;
+    int i;
+
+    for (i=0; i < pron->num_phones; i++)
+    {
+	if (sylitem == NULL)
+	{
+	    sylitem = relation_append(syl,NULL);
+	    sssyl = item_add_daughter(ssword,sylitem);
+	}
+	segitem = relation_append(seg,NULL);
+	item_set(segitem,"name",pron->phones[i]);
+	item_add_daughter(sssyl,segitem);
+	if (pron->syl_end[i] != CST_LEX_SYL_NONE)
+	{
+	    sylitem = NULL;
+	    item_set(sssyl,"stress",
+		     atom_val((pron->syl_end[i] == CST_LEX_SYL_STRESSED) ?
+			      "1" : "0"));
+	}
+    }
+}
+
 cst_utterance *default_lexical_insertion(cst_utterance *u)
 {
     cst_item *word;
@@ -465,17 +562,23 @@ cst_utterance *default_lexical_insertion(cst_utterance *u)
     cst_lexicon *lex;
     const cst_val *lex_addenda = NULL;
     const cst_val *p, *wp = NULL;
-    char *phone_name;
+    const char *phone_name;
+    int len;
     const char *stress = "0";
     const char *pos;
     cst_val *phones;
     cst_item *ssword, *sssyl, *segitem, *sylitem, *seg_in_syl;
     const cst_val *vpn;
     int dp = 0;
+    int lexp = 0;
+    cst_lex_cache *cache;
+    cst_lex_pron pron;
 
     lex = val_lexicon(feat_val(u->features,"lexicon"));
     if (lex->lex_addenda)
 	lex_addenda = lex->lex_addenda;
+    /* Words looked up before (with the same pos) needn't be again */
+    cache = lex_cache(lex,get_param_int(u->features,"lex_cache_size",512));
 
     syl = utt_relation_create(u,"Syllable");
     sylstructure = utt_relation_create(u,"SylStructure");
@@ -489,6 +592,7 @@ cst_utterance *default_lexical_insertion(cst_utterance *u)
 	phones = NULL;
         wp = NULL;
         dp = 0;  /* should the phones get deleted or not */
+        lexp = 0;  /* did they come from lex_lookup() */
         
         /*        printf("awb_debug word %s pos %s gpos %s\n",
                item_feat_string(word,"name"),
@@ -522,15 +626,24 @@ cst_utterance *default_lexical_insertion(cst_utterance *u)
             wp = val_assoc_string(item_feat_string(word, "name"),lex_addenda);
             if (wp)
                 phones = (cst_val *)val_cdr(val_cdr(wp));
+            else if (cache && lex_cache_lookup(cache,
+                                               item_feat_string(word,"name"),
+                                               pos,&pron))
+            {
+                lex_insert_pron(syl,seg,ssword,&pron);
+                continue;
+            }
             else
             {
                 dp = 1;
+                lexp = 1;
 		phones = lex_lookup(lex,item_feat_string(word,"name"),pos,
                                     u->features);
             }
 	}
 
-	for (sssyl=NULL,sylitem=NULL,p=phones; p; p=val_cdr(p))
+	for (pron.num_phones=0,sssyl=NULL,sylitem=NULL,p=phones; 
+             p; p=val_cdr(p))
 	{
 	    if (sylitem == NULL)
 	    {
@@ -539,21 +652,28 @@ cst_utterance *default_lexical_insertion(cst_utterance *u)
 		stress = "0";
 	    }
 	    segitem = relation_append(seg,NULL);
-	    phone_name = cst_strdup(val_string(val_car(p)));
-	    if (phone_name[cst_strlen(phone_name)-1] == '1')
+	    phone_name = val_string(val_car(p));
+	    len = cst_strlen(phone_name);
+	    if (phone_name[len-1] == '1')
 	    {
 		stress = "1";
-		phone_name[cst_strlen(phone_name)-1] = '\0';
+		len--;
 	    }
-	    else if (phone_name[cst_strlen(phone_name)-1] == '0')
+	    else if (phone_name[len-1] == '0')
 	    {
 		stress = "0";
-		phone_name[cst_strlen(phone_name)-1] = '\0';
+		len--;
 	    }
-	    item_set_string(segitem,"name",phone_name);
+	    item_set(segitem,"name",atom_val_n(phone_name,len));
 	    seg_in_syl = item_add_daughter(sssyl,segitem);
+            if (pron.num_phones < CST_LEX_PRON_MAX)
+            {
+                pron.phones[pron.num_phones] = item_feat(segitem,"name");
+                pron.syl_end[pron.num_phones] = CST_LEX_SYL_NONE;
+            }
+            pron.num_phones++;
 #if 0
-            printf("awb_debug ph %s\n",phone_name);
+            printf("awb_debug ph %s\n",item_feat_string(segitem,"name"));
 #endif
 	    if ((lex->syl_boundary)(seg_in_syl,val_cdr(p)))
 	    {
@@ -562,10 +682,16 @@ cst_utterance *default_lexical_insertion(cst_utterance *u)
 #endif
 		sylitem = NULL;
 		if (sssyl)
-		    item_set_string(sssyl,"stress",stress);
+		    item_set(sssyl,"stress",atom_val(stress));
+                if (pron.num_phones <= CST_LEX_PRON_MAX)
+                    pron.syl_end[pron.num_phones-1] = 
+                        (cst_streq(stress,"1") ? CST_LEX_SYL_STRESSED :
+                         CST_LEX_SYL_UNSTRESSED);
 	    }
-	    cst_free(phone_name);
 	}
+        /* Only what came from the lexicon itself can be reused */
+        if (cache && lexp && (pron.num_phones <= CST_LEX_PRON_MAX))
+            lex_cache_add(cache,item_feat_string(word,"name"),pos,&pron);
 	if (dp)
         {
 	    delete_val(phones);
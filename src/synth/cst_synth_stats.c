@@ -0,0 +1,283 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Optional timing and counts of what synthesis spends its time on      */
+/*                                                                       */
+/*************************************************************************/
+
+#include "cst_synth_stats.h"
+#include "cst_thread.h"
+#include "cst_wave.h"
+
+CST_VAL_REGISTER_TYPE(synth_stats,cst_synth_stats)
+
+int cst_synth_stats_on = FALSE;
+
+/* Only set up once stats are switched on */
+static cst_thread_key *synth_stats_current = NULL;
+static cst_mutex *synth_stats_lock = NULL;
+static cst_synth_stats synth_stats_totals;
+
+static const char * const synth_counter_names[CST_STAT_NUM_COUNTERS] = {
+    "cart_evals",
+    "lex_lookups",
+    "lex_hits",
+    "lex_lts",
+    "lex_cache_hits",
+    "samples",
+    "allocs",
+    "alloc_bytes"
+};
+
+cst_synth_stats *new_synth_stats(void)
+{
+    return cst_alloc(cst_synth_stats,1);
+}
+
+void delete_synth_stats(cst_synth_stats *s)
+{
+    cst_free(s);
+}
+
+void cst_synth_stats_enable(int on)
+{
+    cst_global_lock();
+    if (synth_stats_current == NULL)
+    {
+        synth_stats_current = new_thread_key();
+        synth_stats_lock = new_mutex();
+    }
+    cst_global_unlock();
+
+    cst_synth_stats_on = on;
+}
+
+void cst_synth_stats_count(cst_synth_counter c, int n)
+{
+    cst_synth_stats *s;
+
+    s = (cst_synth_stats *)cst_thread_key_get(synth_stats_current);
+    if (s)
+        s->counts[c] += n;
+}
+
+static cst_synth_module_stats *synth_stats_find_module(cst_synth_stats *s,
+                                                       const char *name)
+{
+    int i;
+
+    for (i=0; i<s->num_modules; i++)
+        if ((s->modules[i].name == name) ||
+            cst_streq(s->modules[i].name,name))
+            return &s->modules[i];
+    if (s->num_modules == CST_SYNTH_STATS_MAX_MODULES)
+        return NULL;  /* only so many are kept */
+    s->modules[s->num_modules].name = name;
+    return &s->modules[s->num_modules++];
+}
+
+static cst_synth_relation_stats *synth_stats_find_relation(cst_synth_stats *s,
+                                                           const char *name)
+{
+    int i;
+
+    for (i=0; i<s->num_relations; i++)
+        if (cst_streqn(s->relations[i].name,name,
+                       sizeof(s->relations[i].name)-1))
+            return &s->relations[i];
+    if (s->num_relations == CST_SYNTH_STATS_MAX_RELATIONS)
+        return NULL;
+    strncpy(s->relations[s->num_relations].name,name,
+            sizeof(s->relations[0].name)-1);
+    return &s->relations[s->num_relations++];
+}
+
+static void synth_stats_merge(cst_synth_stats *to, const cst_synth_stats *s)
+{
+    cst_synth_module_stats *m;
+    cst_synth_relation_stats *r;
+    int i;
+
+    to->num_utts += s->num_utts;
+    for (i=0; i<s->num_modules; i++)
+    {
+        if ((m = synth_stats_find_module(to,s->modules[i].name)))
+        {
+            m->calls += s->modules[i].calls;
+            m->wall += s->modules[i].wall;
+            m->cpu += s->modules[i].cpu;
+            m->allocs += s->modules[i].allocs;
+            m->alloc_bytes += s->modules[i].alloc_bytes;
+        }
+    }
+    for (i=0; i<s->num_relations; i++)
+    {
+        if ((r = synth_stats_find_relation(to,s->relations[i].name)))
+            r->items += s->relations[i].items;
+    }
+    for (i=0; i<CST_STAT_NUM_COUNTERS; i++)
+        to->counts[i] += s->counts[i];
+}
+
+cst_synth_stats *synth_stats_start(cst_synth_stats *run)
+{
+    /* run collects this call of apply_synth_method(), the previous */
+    /* one (if this is nested) is returned to be put back at the end */
+    cst_synth_stats *outer;
+
+    memset(run,0,sizeof(*run));
+    outer = (cst_synth_stats *)cst_thread_key_get(synth_stats_current);
+    cst_thread_key_set(synth_stats_current,run);
+
+    return outer;
+}
+
+void synth_stats_module(cst_synth_stats *s, const char *name,
+                        double wall, double cpu,
+                        const cst_alloc_counts *a0,
+                        const cst_alloc_counts *a1)
+{
+    /* a0 and a1 are this thread's allocations before and after */
+    cst_synth_module_stats *m;
+
+    s->counts[CST_STAT_ALLOCS] += a1->calls - a0->calls;
+    s->counts[CST_STAT_ALLOC_BYTES] += a1->bytes - a0->bytes;
+    if ((m = synth_stats_find_module(s,name)))
+    {
+        m->calls++;
+        m->wall += wall;
+        m->cpu += cpu;
+        m->allocs += a1->calls - a0->calls;
+        m->alloc_bytes += a1->bytes - a0->bytes;
+    }
+}
+
+void synth_stats_end(cst_utterance *u, cst_synth_stats *run,
+                     cst_synth_stats *outer)
+{
+    cst_synth_stats *us;
+    cst_synth_relation_stats *r;
+    const cst_featvalpair *fp;
+    const cst_item *i;
+    const cst_val *w;
+
+    cst_thread_key_set(synth_stats_current,outer);
+    if (u == NULL)
+        return;  /* failed, nothing to hang them on */
+
+    run->num_utts = 1;
+    for (fp=u->relations->head; fp; fp=fp->next)
+    {
+        if ((r = synth_stats_find_relation(run,fp->name)))
+            for (i=relation_head(val_relation(fp->val)); i; i=item_next(i))
+                r->items++;
+    }
+    if ((w = feat_val(u->features,"wave")))
+        run->counts[CST_STAT_SAMPLES] += val_wave(w)->num_samples;
+
+    if ((w = feat_val(u->features,"synth_stats")))
+        us = val_synth_stats(w);
+    else
+    {
+        us = new_synth_stats();
+        feat_set(u->features,"synth_stats",synth_stats_val(us));
+    }
+    synth_stats_merge(us,run);
+
+    cst_mutex_lock(synth_stats_lock);
+    synth_stats_merge(&synth_stats_totals,run);
+    cst_mutex_unlock(synth_stats_lock);
+}
+
+const cst_synth_stats *utt_synth_stats(const cst_utterance *u)
+{
+    const cst_val *v;
+
+    v = feat_val(u->features,"synth_stats");
+    if (v)
+        return val_synth_stats(v);
+    return NULL;
+}
+
+void cst_synth_stats_totals(cst_synth_stats *s)
+{
+    if (synth_stats_lock == NULL)
+    {   /* never switched on */
+        memset(s,0,sizeof(*s));
+        return;
+    }
+    cst_mutex_lock(synth_stats_lock);
+    memmove(s,&synth_stats_totals,sizeof(*s));
+    cst_mutex_unlock(synth_stats_lock);
+}
+
+void cst_synth_stats_reset(void)
+{
+    if (synth_stats_lock == NULL)
+        return;
+    cst_mutex_lock(synth_stats_lock);
+    memset(&synth_stats_totals,0,sizeof(synth_stats_totals));
+    cst_mutex_unlock(synth_stats_lock);
+}
+
+void cst_synth_stats_print(cst_file fd, const cst_synth_stats *s)
+{
+    double wall = 0.0, cpu = 0.0;
+    int i;
+
+    cst_fprintf(fd,"synth stats for %d utterances\n",s->num_utts);
+    cst_fprintf(fd,"  %-24s %8s %10s %10s %10s %12s\n","module","calls",
+                "wall ms","cpu ms","allocs","alloc bytes");
+    for (i=0; i<s->num_modules; i++)
+    {
+        cst_fprintf(fd,"  %-24s %8d %10.3f %10.3f %10.0f %12.0f\n",
+                    s->modules[i].name,s->modules[i].calls,
+                    s->modules[i].wall*1000.0,s->modules[i].cpu*1000.0,
+                    s->modules[i].allocs,s->modules[i].alloc_bytes);
+        wall += s->modules[i].wall;
+        cpu += s->modules[i].cpu;
+    }
+    cst_fprintf(fd,"  %-24s %8s %10.3f %10.3f %10.0f %12.0f\n","total","",
+                wall*1000.0,cpu*1000.0,
+                s->counts[CST_STAT_ALLOCS],s->counts[CST_STAT_ALLOC_BYTES]);
+    cst_fprintf(fd,"  items:");
+    for (i=0; i<s->num_relations; i++)
+        cst_fprintf(fd," %s %d",s->relations[i].name,s->relations[i].items);
+    cst_fprintf(fd,"\n  counts:");
+    for (i=0; i<CST_STAT_NUM_COUNTERS; i++)
+        cst_fprintf(fd," %s %.0f",synth_counter_names[i],s->counts[i]);
+    cst_fprintf(fd,"\n");
+}
@@ -40,6 +40,7 @@
 #include "cst_alloc.h"
 #include "cst_voice.h"
 #include "flite.h"
+#include "cst_clunits.h"
 
 CST_VAL_REGISTER_TYPE(voice,cst_voice)
 
@@ -55,6 +56,8 @@ cst_voice *new_voice()
 
 void delete_voice(cst_voice *v)
 {
+    void *voxfile = NULL;
+
     if (v)
     {
         if (feat_present(v->features,"voxdata"))
@@ -62,10 +65,16 @@ void delete_voice(cst_voice *v)
             if (feat_present(v->features,"clunit_db"))
                 flite_munmap_clunit_voxdata(v);
         }
+        if (feat_present(v->features,"clunit_voxfile"))
+            voxfile = val_userdata(feat_val(v->features,"clunit_voxfile"));
 
 	delete_features(v->features);
 	delete_features(v->ffunctions);
 	cst_free(v);
+
+        /* Loaded clunits voices, the features may point into this */
+        if (voxfile)
+            cst_clunits_free_voxfile(voxfile);
     }
 }
 
@@ -43,6 +43,7 @@
 #include "cst_alloc.h"
 #include "cst_clunits.h"
 #include "cst_cg.h"
+#include "cst_dsp.h"
 #include <fcntl.h>
 
 #ifdef WIN32
@@ -72,22 +73,46 @@ GLOBALVARDEF int flite_lang_list_length = 0;
 int flite_init()
 {
     cst_regex_init();
+    cst_dsp_init();
 
     return 0;
 }
 
 int flite_voice_dump(cst_voice *voice, const char *filename)
 {
-    return cst_cg_dump_voice(voice,filename);
+    if (feat_present(voice->features,"clunit_db"))
+        return cst_clunits_dump_voice(voice,filename);
+    else
+        return cst_cg_dump_voice(voice,filename);
+}
+
+int flite_voice_dump_joins(cst_voice *voice, const char *filename)
+{
+    /* Save the most used joins seen so far by a clunits voice, as C */
+    /* that can be compiled back into the voice                      */
+    const cst_val *cludb;
+
+    cludb = flite_get_param_val(voice->features,"clunit_db",NULL);
+    if (cludb == NULL)
+    {
+        cst_errmsg("flite_voice_dump_joins: %s is not a clunits voice\n",
+                   voice->name);
+        return -1;
+    }
+    return clunit_join_table_save(val_clunit_db(cludb),
+               flite_get_param_int(voice->features,"clunit_join_table_k",8),
+               filename);
 }
 
 cst_voice *flite_voice_load(const char *filename)
 {
-    /* Currently only supported for CG voices */
+    /* Supported for CG voices and (mmap'd, local) clunits voices */
     /* filename make be a local pathname or a url (http:/file:) */
     cst_voice *v = NULL;
 
-    v = cst_cg_load_voice(filename,flite_lang_list);
+    v = cst_clunits_load_voice(filename,flite_lang_list);
+    if (v == NULL)
+        v = cst_cg_load_voice(filename,flite_lang_list);
 
     return v;
 }
@@ -234,12 +259,24 @@ cst_utterance *flite_synth_phones(const char *text, cst_voice *voice)
     return flite_do_synth(u, voice, utt_synth_phones);
 }
 
+cst_utterance *flite_synth_into(cst_utterance *utt, const char *text,
+                                cst_voice *voice)
+{
+    utt_reset(utt);
+    utt_set_input_text(utt,text);
+    utt_init(utt, voice);
+    if (utt_synth(utt) == NULL)
+	return NULL;
+    else
+	return utt;
+}
+
 cst_wave *flite_text_to_wave(const char *text, cst_voice *voice)
 {
     cst_utterance *u;
     cst_wave *w;
 
-    if ((u = flite_synth_text(text,voice)) == NULL)
+    if ((u = flite_synth_text_cached(text,voice)) == NULL)
 	return NULL;
 
     w = copy_wave(utt_wave(u));
@@ -253,7 +290,7 @@ float flite_file_to_speech(const char *filename,
 {
     cst_tokenstream *ts;
 
-    if ((ts = ts_open(filename,
+    if ((ts = ts_open_mapped(filename,
 	      get_param_string(voice->features,"text_whitespace",NULL),
 	      get_param_string(voice->features,"text_singlecharsymbols",NULL),
 	      get_param_string(voice->features,"text_prepunctuation",NULL),
@@ -268,9 +305,99 @@ float flite_file_to_speech(const char *filename,
 }
 
 
+static int flite_outtype_is_file(const char *outtype)
+{
+    return (!cst_streq(outtype,"play") && 
+            !cst_streq(outtype,"none") &&
+            !cst_streq(outtype,"stream"));
+}
+
+cst_wave_sink *flite_open_sink(const char *outtype, cst_voice *voice)
+{
+    /* The sink for outtype if it is a file, NULL otherwise.  Files are */
+    /* written through one sink, rather than being opened, appended to  */
+    /* and having their header rewritten for each utterance             */
+    cst_wave_sink *sink;
+
+    if (!flite_outtype_is_file(outtype))
+        return NULL;
+    sink = cst_wave_sink_open(outtype,
+               get_param_string(voice->features,"output_type","riff"));
+    if (sink)
+        cst_wave_sink_set_checkpoint(sink,
+               get_param_float(voice->features,"output_checkpoint",0.0));
+    return sink;
+}
+
+float flite_sink_output(cst_utterance *u, cst_wave_sink *sink)
+{
+    cst_wave *w;
+
+    if (!u) return 0.0;
+
+    w = utt_wave(u);
+    if (sink)
+        cst_wave_sink_write(sink,w);
+
+    return (float)w->num_samples/(float)w->sample_rate;
+}
+
+cst_audio_player *flite_open_player(const char *outtype, cst_voice *voice)
+{
+    /* A player for "play", so each utterance is played while the next */
+    /* is synthesized, NULL otherwise                                   */
+    if (!cst_streq(outtype,"play") ||
+        !get_param_int(voice->features,"play_async",TRUE))
+        return NULL;
+    return new_audio_player(get_param_int(voice->features,
+                                          "play_buffer_size",0));
+}
+
+float flite_player_output(cst_utterance *u, cst_audio_player *player)
+{
+    cst_wave *w;
+
+    if (!u) return 0.0;
+
+    w = utt_wave(u);
+    audio_player_play(player,w);
+
+    return (float)w->num_samples/(float)w->sample_rate;
+}
+
+static float flite_ts_to_output(cst_tokenstream *ts,
+                                cst_voice *voice,
+                                const char *outtype,
+                                cst_wave_sink *sink);
+
 float flite_ts_to_speech(cst_tokenstream *ts,
                          cst_voice *voice,
                          const char *outtype)
+{
+    cst_wave_sink *sink;
+    float durs;
+
+    if (!flite_outtype_is_file(outtype))
+        return flite_ts_to_output(ts,voice,outtype,NULL);
+
+    sink = flite_open_sink(outtype,voice);
+    durs = flite_ts_to_output(ts,voice,"none",sink);
+    if (sink)
+        cst_wave_sink_close(sink);
+    return durs;
+}
+
+float flite_ts_to_sink(cst_tokenstream *ts,
+                       cst_voice *voice,
+                       cst_wave_sink *sink)
+{
+    return flite_ts_to_output(ts,voice,"none",sink);
+}
+
+static float flite_ts_to_output(cst_tokenstream *ts,
+                                cst_voice *voice,
+                                const char *outtype,
+                                cst_wave_sink *sink)
 {
     cst_utterance *utt;
     const char *token;
@@ -278,10 +405,10 @@ float flite_ts_to_speech(cst_tokenstream *ts,
     cst_relation *tokrel;
     float durs = 0;
     int num_tokens;
-    cst_wave *w;
     cst_breakfunc breakfunc = default_utt_break;
     cst_uttfunc utt_user_callback = 0;
-    int fp;
+    cst_audio_player *player;
+    int fp, interrupted = FALSE;
 
     fp = get_param_int(voice->features,"file_start_position",0);
     if (fp > 0)
@@ -292,18 +419,7 @@ float flite_ts_to_speech(cst_tokenstream *ts,
     if (feat_present(voice->features,"utt_user_callback"))
 	utt_user_callback = val_uttfunc(feat_val(voice->features,"utt_user_callback"));
 
-    /* If its a file to write to, create and save an empty wave file */
-    /* as we are going to incrementally append to it                 */
-    if (!cst_streq(outtype,"play") && 
-        !cst_streq(outtype,"none") &&
-        !cst_streq(outtype,"stream"))
-    {
-	w = new_wave();
-	cst_wave_resize(w,0,1);
-	cst_wave_set_sample_rate(w,16000);
-	cst_wave_save_riff(w,outtype);  /* an empty wave */
-	delete_wave(w);
-    }
+    player = flite_open_player(outtype,voice);
 
     num_tokens = 0;
     utt = new_utterance();
@@ -323,20 +439,30 @@ float flite_ts_to_speech(cst_tokenstream *ts,
             if (utt)
             {
                 utt = flite_do_synth(utt,voice,utt_synth_tokens);
-                if (feat_present(utt->features,"Interrupted"))
+                if ((utt == NULL) || 
+                    feat_present(utt->features,"Interrupted"))
                 {
-                    delete_utterance(utt); utt = NULL;
+                    interrupted = TRUE;
                     break;
                 }
-                durs += flite_process_output(utt,outtype,TRUE);
-                delete_utterance(utt); utt = NULL;
+                if (sink)
+                    durs += flite_sink_output(utt,sink);
+                else if (player)
+                    durs += flite_player_output(utt,player);
+                else
+                    durs += flite_process_output(utt,outtype,TRUE);
             }
             else 
+            {
+                interrupted = TRUE;
                 break;
+            }
 
-	    if (ts_eof(ts)) break;
+	    /* token may be the start of the last utterance */
+	    if (ts_eof(ts) && (cst_strlen(token) == 0)) break;
 
-	    utt = new_utterance();
+            /* The next utterance reuses this one's memory */
+	    utt_reset(utt);
 	    tokrel = utt_relation_create(utt, "Token");
 	    num_tokens = 0;
 	}
@@ -344,9 +470,9 @@ float flite_ts_to_speech(cst_tokenstream *ts,
 
 	t = relation_append(tokrel, NULL);
 	item_set_string(t,"name",token);
-	item_set_string(t,"whitespace",ts->whitespace);
-	item_set_string(t,"prepunctuation",ts->prepunctuation);
-	item_set_string(t,"punc",ts->postpunctuation);
+	item_set(t,"whitespace",ts_part_val(ts->whitespace));
+	item_set(t,"prepunctuation",ts_part_val(ts->prepunctuation));
+	item_set(t,"punc",ts_part_val(ts->postpunctuation));
         /* Mark it at the beginning of the token */
 	item_set_int(t,"file_pos",
                      ts->file_pos-(1+ /* as we are already on the next char */
@@ -356,6 +482,12 @@ float flite_ts_to_speech(cst_tokenstream *ts,
 	item_set_int(t,"line_number",ts->line_number);
     }
     if (utt) delete_utterance(utt);
+    if (player)
+    {   /* the rest is played first, unless synthesis was stopped */
+        if (interrupted)
+            audio_player_stop(player);
+        delete_audio_player(player);
+    }
     ts_close(ts);
     return durs;
 }
@@ -367,7 +499,7 @@ float flite_text_to_speech(const char *text,
     cst_utterance *u;
     float dur;
 
-    u = flite_synth_text(text,voice);
+    u = flite_synth_text_cached(text,voice);
     dur = flite_process_output(u,outtype,FALSE);
     delete_utterance(u);
 
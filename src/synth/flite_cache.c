@@ -0,0 +1,700 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Cache of synthesized prompts                                         */
+/*                                                                       */
+/*  Whole waves kept by a hash of the voice, the voice features that     */
+/*  change its output and the (whitespace normalized) text, so the most  */
+/*  common prompts needn't be synthesized again.  Entries are limited by */
+/*  total size and age, least recently used go first, and may also be    */
+/*  kept on disk (one file per prompt, mmap'd when read back) to be      */
+/*  shared between processes and runs.  The segments' names and end      */
+/*  samples, and the words and SSML marks they start, are kept with the  */
+/*  wave so a cached prompt gives the same streaming events as a new one */
+/*                                                                       */
+/*************************************************************************/
+
+#include <time.h>
+#include "flite.h"
+#include "cst_thread.h"
+
+CST_VAL_REGISTER_TYPE_NODEL(prompt_cache,flite_prompt_cache)
+
+/* Voice features that change what a voice says (and how) */
+static const char * const prompt_cache_features[] = {
+    "duration_stretch",
+    "int_f0_target_mean",
+    "int_f0_target_stddev",
+    "f0_shift",
+    "mlsa_speed_param",
+    "synthesis_tier",
+    "resynth_type",
+    NULL };
+
+#define PROMPT_CACHE_MAGIC 0x33435046   /* "FPC3" */
+#define PROMPT_CACHE_HEADER 8           /* ints, before the key and segs */
+
+/* The created time is kept in two ints (low word first) so it's */
+/* 64 bits whatever the size of int or time_t                   */
+static time_t prompt_cache_get_time(const int *h)
+{
+    return (time_t)(((uint64_t)(unsigned int)h[6] << 32) |
+                    (uint64_t)(unsigned int)h[5]);
+}
+
+static void prompt_cache_set_time(int *h, time_t t)
+{
+    h[5] = (int)(unsigned int)((uint64_t)t & 0xffffffff);
+    h[6] = (int)(unsigned int)((uint64_t)t >> 32);
+}
+
+typedef struct prompt_cache_entry_struct {
+    uint64_t hash;
+    char *key;
+    cst_wave *wave;
+    char *segs;                         /* see prompt_cache_segs() */
+    int size;                           /* bytes charged to the cache */
+    time_t created;
+    struct prompt_cache_entry_struct *next;      /* in bucket */
+    struct prompt_cache_entry_struct *lru_prev;  /* more recently used */
+    struct prompt_cache_entry_struct *lru_next;  /* less recently used */
+} prompt_cache_entry;
+
+struct flite_prompt_cache_struct {
+    int max_bytes;
+    int ttl;                            /* seconds, 0 for no limit */
+    char *dir;                          /* for copies on disk, or NULL */
+
+    cst_mutex *lock;                    /* protects everything below */
+    int num_buckets;
+    prompt_cache_entry **buckets;
+    prompt_cache_entry *lru_head;
+    prompt_cache_entry *lru_tail;
+    flite_prompt_cache_counts counts;
+};
+
+flite_prompt_cache *new_flite_prompt_cache(int max_bytes, int ttl,
+                                           const char *dir)
+{
+    flite_prompt_cache *c;
+
+    c = cst_alloc(flite_prompt_cache,1);
+    c->max_bytes = max_bytes;
+    c->ttl = ttl;
+    if (dir)
+        c->dir = cst_strdup(dir);
+    c->lock = new_mutex();
+    c->num_buckets = 256;
+    c->buckets = cst_alloc(prompt_cache_entry *,c->num_buckets);
+
+    return c;
+}
+
+static void delete_prompt_cache_entry(prompt_cache_entry *e)
+{
+    cst_free(e->key);
+    cst_free(e->segs);
+    delete_wave(e->wave);
+    cst_free(e);
+}
+
+void delete_flite_prompt_cache(flite_prompt_cache *c)
+{
+    prompt_cache_entry *e, *ne;
+
+    if (c == NULL)
+        return;
+    for (e=c->lru_head; e; e=ne)
+    {
+        ne = e->lru_next;
+        delete_prompt_cache_entry(e);
+    }
+    cst_free(c->buckets);
+    cst_free(c->dir);
+    delete_mutex(c->lock);
+    cst_free(c);
+}
+
+void flite_prompt_cache_stats(flite_prompt_cache *c,
+                              flite_prompt_cache_counts *counts)
+{
+    cst_mutex_lock(c->lock);
+    *counts = c->counts;
+    cst_mutex_unlock(c->lock);
+}
+
+static char *prompt_cache_key(const cst_voice *voice, const char *text)
+{
+    /* voice name, the features that matter, then the text with  */
+    /* whitespace runs made single spaces and none at either end */
+    /* String features (synthesis_tier, resynth_type) are written as */
+    /* they are, as feat_float() would make them all 0                */
+    char *key, *k;
+    const char *t;
+    const cst_val *v;
+    int i, size;
+
+    size = cst_strlen(voice->name) + cst_strlen(text) + 2;
+    for (i=0; prompt_cache_features[i]; i++)
+    {
+        size += cst_strlen(prompt_cache_features[i]) + 32;
+        v = get_param_val(voice->features,prompt_cache_features[i],NULL);
+        if (v && val_stringp(v))
+            size += cst_strlen(val_string(v));
+    }
+    k = key = cst_alloc(char,size);
+
+    cst_sprintf(k,"%s\n",voice->name);
+    k += cst_strlen(k);
+    for (i=0; prompt_cache_features[i]; i++)
+    {
+        v = get_param_val(voice->features,prompt_cache_features[i],NULL);
+        if (v == NULL)
+            continue;
+        if (val_stringp(v))
+            cst_sprintf(k,"%s=%s\n",prompt_cache_features[i],val_string(v));
+        else
+            cst_sprintf(k,"%s=%g\n",prompt_cache_features[i],val_float(v));
+        k += cst_strlen(k);
+    }
+
+    for (t=text; *t; t++)
+    {
+        if (strchr(" \t\n\r",*t))
+        {
+            if ((k > key) && (k[-1] != ' ') && (k[-1] != '\n'))
+                *k++ = ' ';
+        }
+        else
+            *k++ = *t;
+    }
+    if ((k > key) && (k[-1] == ' '))
+        k--;
+    *k = '\0';
+
+    return key;
+}
+
+static uint64_t prompt_cache_hash(const char *key)
+{
+    /* 64 bit FNV-1a */
+    uint64_t h = 14695981039346656037ULL;
+
+    for ( ; *key; key++)
+    {
+        h ^= (unsigned char)*key;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+static char *prompt_cache_segs(cst_utterance *u, int sample_rate)
+{
+    /* A line for each segment, tab separated: its end sample and name, */
+    /* s if it starts a word, w if it's later in one, - if in none, and */
+    /* the word and mark (if any) it starts                             */
+    const cst_item *seg, *ss, *syl, *word, *tw;
+    const char *f, *w, *m;
+    char *segs, *sg;
+    int size = 1;
+
+    for (seg=relation_head(utt_relation(u,"Segment")); seg; seg=item_next(seg))
+        size += cst_strlen(item_feat_string(seg,"name")) + 20;
+    for (word=relation_head(utt_relation(u,"Word")); word; word=item_next(word))
+    {
+        size += cst_strlen(item_feat_string(word,"name")) + 2;
+        tw = item_as(word,"Token");
+        if (tw && item_parent(tw) &&
+            item_feat_present(item_parent(tw),"ssml_mark"))
+            size += cst_strlen(item_feat_string(item_parent(tw),"ssml_mark"));
+    }
+    sg = segs = cst_alloc(char,size);
+
+    for (seg=relation_head(utt_relation(u,"Segment")); seg; seg=item_next(seg))
+    {
+        f = "-";
+        w = m = "";
+        ss = item_as(seg,"SylStructure");
+        if (ss)
+            f = "w";
+        if (ss && !item_prev(ss) &&
+            ((syl = item_parent(ss)) != NULL) && !item_prev(syl) &&
+            ((word = item_parent(syl)) != NULL))
+        {
+            f = "s";
+            w = item_feat_string(word,"name");
+            tw = item_as(word,"Token");
+            if (tw && !item_prev(tw) && item_parent(tw) &&
+                item_feat_present(item_parent(tw),"ssml_mark"))
+                m = item_feat_string(item_parent(tw),"ssml_mark");
+        }
+        cst_sprintf(sg,"%d\t%s\t%s\t%s\t%s\n",
+                    audio_segment_end_sample(seg,sample_rate),
+                    item_feat_string(seg,"name"),f,w,m);
+        sg += cst_strlen(sg);
+    }
+
+    return segs;
+}
+
+static char *prompt_cache_field(char **p)
+{
+    /* The next tab or newline ended field in *p, made NUL terminated */
+    char *f = *p;
+
+    *p += strcspn(*p,"\t\n");
+    if (**p)
+        *(*p)++ = '\0';
+    return f;
+}
+
+static void prompt_cache_relations(cst_utterance *u, const char *segs,
+                                   int sample_rate)
+{
+    /* Enough of the Segment, Word, SylStructure and Token relations   */
+    /* from segs for the streaming events: each word has one syllable */
+    cst_relation *seg_r, *word_r, *ss_r, *tok_r;
+    cst_item *seg, *word, *syl = NULL, *tok;
+    char *copy, *p, *end, *name, *f, *w, *m;
+
+    seg_r = utt_relation_create(u,"Segment");
+    word_r = utt_relation_create(u,"Word");
+    ss_r = utt_relation_create(u,"SylStructure");
+    tok_r = utt_relation_create(u,"Token");
+
+    copy = cst_strdup(segs);
+    for (p=copy; *p; )
+    {
+        end = prompt_cache_field(&p);
+        name = prompt_cache_field(&p);
+        f = prompt_cache_field(&p);
+        w = prompt_cache_field(&p);
+        m = prompt_cache_field(&p);
+        seg = relation_append(seg_r,NULL);
+        item_set_string(seg,"name",name);
+        item_set_int(seg,"end_sample",atoi(end));
+        item_set_float(seg,"end",(float)atoi(end)/(float)sample_rate);
+        if (*f == 's')
+        {
+            word = relation_append(word_r,NULL);
+            item_set_string(word,"name",w);
+            syl = item_add_daughter(relation_append(ss_r,word),NULL);
+            if (*m)
+            {
+                tok = relation_append(tok_r,NULL);
+                item_set_string(tok,"ssml_mark",m);
+                item_add_daughter(tok,word);
+            }
+        }
+        if (syl && ((*f == 's') || (*f == 'w')))
+            item_add_daughter(syl,seg);
+    }
+    cst_free(copy);
+}
+
+static char *prompt_cache_filename(flite_prompt_cache *c, uint64_t hash)
+{
+    char *fn;
+
+    fn = cst_alloc(char,cst_strlen(c->dir)+32);
+    cst_sprintf(fn,"%s/%08x%08x.fpc",c->dir,
+                (unsigned int)(hash>>32),(unsigned int)hash);
+    return fn;
+}
+
+static void lru_unlink(flite_prompt_cache *c, prompt_cache_entry *e)
+{
+    if (e->lru_prev)
+        e->lru_prev->lru_next = e->lru_next;
+    else
+        c->lru_head = e->lru_next;
+    if (e->lru_next)
+        e->lru_next->lru_prev = e->lru_prev;
+    else
+        c->lru_tail = e->lru_prev;
+    e->lru_prev = e->lru_next = NULL;
+}
+
+static void lru_push(flite_prompt_cache *c, prompt_cache_entry *e)
+{
+    e->lru_next = c->lru_head;
+    if (c->lru_head)
+        c->lru_head->lru_prev = e;
+    c->lru_head = e;
+    if (c->lru_tail == NULL)
+        c->lru_tail = e;
+}
+
+static void prompt_cache_remove(flite_prompt_cache *c, prompt_cache_entry *e)
+{
+    prompt_cache_entry **p;
+
+    for (p=&c->buckets[e->hash&(c->num_buckets-1)]; *p != e; p=&(*p)->next);
+    *p = e->next;
+    lru_unlink(c,e);
+    c->counts.entries--;
+    c->counts.bytes -= e->size;
+    delete_prompt_cache_entry(e);
+}
+
+static void prompt_cache_grow(flite_prompt_cache *c)
+{
+    prompt_cache_entry **old = c->buckets;
+    prompt_cache_entry *e, *ne;
+    int i, old_size = c->num_buckets;
+
+    c->num_buckets *= 2;
+    c->buckets = cst_alloc(prompt_cache_entry *,c->num_buckets);
+    for (i=0; i<old_size; i++)
+        for (e=old[i]; e; e=ne)
+        {
+            ne = e->next;
+            e->next = c->buckets[e->hash&(c->num_buckets-1)];
+            c->buckets[e->hash&(c->num_buckets-1)] = e;
+        }
+    cst_free(old);
+}
+
+/* Takes ownership of w, c must be locked */
+static void prompt_cache_insert(flite_prompt_cache *c, uint64_t hash,
+                                const char *key, cst_wave *w,
+                                const char *segs, time_t created)
+{
+    prompt_cache_entry *e;
+    int b;
+
+    e = cst_alloc(prompt_cache_entry,1);
+    e->hash = hash;
+    e->key = cst_strdup(key);
+    e->wave = w;
+    e->segs = cst_strdup(segs);
+    e->size = (w->num_samples*w->num_channels*sizeof(short)) +
+        cst_strlen(key) + cst_strlen(segs) + sizeof(prompt_cache_entry);
+    e->created = created;
+
+    if (e->size > c->max_bytes)
+    {   /* too big to ever keep */
+        delete_prompt_cache_entry(e);
+        return;
+    }
+    while (c->lru_tail && (c->counts.bytes + e->size > c->max_bytes))
+    {
+        prompt_cache_remove(c,c->lru_tail);
+        c->counts.evictions++;
+    }
+
+    if (c->counts.entries >= c->num_buckets)
+        prompt_cache_grow(c);
+    b = hash&(c->num_buckets-1);
+    e->next = c->buckets[b];
+    c->buckets[b] = e;
+    lru_push(c,e);
+    c->counts.entries++;
+    c->counts.bytes += e->size;
+}
+
+static cst_wave *prompt_cache_read_file(flite_prompt_cache *c, uint64_t hash,
+                                        const char *key, time_t *created,
+                                        char **segs)
+{
+    /* A copy of the wave (and segs) in the file for hash, if it is */
+    /* really for key                                               */
+    char *fn;
+    cst_file fd;
+    cst_filemap *fmap;
+    const int *h;
+    const char *body;
+    cst_wave *w = NULL;
+    int key_len, num_samples, num_channels, padded, expired = FALSE;
+    size_t file_size, segs_padded;
+    time_t t;
+
+    fn = prompt_cache_filename(c,hash);
+    /* Check it's there first, as cst_mmap_file complains if it isn't, */
+    /* and get its real size, as the map is rounded up to whole pages  */
+    if ((fd = cst_fopen(fn,CST_OPEN_READ|CST_OPEN_BINARY)) == NULL)
+    {
+        cst_free(fn);
+        return NULL;
+    }
+    cst_fseek(fd,0,CST_SEEK_ENDREL);
+    file_size = (size_t)cst_ftell(fd);
+    cst_fclose(fd);
+    fmap = cst_mmap_file(fn);
+    if (fmap == NULL)
+    {
+        cst_free(fn);
+        return NULL;
+    }
+
+    h = (const int *)fmap->mem;
+    key_len = cst_strlen(key);
+    padded = (key_len+3)/4*4;
+    if ((file_size > fmap->mapsize) ||
+        (file_size < PROMPT_CACHE_HEADER*sizeof(int)))
+    {   /* truncated, don't look at the header at all */
+        cst_munmap_file(fmap);
+        cst_free(fn);
+        return NULL;
+    }
+    num_channels = h[3];
+    num_samples = h[4];
+    t = prompt_cache_get_time(h);
+    segs_padded = ((size_t)(unsigned int)h[7]+3)/4*4;
+    body = (const char *)&h[PROMPT_CACHE_HEADER];
+    if ((h[0] == PROMPT_CACHE_MAGIC) &&
+        (h[1] == key_len) && (num_channels > 0) && (num_samples >= 0) &&
+        (h[7] >= 0) &&
+        (file_size >= PROMPT_CACHE_HEADER*sizeof(int) + padded + segs_padded) &&
+        ((file_size - PROMPT_CACHE_HEADER*sizeof(int) - padded - segs_padded) /
+         (num_channels*sizeof(short)) >= (size_t)num_samples) &&
+        (strncmp(body,key,key_len) == 0))
+    {
+        if (c->ttl && (time(NULL) - t > c->ttl))
+            expired = TRUE;
+        else
+        {
+            w = new_wave();
+            w->sample_rate = h[2];
+            cst_wave_resize(w,num_samples,num_channels);
+            memmove(w->samples,body + padded + segs_padded,
+                    num_samples*num_channels*sizeof(short));
+            *segs = cst_alloc(char,h[7]+1);
+            memmove(*segs,body + padded,h[7]);
+            *created = t;
+        }
+    }
+    cst_munmap_file(fmap);
+    /* Nothing else removes old files, so do it when they're found */
+    if (expired)
+        remove(fn);
+    cst_free(fn);
+
+    return w;
+}
+
+static void prompt_cache_write_file(flite_prompt_cache *c, uint64_t hash,
+                                    const char *key, const cst_wave *w,
+                                    const char *segs, time_t created)
+{
+    /* Written to a temporary file then renamed, so readers (maybe in */
+    /* other processes) never see part of one                         */
+    char *fn, *tmp;
+    cst_file fd;
+    int h[PROMPT_CACHE_HEADER];
+    int key_len, padded, segs_len, segs_padded;
+    char zeros[4] = { 0, 0, 0, 0 };
+
+    fn = prompt_cache_filename(c,hash);
+    tmp = cst_strcat(fn,".tmp");
+    if ((fd = cst_fopen(tmp,CST_OPEN_WRITE|CST_OPEN_BINARY)) != NULL)
+    {
+        key_len = cst_strlen(key);
+        padded = (key_len+3)/4*4;
+        segs_len = cst_strlen(segs);
+        segs_padded = (segs_len+3)/4*4;
+        h[0] = PROMPT_CACHE_MAGIC;
+        h[1] = key_len;
+        h[2] = w->sample_rate;
+        h[3] = w->num_channels;
+        h[4] = w->num_samples;
+        prompt_cache_set_time(h,created);
+        h[7] = segs_len;
+        cst_fwrite(fd,h,sizeof(int),PROMPT_CACHE_HEADER);
+        cst_fwrite(fd,key,sizeof(char),key_len);
+        cst_fwrite(fd,zeros,sizeof(char),padded-key_len);
+        cst_fwrite(fd,segs,sizeof(char),segs_len);
+        cst_fwrite(fd,zeros,sizeof(char),segs_padded-segs_len);
+        cst_fwrite(fd,w->samples,sizeof(short),
+                   w->num_samples*w->num_channels);
+        cst_fclose(fd);
+        if (rename(tmp,fn) != 0)
+            remove(tmp);
+    }
+    cst_free(tmp);
+    cst_free(fn);
+}
+
+/* The entry for key, c must be locked */
+static prompt_cache_entry *prompt_cache_find(flite_prompt_cache *c,
+                                             uint64_t hash, const char *key)
+{
+    prompt_cache_entry *e;
+
+    for (e=c->buckets[hash&(c->num_buckets-1)]; e; e=e->next)
+        if ((e->hash == hash) && cst_streq(e->key,key))
+            break;
+    return e;
+}
+
+static cst_wave *prompt_cache_get(flite_prompt_cache *c, uint64_t hash,
+                                  const char *key, char **segs)
+{
+    prompt_cache_entry *e;
+    cst_wave *w = NULL;
+    time_t created;
+
+    cst_mutex_lock(c->lock);
+    e = prompt_cache_find(c,hash,key);
+    if (e && c->ttl && (time(NULL) - e->created > c->ttl))
+    {
+        prompt_cache_remove(c,e);
+        c->counts.expired++;
+        e = NULL;
+    }
+    if (e)
+    {
+        lru_unlink(c,e);
+        lru_push(c,e);
+        w = copy_wave(e->wave);
+        *segs = cst_strdup(e->segs);
+        c->counts.hits++;
+    }
+    cst_mutex_unlock(c->lock);
+    if (e)
+        return w;
+
+    /* Disk reads are done unlocked, so they don't hold up other threads */
+    if (c->dir)
+        w = prompt_cache_read_file(c,hash,key,&created,segs);
+
+    cst_mutex_lock(c->lock);
+    if (w)
+    {
+        /* Another thread may have read (or made) it meanwhile */
+        if (prompt_cache_find(c,hash,key) == NULL)
+            prompt_cache_insert(c,hash,key,copy_wave(w),*segs,created);
+        c->counts.hits++;
+        c->counts.disk_hits++;
+    }
+    else
+        c->counts.misses++;
+    cst_mutex_unlock(c->lock);
+
+    return w;
+}
+
+static void prompt_cache_put(flite_prompt_cache *c, uint64_t hash,
+                             const char *key, const cst_wave *w,
+                             const char *segs)
+{
+    int inserted = FALSE;
+    time_t now = time(NULL);
+
+    cst_mutex_lock(c->lock);
+    /* Someone else may have synthesized it in the meantime */
+    if (prompt_cache_find(c,hash,key) == NULL)
+    {
+        prompt_cache_insert(c,hash,key,copy_wave(w),segs,now);
+        inserted = TRUE;
+    }
+    cst_mutex_unlock(c->lock);
+
+    /* w is the caller's, so it may be written out unlocked */
+    if (inserted && c->dir)
+        prompt_cache_write_file(c,hash,key,w,segs,now);
+}
+
+static int prompt_cache_stream(cst_utterance *u, const cst_wave *w,
+                               cst_audio_streaming_info *asi)
+{
+    /* Give the wave to the streaming callback in pieces, as if it */
+    /* was being synthesized                                        */
+    int start, size, rc = CST_AUDIO_STREAM_CONT;
+
+    asi->utt = u;
+    for (start=0; start < w->num_samples; start += size)
+    {
+        size = w->num_samples - start;
+        if ((asi->min_buffsize > 0) && (size > asi->min_buffsize))
+            size = asi->min_buffsize;
+        rc = audio_stream_send(asi,w,start,size,
+                               (start+size == w->num_samples));
+        if (rc == CST_AUDIO_STREAM_STOP)
+            break;
+    }
+    if (w->num_samples == 0)
+        rc = audio_stream_send(asi,w,0,0,1);
+
+    return rc;
+}
+
+cst_utterance *flite_synth_text_cached(const char *text, cst_voice *voice)
+{
+    const cst_val *v;
+    flite_prompt_cache *c;
+    cst_utterance *u;
+    cst_wave *w;
+    char *key, *segs = NULL;
+    uint64_t hash;
+
+    v = get_param_val(voice->features,"prompt_cache",NULL);
+    if (v == NULL)
+        return flite_synth_text(text,voice);
+    c = val_prompt_cache(v);
+
+    key = prompt_cache_key(voice,text);
+    hash = prompt_cache_hash(key);
+
+    if ((w = prompt_cache_get(c,hash,key,&segs)) != NULL)
+    {
+        u = new_utterance();
+        utt_set_input_text(u,text);
+        utt_init(u,voice);
+        prompt_cache_relations(u,segs,w->sample_rate);
+        utt_set_wave(u,w);
+        v = get_param_val(u->features,"streaming_info",NULL);
+        if (v && (prompt_cache_stream(u,w,val_audio_streaming_info(v)) ==
+                  CST_AUDIO_STREAM_STOP))
+        {
+            delete_utterance(u);
+            u = NULL;
+        }
+    }
+    else
+    {
+        u = flite_synth_text(text,voice);
+        if (u && feat_present(u->features,"wave"))
+        {
+            segs = prompt_cache_segs(u,utt_wave(u)->sample_rate);
+            prompt_cache_put(c,hash,key,utt_wave(u),segs);
+        }
+    }
+
+    cst_free(segs);
+    cst_free(key);
+    return u;
+}
@@ -0,0 +1,244 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Incremental text input                                               */
+/*                                                                       */
+/*  For text that arrives a piece at a time (e.g. generated text), it is */
+/*  pushed into a growable buffer that a tokenstream (ts_open_generic)   */
+/*  reads from.  A background thread runs the usual flite_ts_to_speech() */
+/*  loop on it, so each utterance is synthesized as soon as the utterance*/
+/*  break function can see its end, while more text is still arriving.   */
+/*  Where there are no threads, everything is synthesized at close       */
+/*                                                                       */
+/*************************************************************************/
+
+#include "flite.h"
+#include "cst_thread.h"
+
+struct flite_stream_struct {
+    cst_voice *voice;
+    char *outtype;
+
+    cst_mutex *lock;       /* protects everything below */
+    cst_cond *more;        /* signalled when text is added or closed */
+    char *buf;
+    int buf_len;
+    int buf_max;
+    int buf_pos;           /* next char to read */
+    int buf_start;         /* stream position of buf[0] */
+    int closed;            /* no more text will be pushed */
+    int finished;          /* synthesis has stopped (e.g. interrupted) */
+
+    cst_thread *thread;
+    float durs;
+};
+
+static int stream_ts_open(cst_tokenstream *ts, const char *filename)
+{
+    return TRUE;
+}
+
+static void stream_ts_close(cst_tokenstream *ts)
+{
+    /* The buffer belongs to the flite_stream */
+    return;
+}
+
+static int stream_ts_eof(cst_tokenstream *ts)
+{
+    return ts->eof_flag;
+}
+
+static int stream_ts_tell(cst_tokenstream *ts)
+{
+    flite_stream *s = (flite_stream *)ts->streamtype_data;
+    int pos;
+
+    cst_mutex_lock(s->lock);
+    pos = s->buf_start + s->buf_pos;
+    cst_mutex_unlock(s->lock);
+
+    return pos;
+}
+
+static int stream_ts_seek(cst_tokenstream *ts, int pos)
+{
+    /* Can only "seek" to where we already are */
+    return stream_ts_tell(ts);
+}
+
+static int stream_ts_size(cst_tokenstream *ts)
+{
+    flite_stream *s = (flite_stream *)ts->streamtype_data;
+    int size;
+
+    cst_mutex_lock(s->lock);
+    size = s->buf_start + s->buf_len;
+    cst_mutex_unlock(s->lock);
+
+    return size;
+}
+
+static int stream_ts_getc(cst_tokenstream *ts)
+{
+    /* Waits for more text, it is only the end when the stream is closed */
+    flite_stream *s = (flite_stream *)ts->streamtype_data;
+
+    cst_mutex_lock(s->lock);
+    while ((s->buf_pos >= s->buf_len) && !s->closed)
+        cst_cond_wait(s->more,s->lock);
+    if (s->buf_pos >= s->buf_len)
+    {
+        ts->eof_flag = TRUE;
+        ts->current_char = '\0';
+    }
+    else
+    {
+        ts->current_char = s->buf[s->buf_pos++];
+        ts->file_pos++;
+    }
+    cst_mutex_unlock(s->lock);
+
+    if (ts->current_char == '\n')
+        ts->line_number++;
+    return ts->current_char;
+}
+
+static void *flite_stream_run(void *v)
+{
+    flite_stream *s = (flite_stream *)v;
+    cst_tokenstream *ts;
+    float durs = 0.0;
+
+    ts = ts_open_generic(NULL,
+           get_param_string(s->voice->features,"text_whitespace",NULL),
+           get_param_string(s->voice->features,"text_singlecharsymbols",NULL),
+           get_param_string(s->voice->features,"text_prepunctuation",NULL),
+           get_param_string(s->voice->features,"text_postpunctuation",NULL),
+           s,
+           stream_ts_open,
+           stream_ts_close,
+           stream_ts_eof,
+           stream_ts_seek,
+           stream_ts_tell,
+           stream_ts_size,
+           stream_ts_getc);
+    if (ts)
+        durs = flite_ts_to_speech(ts,s->voice,s->outtype);
+
+    cst_mutex_lock(s->lock);
+    s->durs = durs;
+    s->finished = TRUE;
+    cst_mutex_unlock(s->lock);
+
+    return NULL;
+}
+
+flite_stream *flite_stream_open(cst_voice *voice, const char *outtype)
+{
+    flite_stream *s = cst_alloc(flite_stream,1);
+
+    s->voice = voice;
+    s->outtype = cst_strdup(outtype);
+    s->lock = new_mutex();
+    s->more = new_cond();
+    s->buf_max = 1024;
+    s->buf = cst_alloc(char,s->buf_max);
+
+    s->thread = cst_thread_create(flite_stream_run,s);
+
+    return s;
+}
+
+int flite_stream_push_text(flite_stream *s, const char *chunk)
+{
+    int n = cst_strlen(chunk);
+
+    cst_mutex_lock(s->lock);
+    if (s->closed || s->finished)
+    {
+        cst_mutex_unlock(s->lock);
+        return -1;
+    }
+
+    if (s->buf_len + n > s->buf_max)
+    {
+        if (s->buf_pos > 0)
+        {   /* drop what has already been read */
+            memmove(s->buf,s->buf+s->buf_pos,s->buf_len-s->buf_pos);
+            s->buf_start += s->buf_pos;
+            s->buf_len -= s->buf_pos;
+            s->buf_pos = 0;
+        }
+        if (s->buf_len + n > s->buf_max)
+        {
+            s->buf_max = (s->buf_len + n) * 2;
+            s->buf = cst_realloc(s->buf,char,s->buf_max);
+        }
+    }
+    memmove(s->buf+s->buf_len,chunk,n);
+    s->buf_len += n;
+
+    cst_cond_signal(s->more);
+    cst_mutex_unlock(s->lock);
+
+    return 0;
+}
+
+float flite_stream_close(flite_stream *s)
+{
+    /* No more text, wait for synthesis to finish */
+    float durs;
+
+    cst_mutex_lock(s->lock);
+    s->closed = TRUE;
+    cst_cond_signal(s->more);
+    cst_mutex_unlock(s->lock);
+
+    if (s->thread)
+        cst_thread_join(s->thread);
+    else
+        flite_stream_run(s);
+    durs = s->durs;
+
+    delete_cond(s->more);
+    delete_mutex(s->lock);
+    cst_free(s->buf);
+    cst_free(s->outtype);
+    cst_free(s);
+
+    return durs;
+}
@@ -37,9 +37,12 @@
 /*  Basic wraparounds for malloc and free                                */
 /*                                                                       */
 /*************************************************************************/
+#include <stdlib.h>
 #include "cst_file.h"
 #include "cst_alloc.h"
 #include "cst_error.h"
+#include "cst_string.h"
+#include "cst_thread.h"
 
 #ifdef UNDER_CE
 #include <windows.h>
@@ -64,8 +67,165 @@ void *cst_alloc_cunks[NUM_CHUNKS];
 #endif
 #endif
 
+/* Allocation statistics: when on, each block starts with a header */
+/* holding its size.  Whether they are on is decided once, at the    */
+/* first allocation, as blocks with and without can't be mixed       */
+#define CST_ALLOC_HEADER 16
+
+#if defined(__GNUC__)
+#define CST_ATOMIC_ADD(P,N) __atomic_add_fetch((P),(N),__ATOMIC_RELAXED)
+#define CST_ATOMIC_LOAD(P) __atomic_load_n((P),__ATOMIC_RELAXED)
+#define CST_ATOMIC_CAS(P,E,D) \
+    __atomic_compare_exchange_n((P),(E),(D),0,__ATOMIC_RELAXED,__ATOMIC_RELAXED)
+#else
+/* The stats will only be approximate with threads */
+#define CST_ATOMIC_ADD(P,N) (*(P) += (N))
+#define CST_ATOMIC_LOAD(P) (*(P))
+#define CST_ATOMIC_CAS(P,E,D) ((*(P) = (D)), 1)
+#endif
+
+typedef struct cst_alloc_record_struct {
+    cst_alloc_counts c;
+    struct cst_alloc_record_struct *next;
+} cst_alloc_record;
+
+static int cst_alloc_stats_mode = -1;  /* not decided yet */
+static cst_thread_key *cst_alloc_key = NULL;
+/* One record per thread, kept after the thread finishes so the totals */
+/* stay right                                                          */
+static cst_alloc_record *cst_alloc_records = NULL;
+static long cst_alloc_in_use = 0;
+static long cst_alloc_high_water = 0;
+
+static void cst_alloc_stats_decide(int on)
+{
+#if defined(CST_DEBUG_MALLOC) || defined(CST_USER_MALLOC) || defined(UNDER_CE)
+    cst_alloc_stats_mode = FALSE;
+#else
+    cst_alloc_stats_mode = on || (getenv("CST_ALLOC_STATS") != NULL);
+    if (cst_alloc_stats_mode)
+        cst_alloc_key = new_thread_key();  /* (this is counted globally) */
+#endif
+}
+
+static cst_alloc_record *cst_alloc_thread_record(void)
+{
+    cst_alloc_record *r;
+
+    if (cst_alloc_key == NULL)
+        return NULL;
+    r = (cst_alloc_record *)cst_thread_key_get(cst_alloc_key);
+    if (r == NULL)
+    {   /* from the system, so it doesn't count itself */
+        r = (cst_alloc_record *)calloc(1,sizeof(cst_alloc_record));
+        if (r == NULL)
+            return NULL;
+        cst_thread_key_set(cst_alloc_key,r);
+        r->next = CST_ATOMIC_LOAD(&cst_alloc_records);
+        while (!CST_ATOMIC_CAS(&cst_alloc_records,&r->next,r))
+            ;
+    }
+    return r;
+}
+
+static int cst_alloc_size_class(int size)
+{
+    int c, s;
+
+    for (c=0, s=16; (c < CST_ALLOC_SIZE_CLASSES-1) && (size > s); c++)
+        s *= 2;
+    return c;
+}
+
+static void cst_alloc_count(int size, int old_size)
+{
+    /* size has been allocated, replacing old_size (for realloc) */
+    cst_alloc_record *r;
+    long in_use, hw;
+
+    in_use = CST_ATOMIC_ADD(&cst_alloc_in_use,(long)(size-old_size));
+    hw = CST_ATOMIC_LOAD(&cst_alloc_high_water);
+    while ((in_use > hw) &&
+           !CST_ATOMIC_CAS(&cst_alloc_high_water,&hw,in_use))
+        ;
+
+    if ((r = cst_alloc_thread_record()))
+    {
+        r->c.calls++;
+        r->c.bytes += size;
+        r->c.in_use += size - old_size;
+        if (r->c.in_use > r->c.high_water)
+            r->c.high_water = r->c.in_use;
+        r->c.size_classes[cst_alloc_size_class(size)]++;
+    }
+}
+
+static void cst_alloc_count_free(int size)
+{
+    cst_alloc_record *r;
+
+    CST_ATOMIC_ADD(&cst_alloc_in_use,-(long)size);
+    if ((r = cst_alloc_thread_record()))
+    {
+        r->c.frees++;
+        r->c.in_use -= size;
+    }
+}
+
+int cst_alloc_stats_enable(void)
+{
+    if (cst_alloc_stats_mode < 0)
+        cst_alloc_stats_decide(TRUE);
+    return cst_alloc_stats_mode;
+}
+
+void cst_alloc_thread_stats(cst_alloc_counts *c)
+{
+    cst_alloc_record *r;
+
+    if ((cst_alloc_stats_mode > 0) && (r = cst_alloc_thread_record()))
+        memmove(c,&r->c,sizeof(*c));
+    else
+        memset(c,0,sizeof(*c));
+}
+
+void cst_alloc_stats(cst_alloc_counts *c)
+{
+    cst_alloc_record *r;
+    int i;
+
+    memset(c,0,sizeof(*c));
+    for (r=CST_ATOMIC_LOAD(&cst_alloc_records); r; r=r->next)
+    {
+        c->calls += r->c.calls;
+        c->frees += r->c.frees;
+        c->bytes += r->c.bytes;
+        for (i=0; i<CST_ALLOC_SIZE_CLASSES; i++)
+            c->size_classes[i] += r->c.size_classes[i];
+    }
+    c->in_use = CST_ATOMIC_LOAD(&cst_alloc_in_use);
+    c->high_water = CST_ATOMIC_LOAD(&cst_alloc_high_water);
+}
+
 #ifndef CST_USER_MALLOC	/* Define to override cst_safe_alloc, cst_safe_calloc, cst_safe_realloc, cst_free */
 
+static void *cst_stats_alloc(int size)
+{
+    /* cst_safe_alloc, when keeping stats */
+    char *p;
+
+    p = (char *)calloc(size+CST_ALLOC_HEADER,1);
+    if (p == NULL)
+    {
+	cst_errmsg("alloc: can't alloc %d bytes\n", size);
+	cst_error();
+    }
+    *(int *)p = size;
+    cst_alloc_count(size,0);
+
+    return p + CST_ALLOC_HEADER;
+}
+
 void *cst_safe_alloc(int size)
 {
     /* returns pointer to memory all set 0 */
@@ -78,6 +238,11 @@ void *cst_safe_alloc(int size)
     else if (size == 0)  /* some mallocs return NULL for this */
 	size++;
 
+    if (cst_alloc_stats_mode < 0)
+        cst_alloc_stats_decide(FALSE);
+    if (cst_alloc_stats_mode)
+        return cst_stats_alloc(size);
+
 #ifdef CST_DEBUG_MALLOC
     if (size > cst_alloc_imax)
     {
@@ -137,6 +302,16 @@ void *cst_safe_realloc(void *p,int size)
 
     if (p == NULL)
 	np = cst_safe_alloc(size);
+    else if (cst_alloc_stats_mode > 0)
+    {
+        np = realloc((char *)p-CST_ALLOC_HEADER,size+CST_ALLOC_HEADER);
+        if (np != NULL)
+        {
+            cst_alloc_count(size,*(int *)np);
+            *(int *)np = size;
+            np = (char *)np + CST_ALLOC_HEADER;
+        }
+    }
     else
 #ifdef UNDER_CE
 	np = LocalReAlloc((HLOCAL)p, size, LMEM_MOVEABLE|LMEM_ZEROINIT);
@@ -173,6 +348,11 @@ void cst_free(void *p)
 	*((int *)p - 1) = 0; /* mark it as freed */
 	p = (int *)p - 2;
 #endif
+        if (cst_alloc_stats_mode > 0)
+        {
+            p = (char *)p - CST_ALLOC_HEADER;
+            cst_alloc_count_free(*(int *)p);
+        }
 #ifndef CST_DEBUG_MALLOC_TRACE
 #ifdef UNDER_CE
 	if (LocalFree(p) != NULL)
@@ -190,6 +370,93 @@ void cst_free(void *p)
 
 #endif
 
+/* Pool blocks are aligned for the largest basic type */
+#define CST_POOL_ALIGN 16
+
+typedef struct cst_pool_block_struct {
+    int size;
+    int used;
+    struct cst_pool_block_struct *next;
+} cst_pool_block;
+
+struct cst_pool_struct {
+    int block_size;
+    cst_pool_block *blocks;
+    cst_pool_block *current;
+};
+
+#define CST_POOL_HEADER \
+    ((sizeof(cst_pool_block)+CST_POOL_ALIGN-1)/CST_POOL_ALIGN*CST_POOL_ALIGN)
+
+static cst_pool_block *new_pool_block(int size)
+{
+    cst_pool_block *b;
+
+    b = (cst_pool_block *)cst_safe_alloc(CST_POOL_HEADER+size);
+    b->size = size;
+    return b;
+}
+
+cst_pool *new_pool(int block_size)
+{
+    cst_pool *p = cst_alloc(cst_pool,1);
+
+    p->block_size = (block_size < 1024) ? 1024 : block_size;
+    p->blocks = p->current = new_pool_block(p->block_size);
+    return p;
+}
+
+void delete_pool(cst_pool *p)
+{
+    cst_pool_block *b, *nb;
+
+    if (p)
+    {
+        for (b=p->blocks; b; b=nb)
+        {
+            nb = b->next;
+            cst_free(b);
+        }
+        cst_free(p);
+    }
+}
+
+void *cst_pool_alloc(cst_pool *p, int size)
+{
+    cst_pool_block *b;
+    char *m;
+
+    size = (size+CST_POOL_ALIGN-1)/CST_POOL_ALIGN*CST_POOL_ALIGN;
+    if (size == 0)
+        size = CST_POOL_ALIGN;
+
+    /* Find a block with room, reusing ones from before a reset */
+    for (b=p->current; b && (b->used + size > b->size); b=b->next)
+        b->used = b->size;  /* don't look at it again */
+    if (b == NULL)
+    {
+        b = new_pool_block((size > p->block_size) ? size : p->block_size);
+        b->next = p->current->next;
+        p->current->next = b;
+    }
+    p->current = b;
+
+    /* Like cst_alloc, memory comes back zeroed, blocks may be reused */
+    m = (char *)b + CST_POOL_HEADER + b->used;
+    memset(m,0,size);
+    b->used += size;
+    return m;
+}
+
+void cst_pool_reset(cst_pool *p)
+{
+    cst_pool_block *b;
+
+    for (b=p->blocks; b; b=b->next)
+        b->used = 0;
+    p->current = p->blocks;
+}
+
 #ifdef CST_DEBUG_MALLOC_TRACE
 
 void cst_find_unfreed()
@@ -221,7 +488,92 @@ void cst_alloc_debug_summary()
 }
 #endif
 
-#ifdef UNDER_CE
+#ifndef UNDER_CE
+/* Blocks from a context have a header with their size class, small */
+/* ones come from the pool and go back on a free list for the class */
+#define CST_LOCAL_CLASSES 16
+#define CST_LOCAL_BIG CST_LOCAL_CLASSES
+#define CST_LOCAL_HEADER CST_POOL_ALIGN
+#define CST_LOCAL_MAX_BLOCK (16*1024)
+
+struct cst_alloc_context_struct {
+    cst_pool *pool;
+    void *free_list[CST_LOCAL_CLASSES];
+};
+
+cst_alloc_context new_alloc_context(int size)
+{
+    cst_alloc_context ctx;
+
+    ctx = cst_alloc(struct cst_alloc_context_struct,1);
+    ctx->pool = new_pool((size > CST_LOCAL_MAX_BLOCK) ?
+                         CST_LOCAL_MAX_BLOCK : size);
+    return ctx;
+}
+
+void delete_alloc_context(cst_alloc_context ctx)
+{
+    if (ctx)
+    {
+        delete_pool(ctx->pool);
+        cst_free(ctx);
+    }
+}
+
+void *cst_local_alloc(cst_alloc_context ctx, int size)
+{
+    char *m;
+    int c;
+
+    if (ctx == NULL)
+        return cst_safe_alloc(size);
+
+    c = (size+CST_POOL_ALIGN-1)/CST_POOL_ALIGN;
+    if (c >= CST_LOCAL_CLASSES)
+    {
+        m = (char *)cst_safe_alloc(CST_LOCAL_HEADER+size);
+        *(int *)m = CST_LOCAL_BIG;
+    }
+    else if (ctx->free_list[c])
+    {
+        m = (char *)ctx->free_list[c] - CST_LOCAL_HEADER;
+        ctx->free_list[c] = *(void **)ctx->free_list[c];
+        memset(m+CST_LOCAL_HEADER,0,c*CST_POOL_ALIGN);
+    }
+    else
+    {
+        /* class 0 (a zero size) still needs room for the free list link */
+        m = (char *)cst_pool_alloc(ctx->pool,
+                                   CST_LOCAL_HEADER+
+                                   ((c == 0) ? 1 : c)*CST_POOL_ALIGN);
+        *(int *)m = c;
+    }
+
+    return m+CST_LOCAL_HEADER;
+}
+
+void cst_local_free(cst_alloc_context ctx, void *p)
+{
+    char *m;
+    int c;
+
+    if (ctx == NULL)
+        cst_free(p);
+    else if (p)
+    {
+        m = (char *)p - CST_LOCAL_HEADER;
+        c = *(int *)m;
+        if (c == CST_LOCAL_BIG)
+            cst_free(m);
+        else
+        {
+            *(void **)p = ctx->free_list[c];
+            ctx->free_list[c] = p;
+        }
+    }
+}
+
+#else
 cst_alloc_context new_alloc_context(int size)
 {
     HANDLE h;
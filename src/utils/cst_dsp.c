@@ -0,0 +1,733 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Signal processing kernels: a C reference for each, versions for      */
+/*  SSE2, AVX2, AVX-512 and NEON, and the choice of which to use         */
+/*                                                                       */
+/*************************************************************************/
+#include <stdlib.h>
+#include "cst_alloc.h"
+#include "cst_error.h"
+#include "cst_string.h"
+#include "cst_dsp.h"
+
+#if defined(__SSE2__) && !defined(UNDER_CE)
+#define CST_DSP_SSE2
+#include <emmintrin.h>
+#endif
+
+/* AVX2 and AVX-512 are built with target attributes, and only used */
+/* when cpuid says they are there                                  */
+#if (defined(__x86_64__) || defined(__i386__)) && defined(CST_DSP_SSE2) && \
+    (defined(__clang__) || (defined(__GNUC__) && (__GNUC__ >= 7)))
+#define CST_DSP_X86
+#include <immintrin.h>
+#define DSP_AVX2 __attribute__((target("avx2")))
+#define DSP_AVX512 __attribute__((target("avx512f,avx512bw")))
+#endif
+
+/* NEON is always there on 64 bit ARM */
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define CST_DSP_NEON
+#include <arm_neon.h>
+#endif
+
+/* The C reference */
+
+static double dot_c(const double *a, const double *b, int n)
+{
+    double s = 0.0;
+    int i;
+
+    for (i=0; i<n; i++)
+        s += a[i] * b[i];
+
+    return s;
+}
+
+static float dot_float_c(const float *a, const float *b, int n)
+{
+    float s = 0.0;
+    int i;
+
+    for (i=0; i<n; i++)
+        s += a[i] * b[i];
+
+    return s;
+}
+
+static int dot_int_c(const int *a, const int *b, int n)
+{
+    unsigned int s = 0;   /* so overflow wraps */
+    int i;
+
+    for (i=0; i<n; i++)
+        s += (unsigned int)a[i] * (unsigned int)b[i];
+
+    return (int)s;
+}
+
+/* The tails of the vector versions are done with these too */
+static int wabsdiff16_from(const unsigned short *a, const unsigned short *b,
+                           const unsigned short *w, int i, int n,
+                           int r, int bestsofar)
+{
+    unsigned int diff;
+
+    for (; i < n; i++)
+    {
+        diff = (a[i] > b[i]) ? a[i]-b[i] : b[i]-a[i];
+        r += (diff * w[i]) >> 16;
+        if (r > bestsofar)
+            return r;
+    }
+
+    return r;
+}
+
+static int wabsdiff8_from(const unsigned char *a, const unsigned char *b,
+                          const unsigned short *w, int i, int n,
+                          int r, int bestsofar)
+{
+    unsigned int diff;
+
+    for (; i < n; i++)
+    {
+        diff = (a[i] > b[i]) ? a[i]-b[i] : b[i]-a[i];
+        r += ((diff << 8) * w[i]) >> 16;
+        if (r > bestsofar)
+            return r;
+    }
+
+    return r;
+}
+
+static int wabsdiff16_c(const unsigned short *a, const unsigned short *b,
+                        const unsigned short *w, int n, int bestsofar)
+{
+    return wabsdiff16_from(a,b,w,0,n,0,bestsofar);
+}
+
+static int wabsdiff8_c(const unsigned char *a, const unsigned char *b,
+                       const unsigned short *w, int n, int bestsofar)
+{
+    return wabsdiff8_from(a,b,w,0,n,0,bestsofar);
+}
+
+static const cst_dsp_kernels dsp_c = {
+    "c",
+    dot_c, dot_float_c, dot_int_c,
+    wabsdiff16_c, wabsdiff8_c
+};
+
+/* For the weighted differences |a-b|*w/65536 is exactly the high half */
+/* of a 16x16 multiply, so they are done 8 (or 16) at a time.  The     */
+/* bestsofar cut off is only checked after each block which may give a */
+/* bigger (but still losing) distance than the reference              */
+
+#ifdef CST_DSP_SSE2
+static double dot_sse2(const double *a, const double *b, int n)
+{
+    __m128d s0 = _mm_setzero_pd(), s1 = _mm_setzero_pd();
+    double t[2], s;
+    int i;
+
+    for (i=0; i+4 <= n; i+=4)
+    {
+        s0 = _mm_add_pd(s0,_mm_mul_pd(_mm_loadu_pd(&a[i]),
+                                      _mm_loadu_pd(&b[i])));
+        s1 = _mm_add_pd(s1,_mm_mul_pd(_mm_loadu_pd(&a[i+2]),
+                                      _mm_loadu_pd(&b[i+2])));
+    }
+    _mm_storeu_pd(t,_mm_add_pd(s0,s1));
+    s = t[0] + t[1];
+    for (; i<n; i++)
+        s += a[i] * b[i];
+
+    return s;
+}
+
+static float dot_float_sse2(const float *a, const float *b, int n)
+{
+    __m128 s0 = _mm_setzero_ps(), s1 = _mm_setzero_ps();
+    float t[4], s;
+    int i;
+
+    for (i=0; i+8 <= n; i+=8)
+    {
+        s0 = _mm_add_ps(s0,_mm_mul_ps(_mm_loadu_ps(&a[i]),
+                                      _mm_loadu_ps(&b[i])));
+        s1 = _mm_add_ps(s1,_mm_mul_ps(_mm_loadu_ps(&a[i+4]),
+                                      _mm_loadu_ps(&b[i+4])));
+    }
+    _mm_storeu_ps(t,_mm_add_ps(s0,s1));
+    s = (t[0] + t[1]) + (t[2] + t[3]);
+    for (; i<n; i++)
+        s += a[i] * b[i];
+
+    return s;
+}
+
+static int sse2_sum_epi32(__m128i acc)
+{
+    acc = _mm_add_epi32(acc,_mm_shuffle_epi32(acc,_MM_SHUFFLE(1,0,3,2)));
+    acc = _mm_add_epi32(acc,_mm_shuffle_epi32(acc,_MM_SHUFFLE(2,3,0,1)));
+    return _mm_cvtsi128_si32(acc);
+}
+
+static __m128i sse2_mullo_epi32(__m128i a, __m128i b)
+{
+    /* SSE2 only has 32x32->64 bit multiplies, of the even elements */
+    __m128i even = _mm_mul_epu32(a,b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a,32),_mm_srli_epi64(b,32));
+
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even,_MM_SHUFFLE(0,0,2,0)),
+                              _mm_shuffle_epi32(odd,_MM_SHUFFLE(0,0,2,0)));
+}
+
+static int dot_int_sse2(const int *a, const int *b, int n)
+{
+    __m128i acc = _mm_setzero_si128();
+    unsigned int s;
+    int i;
+
+    for (i=0; i+4 <= n; i+=4)
+        acc = _mm_add_epi32(acc,
+                  sse2_mullo_epi32(_mm_loadu_si128((const __m128i *)&a[i]),
+                                   _mm_loadu_si128((const __m128i *)&b[i])));
+    s = (unsigned int)sse2_sum_epi32(acc);
+    for (; i<n; i++)
+        s += (unsigned int)a[i] * (unsigned int)b[i];
+
+    return (int)s;
+}
+
+static __m128i sse2_weighted_absdiff(__m128i acc, __m128i a, __m128i b,
+                                     const unsigned short *w)
+{
+    __m128i d, t;
+
+    d = _mm_or_si128(_mm_subs_epu16(a,b),_mm_subs_epu16(b,a));
+    t = _mm_mulhi_epu16(d,_mm_loadu_si128((const __m128i *)w));
+    acc = _mm_add_epi32(acc,_mm_unpacklo_epi16(t,_mm_setzero_si128()));
+    return _mm_add_epi32(acc,_mm_unpackhi_epi16(t,_mm_setzero_si128()));
+}
+
+static int wabsdiff16_sse2(const unsigned short *a, const unsigned short *b,
+                           const unsigned short *w, int n, int bestsofar)
+{
+    __m128i acc = _mm_setzero_si128();
+    int i, r = 0;
+
+    for (i=0; i+8 <= n; i+=8)
+    {
+        acc = sse2_weighted_absdiff(acc,
+                                    _mm_loadu_si128((const __m128i *)&a[i]),
+                                    _mm_loadu_si128((const __m128i *)&b[i]),
+                                    &w[i]);
+        r = sse2_sum_epi32(acc);
+        if (r > bestsofar)
+            return r;
+    }
+
+    return wabsdiff16_from(a,b,w,i,n,r,bestsofar);
+}
+
+static int wabsdiff8_sse2(const unsigned char *a, const unsigned char *b,
+                          const unsigned short *w, int n, int bestsofar)
+{
+    __m128i acc = _mm_setzero_si128();
+    int i, r = 0;
+
+    for (i=0; i+8 <= n; i+=8)
+    {
+        acc = sse2_weighted_absdiff(acc,
+                    _mm_unpacklo_epi8(_mm_setzero_si128(),
+                              _mm_loadl_epi64((const __m128i *)&a[i])),
+                    _mm_unpacklo_epi8(_mm_setzero_si128(),
+                              _mm_loadl_epi64((const __m128i *)&b[i])),
+                    &w[i]);
+        r = sse2_sum_epi32(acc);
+        if (r > bestsofar)
+            return r;
+    }
+
+    return wabsdiff8_from(a,b,w,i,n,r,bestsofar);
+}
+
+static const cst_dsp_kernels dsp_sse2 = {
+    "sse2",
+    dot_sse2, dot_float_sse2, dot_int_sse2,
+    wabsdiff16_sse2, wabsdiff8_sse2
+};
+#endif /* CST_DSP_SSE2 */
+
+#ifdef CST_DSP_X86
+DSP_AVX2 static double avx2_sum_pd(__m256d s)
+{
+    __m128d t = _mm_add_pd(_mm256_castpd256_pd128(s),
+                           _mm256_extractf128_pd(s,1));
+    return _mm_cvtsd_f64(_mm_add_sd(t,_mm_unpackhi_pd(t,t)));
+}
+
+DSP_AVX2 static double dot_avx2(const double *a, const double *b, int n)
+{
+    __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+    double s;
+    int i;
+
+    for (i=0; i+8 <= n; i+=8)
+    {
+        s0 = _mm256_add_pd(s0,_mm256_mul_pd(_mm256_loadu_pd(&a[i]),
+                                            _mm256_loadu_pd(&b[i])));
+        s1 = _mm256_add_pd(s1,_mm256_mul_pd(_mm256_loadu_pd(&a[i+4]),
+                                            _mm256_loadu_pd(&b[i+4])));
+    }
+    if (i+4 <= n)
+    {
+        s0 = _mm256_add_pd(s0,_mm256_mul_pd(_mm256_loadu_pd(&a[i]),
+                                            _mm256_loadu_pd(&b[i])));
+        i += 4;
+    }
+    s = avx2_sum_pd(_mm256_add_pd(s0,s1));
+    for (; i<n; i++)
+        s += a[i] * b[i];
+
+    return s;
+}
+
+DSP_AVX2 static float avx2_sum_ps(__m256 s)
+{
+    __m128 t = _mm_add_ps(_mm256_castps256_ps128(s),
+                          _mm256_extractf128_ps(s,1));
+    t = _mm_add_ps(t,_mm_movehl_ps(t,t));
+    return _mm_cvtss_f32(_mm_add_ss(t,_mm_shuffle_ps(t,t,1)));
+}
+
+DSP_AVX2 static float dot_float_avx2(const float *a, const float *b, int n)
+{
+    __m256 s0 = _mm256_setzero_ps(), s1 = _mm256_setzero_ps();
+    float s;
+    int i;
+
+    for (i=0; i+16 <= n; i+=16)
+    {
+        s0 = _mm256_add_ps(s0,_mm256_mul_ps(_mm256_loadu_ps(&a[i]),
+                                            _mm256_loadu_ps(&b[i])));
+        s1 = _mm256_add_ps(s1,_mm256_mul_ps(_mm256_loadu_ps(&a[i+8]),
+                                            _mm256_loadu_ps(&b[i+8])));
+    }
+    if (i+8 <= n)
+    {
+        s0 = _mm256_add_ps(s0,_mm256_mul_ps(_mm256_loadu_ps(&a[i]),
+                                            _mm256_loadu_ps(&b[i])));
+        i += 8;
+    }
+    s = avx2_sum_ps(_mm256_add_ps(s0,s1));
+    for (; i<n; i++)
+        s += a[i] * b[i];
+
+    return s;
+}
+
+DSP_AVX2 static int avx2_sum_epi32(__m256i acc)
+{
+    __m128i t = _mm_add_epi32(_mm256_castsi256_si128(acc),
+                              _mm256_extracti128_si256(acc,1));
+    t = _mm_add_epi32(t,_mm_shuffle_epi32(t,_MM_SHUFFLE(1,0,3,2)));
+    t = _mm_add_epi32(t,_mm_shuffle_epi32(t,_MM_SHUFFLE(2,3,0,1)));
+    return _mm_cvtsi128_si32(t);
+}
+
+DSP_AVX2 static int dot_int_avx2(const int *a, const int *b, int n)
+{
+    __m256i acc = _mm256_setzero_si256();
+    unsigned int s;
+    int i;
+
+    for (i=0; i+8 <= n; i+=8)
+        acc = _mm256_add_epi32(acc,
+                _mm256_mullo_epi32(_mm256_loadu_si256((const __m256i *)&a[i]),
+                                   _mm256_loadu_si256((const __m256i *)&b[i])));
+    s = (unsigned int)avx2_sum_epi32(acc);
+    for (; i<n; i++)
+        s += (unsigned int)a[i] * (unsigned int)b[i];
+
+    return (int)s;
+}
+
+DSP_AVX2 static __m256i avx2_weighted_absdiff(__m256i acc, __m256i a,
+                                              __m256i b,
+                                              const unsigned short *w)
+{
+    __m256i d, t;
+
+    d = _mm256_or_si256(_mm256_subs_epu16(a,b),_mm256_subs_epu16(b,a));
+    t = _mm256_mulhi_epu16(d,_mm256_loadu_si256((const __m256i *)w));
+    acc = _mm256_add_epi32(acc,
+                           _mm256_unpacklo_epi16(t,_mm256_setzero_si256()));
+    return _mm256_add_epi32(acc,
+                            _mm256_unpackhi_epi16(t,_mm256_setzero_si256()));
+}
+
+DSP_AVX2 static int wabsdiff16_avx2(const unsigned short *a,
+                                    const unsigned short *b,
+                                    const unsigned short *w,
+                                    int n, int bestsofar)
+{
+    __m256i acc = _mm256_setzero_si256();
+    int i, r = 0;
+
+    for (i=0; i+16 <= n; i+=16)
+    {
+        acc = avx2_weighted_absdiff(acc,
+                            _mm256_loadu_si256((const __m256i *)&a[i]),
+                            _mm256_loadu_si256((const __m256i *)&b[i]),
+                            &w[i]);
+        r = avx2_sum_epi32(acc);
+        if (r > bestsofar)
+            return r;
+    }
+    if (i+8 <= n)
+    {   /* frames are short, so it is worth doing a last 8 */
+        r += sse2_sum_epi32(sse2_weighted_absdiff(_mm_setzero_si128(),
+                                   _mm_loadu_si128((const __m128i *)&a[i]),
+                                   _mm_loadu_si128((const __m128i *)&b[i]),
+                                   &w[i]));
+        if (r > bestsofar)
+            return r;
+        i += 8;
+    }
+
+    return wabsdiff16_from(a,b,w,i,n,r,bestsofar);
+}
+
+DSP_AVX2 static int wabsdiff8_avx2(const unsigned char *a,
+                                   const unsigned char *b,
+                                   const unsigned short *w,
+                                   int n, int bestsofar)
+{
+    __m256i acc = _mm256_setzero_si256();
+    int i, r = 0;
+
+    for (i=0; i+16 <= n; i+=16)
+    {
+        acc = avx2_weighted_absdiff(acc,
+                _mm256_slli_epi16(_mm256_cvtepu8_epi16(
+                    _mm_loadu_si128((const __m128i *)&a[i])),8),
+                _mm256_slli_epi16(_mm256_cvtepu8_epi16(
+                    _mm_loadu_si128((const __m128i *)&b[i])),8),
+                &w[i]);
+        r = avx2_sum_epi32(acc);
+        if (r > bestsofar)
+            return r;
+    }
+    if (i+8 <= n)
+    {
+        r += sse2_sum_epi32(sse2_weighted_absdiff(_mm_setzero_si128(),
+                    _mm_unpacklo_epi8(_mm_setzero_si128(),
+                              _mm_loadl_epi64((const __m128i *)&a[i])),
+                    _mm_unpacklo_epi8(_mm_setzero_si128(),
+                              _mm_loadl_epi64((const __m128i *)&b[i])),
+                    &w[i]));
+        if (r > bestsofar)
+            return r;
+        i += 8;
+    }
+
+    return wabsdiff8_from(a,b,w,i,n,r,bestsofar);
+}
+
+static const cst_dsp_kernels dsp_avx2 = {
+    "avx2",
+    dot_avx2, dot_float_avx2, dot_int_avx2,
+    wabsdiff16_avx2, wabsdiff8_avx2
+};
+
+DSP_AVX512 static double dot_avx512(const double *a, const double *b, int n)
+{
+    __m512d s0 = _mm512_setzero_pd();
+    double s;
+    int i;
+
+    for (i=0; i+8 <= n; i+=8)
+        s0 = _mm512_add_pd(s0,_mm512_mul_pd(_mm512_loadu_pd(&a[i]),
+                                            _mm512_loadu_pd(&b[i])));
+    if (i < n)
+    {   /* the rest with a mask */
+        __mmask8 k = (__mmask8)((1u << (n-i)) - 1);
+        s0 = _mm512_add_pd(s0,_mm512_mul_pd(_mm512_maskz_loadu_pd(k,&a[i]),
+                                            _mm512_maskz_loadu_pd(k,&b[i])));
+    }
+    s = _mm512_reduce_add_pd(s0);
+
+    return s;
+}
+
+DSP_AVX512 static float dot_float_avx512(const float *a, const float *b,
+                                         int n)
+{
+    __m512 s0 = _mm512_setzero_ps();
+    int i;
+
+    for (i=0; i+16 <= n; i+=16)
+        s0 = _mm512_add_ps(s0,_mm512_mul_ps(_mm512_loadu_ps(&a[i]),
+                                            _mm512_loadu_ps(&b[i])));
+    if (i < n)
+    {
+        __mmask16 k = (__mmask16)((1u << (n-i)) - 1);
+        s0 = _mm512_add_ps(s0,_mm512_mul_ps(_mm512_maskz_loadu_ps(k,&a[i]),
+                                            _mm512_maskz_loadu_ps(k,&b[i])));
+    }
+
+    return _mm512_reduce_add_ps(s0);
+}
+
+DSP_AVX512 static int dot_int_avx512(const int *a, const int *b, int n)
+{
+    __m512i acc = _mm512_setzero_si512();
+    int i;
+
+    for (i=0; i+16 <= n; i+=16)
+        acc = _mm512_add_epi32(acc,
+                _mm512_mullo_epi32(_mm512_loadu_si512((const void *)&a[i]),
+                                   _mm512_loadu_si512((const void *)&b[i])));
+    if (i < n)
+    {
+        __mmask16 k = (__mmask16)((1u << (n-i)) - 1);
+        acc = _mm512_add_epi32(acc,
+                _mm512_mullo_epi32(_mm512_maskz_loadu_epi32(k,&a[i]),
+                                   _mm512_maskz_loadu_epi32(k,&b[i])));
+    }
+
+    return _mm512_reduce_add_epi32(acc);
+}
+
+/* Join cost frames are rarely long enough for 32 coefficients at a */
+/* time, so these keep the AVX2 weighted differences                */
+static const cst_dsp_kernels dsp_avx512 = {
+    "avx512",
+    dot_avx512, dot_float_avx512, dot_int_avx512,
+    wabsdiff16_avx2, wabsdiff8_avx2
+};
+#endif /* CST_DSP_X86 */
+
+#ifdef CST_DSP_NEON
+static double dot_neon(const double *a, const double *b, int n)
+{
+    float64x2_t s0 = vdupq_n_f64(0.0), s1 = vdupq_n_f64(0.0);
+    double s;
+    int i;
+
+    for (i=0; i+4 <= n; i+=4)
+    {
+        s0 = vaddq_f64(s0,vmulq_f64(vld1q_f64(&a[i]),vld1q_f64(&b[i])));
+        s1 = vaddq_f64(s1,vmulq_f64(vld1q_f64(&a[i+2]),vld1q_f64(&b[i+2])));
+    }
+    s = vaddvq_f64(vaddq_f64(s0,s1));
+    for (; i<n; i++)
+        s += a[i] * b[i];
+
+    return s;
+}
+
+static float dot_float_neon(const float *a, const float *b, int n)
+{
+    float32x4_t s0 = vdupq_n_f32(0.0), s1 = vdupq_n_f32(0.0);
+    float s;
+    int i;
+
+    for (i=0; i+8 <= n; i+=8)
+    {
+        s0 = vaddq_f32(s0,vmulq_f32(vld1q_f32(&a[i]),vld1q_f32(&b[i])));
+        s1 = vaddq_f32(s1,vmulq_f32(vld1q_f32(&a[i+4]),vld1q_f32(&b[i+4])));
+    }
+    s = vaddvq_f32(vaddq_f32(s0,s1));
+    for (; i<n; i++)
+        s += a[i] * b[i];
+
+    return s;
+}
+
+static int dot_int_neon(const int *a, const int *b, int n)
+{
+    uint32x4_t acc = vdupq_n_u32(0);
+    unsigned int s;
+    int i;
+
+    for (i=0; i+4 <= n; i+=4)
+        acc = vmlaq_u32(acc,vld1q_u32((const uint32_t *)&a[i]),
+                        vld1q_u32((const uint32_t *)&b[i]));
+    s = vaddvq_u32(acc);
+    for (; i<n; i++)
+        s += (unsigned int)a[i] * (unsigned int)b[i];
+
+    return (int)s;
+}
+
+static uint32x4_t neon_weighted_absdiff(uint32x4_t acc, uint16x8_t a,
+                                        uint16x8_t b,
+                                        const unsigned short *w)
+{
+    uint16x8_t d = vabdq_u16(a,b);
+    uint16x8_t wv = vld1q_u16(w);
+
+    acc = vaddq_u32(acc,vshrq_n_u32(vmull_u16(vget_low_u16(d),
+                                              vget_low_u16(wv)),16));
+    return vaddq_u32(acc,vshrq_n_u32(vmull_high_u16(d,wv),16));
+}
+
+static int wabsdiff16_neon(const unsigned short *a, const unsigned short *b,
+                           const unsigned short *w, int n, int bestsofar)
+{
+    uint32x4_t acc = vdupq_n_u32(0);
+    int i, r = 0;
+
+    for (i=0; i+8 <= n; i+=8)
+    {
+        acc = neon_weighted_absdiff(acc,vld1q_u16(&a[i]),vld1q_u16(&b[i]),
+                                    &w[i]);
+        r = (int)vaddvq_u32(acc);
+        if (r > bestsofar)
+            return r;
+    }
+
+    return wabsdiff16_from(a,b,w,i,n,r,bestsofar);
+}
+
+static int wabsdiff8_neon(const unsigned char *a, const unsigned char *b,
+                          const unsigned short *w, int n, int bestsofar)
+{
+    uint32x4_t acc = vdupq_n_u32(0);
+    int i, r = 0;
+
+    for (i=0; i+8 <= n; i+=8)
+    {
+        acc = neon_weighted_absdiff(acc,vshll_n_u8(vld1_u8(&a[i]),8),
+                                    vshll_n_u8(vld1_u8(&b[i]),8),&w[i]);
+        r = (int)vaddvq_u32(acc);
+        if (r > bestsofar)
+            return r;
+    }
+
+    return wabsdiff8_from(a,b,w,i,n,r,bestsofar);
+}
+
+static const cst_dsp_kernels dsp_neon = {
+    "neon",
+    dot_neon, dot_float_neon, dot_int_neon,
+    wabsdiff16_neon, wabsdiff8_neon
+};
+#endif /* CST_DSP_NEON */
+
+/* Worst to best */
+static const cst_dsp_kernels * const dsp_variants[] = {
+    &dsp_c,
+#ifdef CST_DSP_SSE2
+    &dsp_sse2,
+#endif
+#ifdef CST_DSP_X86
+    &dsp_avx2,
+    &dsp_avx512,
+#endif
+#ifdef CST_DSP_NEON
+    &dsp_neon,
+#endif
+    NULL };
+
+const cst_dsp_kernels *cst_dsp = &dsp_c;
+
+static int dsp_supported(const cst_dsp_kernels *k)
+{
+#ifdef CST_DSP_X86
+    __builtin_cpu_init();
+    if (k == &dsp_avx2)
+        return __builtin_cpu_supports("avx2");
+    if (k == &dsp_avx512)
+        return __builtin_cpu_supports("avx512f") &&
+            __builtin_cpu_supports("avx512bw");
+#endif
+    return TRUE;
+}
+
+const cst_dsp_kernels *cst_dsp_variant(int i)
+{
+    int j;
+
+    for (j=0; dsp_variants[j]; j++)
+        if (dsp_supported(dsp_variants[j]) && (i-- == 0))
+            return dsp_variants[j];
+
+    return NULL;
+}
+
+const cst_dsp_kernels *cst_dsp_find(const char *name)
+{
+    const cst_dsp_kernels *k;
+    int i;
+
+    for (i=0; (k = cst_dsp_variant(i)) != NULL; i++)
+        if (cst_streq(name,k->name))
+            return k;
+
+    return NULL;
+}
+
+void cst_dsp_init(void)
+{
+    const cst_dsp_kernels *k, *best = &dsp_c;
+    const char *forced;
+    int i;
+
+    for (i=0; (k = cst_dsp_variant(i)) != NULL; i++)
+        best = k;
+
+#ifndef UNDER_CE
+    forced = getenv("CST_DSP");
+#else
+    forced = NULL;
+#endif
+    if (forced && *forced)
+    {
+        if ((k = cst_dsp_find(forced)) != NULL)
+            best = k;
+        else
+            cst_errmsg("CST_DSP: %s isn't available here, using %s\n",
+                       forced,best->name);
+    }
+
+    cst_dsp = best;
+}
@@ -53,7 +53,7 @@ static cst_featvalpair *feat_find_featpair(const cst_features *f,
     else
     {
 	for (n=f->head; n; n=n->next)
-	    if (cst_streq(name,n->name))
+	    if ((name == n->name) || cst_streq(name,n->name))
 		return n;
 	return NULL;
     }
@@ -79,7 +79,7 @@ cst_features *new_features_local(cst_alloc_context ctx)
     return f;
 }
 
-void delete_features(cst_features *f)
+void feat_clear(cst_features *f)
 {
     cst_featvalpair *n, *np;
 
@@ -92,6 +92,17 @@ void delete_features(cst_features *f)
 	    cst_local_free(f->ctx,n);
 	}
         delete_val(f->owned_strings);
+        f->head = NULL;
+        f->owned_strings = NULL;
+        f->linked = NULL;
+    }
+}
+
+void delete_features(cst_features *f)
+{
+    if (f)
+    {
+        feat_clear(f);
 	cst_local_free(f->ctx,f);
     }
 }
@@ -42,18 +42,13 @@
 
 cst_filemap *cst_mmap_file(const char *path)
 {
-    cst_dbgmsg("cst_mmap_file: unsupported on this platform");
-    cst_error();
-
-    return NULL;
+    /* No mapping here, so read it all in instead */
+    return cst_read_whole_file(path);
 }
 
 int cst_munmap_file(cst_filemap *fmap)
 {
-    cst_dbgmsg("cst_munmap_file: unsupported on this platform");
-    cst_error();
-
-    return -1;
+    return cst_free_whole_file(fmap);
 }
 
 cst_filemap *cst_read_whole_file(const char *path)
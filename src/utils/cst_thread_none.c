@@ -0,0 +1,185 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  cst_thread_none.c: stubs for systems with no thread support          */
+/*                                                                       */
+/*************************************************************************/
+
+#include <time.h>
+
+#include "cst_alloc.h"
+#include "cst_thread.h"
+
+struct cst_mutex_struct {
+    int locked;
+};
+
+cst_mutex *new_mutex(void)
+{
+    return cst_alloc(cst_mutex,1);
+}
+
+void delete_mutex(cst_mutex *m)
+{
+    cst_free(m);
+}
+
+void cst_mutex_lock(cst_mutex *m)
+{
+    m->locked = TRUE;
+}
+
+void cst_mutex_unlock(cst_mutex *m)
+{
+    m->locked = FALSE;
+}
+
+struct cst_cond_struct {
+    int signalled;
+};
+
+cst_cond *new_cond(void)
+{
+    return cst_alloc(cst_cond,1);
+}
+
+void delete_cond(cst_cond *c)
+{
+    cst_free(c);
+}
+
+void cst_cond_wait(cst_cond *c, cst_mutex *m)
+{
+    /* Nobody else could change anything, so callers never get here */
+    return;
+}
+
+void cst_cond_signal(cst_cond *c)
+{
+    c->signalled = TRUE;
+}
+
+void cst_cond_broadcast(cst_cond *c)
+{
+    c->signalled = TRUE;
+}
+
+cst_thread *cst_thread_create(cst_thread_f *func, void *arg)
+{
+    return NULL;
+}
+
+void *cst_thread_join(cst_thread *t)
+{
+    return NULL;
+}
+
+struct cst_thread_key_struct {
+    void *v;
+};
+
+cst_thread_key *new_thread_key(void)
+{
+    return cst_alloc(cst_thread_key,1);
+}
+
+void delete_thread_key(cst_thread_key *k)
+{
+    cst_free(k);
+}
+
+void *cst_thread_key_get(cst_thread_key *k)
+{
+    return k->v;
+}
+
+void cst_thread_key_set(cst_thread_key *k, void *v)
+{
+    k->v = v;
+}
+
+double cst_clock_wall(void)
+{
+    /* only one thread, so its cpu time will have to do */
+    return (double)clock()/CLOCKS_PER_SEC;
+}
+
+double cst_clock_thread_cpu(void)
+{
+    return (double)clock()/CLOCKS_PER_SEC;
+}
+
+void cst_global_lock(void)
+{
+    return;
+}
+
+void cst_global_unlock(void)
+{
+    return;
+}
+
+struct cst_thread_pool_struct {
+    int num_threads;
+};
+
+cst_thread_pool *new_thread_pool(int num_threads)
+{
+    /* no threads, but keep the number so callers behave the same */
+    cst_thread_pool *p = cst_alloc(cst_thread_pool,1);
+
+    p->num_threads = num_threads;
+    return p;
+}
+
+void delete_thread_pool(cst_thread_pool *p)
+{
+    cst_free(p);
+}
+
+int thread_pool_size(const cst_thread_pool *p)
+{
+    return p->num_threads;
+}
+
+void thread_pool_run(cst_thread_pool *p, cst_thread_task_f *func,
+                     void *arg, int num_tasks)
+{
+    int i;
+
+    for (i=0; i < num_tasks; i++)
+        (*func)(arg,i);
+}
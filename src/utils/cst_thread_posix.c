@@ -0,0 +1,334 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  cst_thread_posix.c: thread support using pthreads                    */
+/*                                                                       */
+/*************************************************************************/
+
+#include <pthread.h>
+#include <time.h>
+
+#include "cst_alloc.h"
+#include "cst_error.h"
+#include "cst_thread.h"
+
+struct cst_mutex_struct {
+    pthread_mutex_t m;
+};
+
+static pthread_mutex_t cst_global_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+cst_mutex *new_mutex(void)
+{
+    cst_mutex *m = cst_alloc(cst_mutex,1);
+
+    if (pthread_mutex_init(&m->m,NULL) != 0)
+    {
+        cst_errmsg("new_mutex: pthread_mutex_init failed\n");
+        cst_error();
+    }
+    return m;
+}
+
+void delete_mutex(cst_mutex *m)
+{
+    if (m)
+    {
+        pthread_mutex_destroy(&m->m);
+        cst_free(m);
+    }
+}
+
+void cst_mutex_lock(cst_mutex *m)
+{
+    pthread_mutex_lock(&m->m);
+}
+
+void cst_mutex_unlock(cst_mutex *m)
+{
+    pthread_mutex_unlock(&m->m);
+}
+
+struct cst_cond_struct {
+    pthread_cond_t c;
+};
+
+cst_cond *new_cond(void)
+{
+    cst_cond *c = cst_alloc(cst_cond,1);
+
+    if (pthread_cond_init(&c->c,NULL) != 0)
+    {
+        cst_errmsg("new_cond: pthread_cond_init failed\n");
+        cst_error();
+    }
+    return c;
+}
+
+void delete_cond(cst_cond *c)
+{
+    if (c)
+    {
+        pthread_cond_destroy(&c->c);
+        cst_free(c);
+    }
+}
+
+void cst_cond_wait(cst_cond *c, cst_mutex *m)
+{
+    pthread_cond_wait(&c->c,&m->m);
+}
+
+void cst_cond_signal(cst_cond *c)
+{
+    pthread_cond_signal(&c->c);
+}
+
+void cst_cond_broadcast(cst_cond *c)
+{
+    pthread_cond_broadcast(&c->c);
+}
+
+struct cst_thread_struct {
+    pthread_t t;
+};
+
+cst_thread *cst_thread_create(cst_thread_f *func, void *arg)
+{
+    cst_thread *t = cst_alloc(cst_thread,1);
+
+    if (pthread_create(&t->t,NULL,func,arg) != 0)
+    {
+        cst_free(t);
+        return NULL;
+    }
+    return t;
+}
+
+void *cst_thread_join(cst_thread *t)
+{
+    void *r = NULL;
+
+    if (t)
+    {
+        pthread_join(t->t,&r);
+        cst_free(t);
+    }
+    return r;
+}
+
+struct cst_thread_key_struct {
+    pthread_key_t k;
+};
+
+cst_thread_key *new_thread_key(void)
+{
+    cst_thread_key *k = cst_alloc(cst_thread_key,1);
+
+    if (pthread_key_create(&k->k,NULL) != 0)
+    {
+        cst_errmsg("new_thread_key: pthread_key_create failed\n");
+        cst_error();
+    }
+    return k;
+}
+
+void delete_thread_key(cst_thread_key *k)
+{
+    pthread_key_delete(k->k);
+    cst_free(k);
+}
+
+void *cst_thread_key_get(cst_thread_key *k)
+{
+    return pthread_getspecific(k->k);
+}
+
+void cst_thread_key_set(cst_thread_key *k, void *v)
+{
+    pthread_setspecific(k->k,v);
+}
+
+double cst_clock_wall(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC,&ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec/1000000000.0;
+}
+
+double cst_clock_thread_cpu(void)
+{
+#ifdef CLOCK_THREAD_CPUTIME_ID
+    struct timespec ts;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID,&ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec/1000000000.0;
+#else
+    return (double)clock()/CLOCKS_PER_SEC;
+#endif
+}
+
+void cst_global_lock(void)
+{
+    pthread_mutex_lock(&cst_global_mutex);
+}
+
+void cst_global_unlock(void)
+{
+    pthread_mutex_unlock(&cst_global_mutex);
+}
+
+struct cst_thread_pool_struct {
+    int num_threads;
+    pthread_t *threads;
+    pthread_mutex_t run_lock;   /* one run at a time */
+    pthread_mutex_t lock;       /* protects everything below */
+    pthread_cond_t work;
+    pthread_cond_t done;
+    cst_thread_task_f *func;
+    void *arg;
+    int num_tasks;
+    int next_task;
+    int pending;
+    int quit;
+};
+
+static void *thread_pool_worker(void *v)
+{
+    cst_thread_pool *p = (cst_thread_pool *)v;
+    int i;
+
+    pthread_mutex_lock(&p->lock);
+    while (1)
+    {
+        while (!p->quit && (p->next_task >= p->num_tasks))
+            pthread_cond_wait(&p->work,&p->lock);
+        if (p->quit)
+            break;
+        i = p->next_task++;
+        pthread_mutex_unlock(&p->lock);
+        (*p->func)(p->arg,i);
+        pthread_mutex_lock(&p->lock);
+        if (--p->pending == 0)
+            pthread_cond_signal(&p->done);
+    }
+    pthread_mutex_unlock(&p->lock);
+
+    return NULL;
+}
+
+cst_thread_pool *new_thread_pool(int num_threads)
+{
+    cst_thread_pool *p = cst_alloc(cst_thread_pool,1);
+    int i;
+
+    pthread_mutex_init(&p->run_lock,NULL);
+    pthread_mutex_init(&p->lock,NULL);
+    pthread_cond_init(&p->work,NULL);
+    pthread_cond_init(&p->done,NULL);
+    /* The caller works too, so it needs one less thread */
+    p->threads = cst_alloc(pthread_t,num_threads);
+    for (i=1; i < num_threads; i++)
+    {
+        if (pthread_create(&p->threads[p->num_threads],NULL,
+                           thread_pool_worker,p) != 0)
+        {
+            cst_errmsg("new_thread_pool: can't create thread %d\n",i);
+            break;
+        }
+        p->num_threads++;
+    }
+    p->num_threads++;
+
+    return p;
+}
+
+void delete_thread_pool(cst_thread_pool *p)
+{
+    int i;
+
+    if (p == NULL)
+        return;
+    pthread_mutex_lock(&p->lock);
+    p->quit = TRUE;
+    pthread_cond_broadcast(&p->work);
+    pthread_mutex_unlock(&p->lock);
+    for (i=0; i < p->num_threads-1; i++)
+        pthread_join(p->threads[i],NULL);
+
+    pthread_cond_destroy(&p->done);
+    pthread_cond_destroy(&p->work);
+    pthread_mutex_destroy(&p->lock);
+    pthread_mutex_destroy(&p->run_lock);
+    cst_free(p->threads);
+    cst_free(p);
+}
+
+int thread_pool_size(const cst_thread_pool *p)
+{
+    return p->num_threads;
+}
+
+void thread_pool_run(cst_thread_pool *p, cst_thread_task_f *func,
+                     void *arg, int num_tasks)
+{
+    int i;
+
+    pthread_mutex_lock(&p->run_lock);
+    pthread_mutex_lock(&p->lock);
+    p->func = func;
+    p->arg = arg;
+    p->num_tasks = num_tasks;
+    p->next_task = 0;
+    p->pending = num_tasks;
+    pthread_cond_broadcast(&p->work);
+
+    while (p->next_task < p->num_tasks)
+    {
+        i = p->next_task++;
+        pthread_mutex_unlock(&p->lock);
+        (*func)(arg,i);
+        pthread_mutex_lock(&p->lock);
+        p->pending--;
+    }
+    while (p->pending > 0)
+        pthread_cond_wait(&p->done,&p->lock);
+    p->num_tasks = p->next_task = 0;
+
+    pthread_mutex_unlock(&p->lock);
+    pthread_mutex_unlock(&p->run_lock);
+}
@@ -45,6 +45,8 @@ const cst_string * const cst_ts_default_prepunctuationsymbols = "\"'`({[";
 const cst_string * const cst_ts_default_postpunctuationsymbols = "\"'`.,:;!?(){}[]";
 
 #define TS_BUFFER_SIZE 256
+/* Longest whitespace or punctuation that is kept as an atom */
+#define TS_PART_ATOM_MAX 3
 
 static cst_string ts_getc(cst_tokenstream *ts);
 static cst_string internal_ts_getc(cst_tokenstream *ts);
@@ -108,17 +110,19 @@ static cst_tokenstream *new_tokenstream(const cst_string *whitespace,
     ts->line_number = 0;
     ts->eof_flag = 0;
     ts->string_buffer = NULL;
+    ts->string_buffer_size = 0;
+    ts->string_buffer_map = NULL;
     ts->token_pos = 0;
     ts->whitespace = cst_alloc(cst_string,TS_BUFFER_SIZE);
     ts->ws_max = TS_BUFFER_SIZE;
-    if (prepunct && prepunct[0])
+    if ((prepunct == NULL) || prepunct[0])  /* NULL is the defaults */
     {
         ts->prepunctuation = cst_alloc(cst_string,TS_BUFFER_SIZE);
         ts->prep_max = TS_BUFFER_SIZE;
     }
     ts->token = cst_alloc(cst_string,TS_BUFFER_SIZE);
     ts->token_max = TS_BUFFER_SIZE;
-    if (postpunct && postpunct[0])
+    if ((postpunct == NULL) || postpunct[0])
     {
         ts->postpunctuation = cst_alloc(cst_string,TS_BUFFER_SIZE);
         ts->postp_max = TS_BUFFER_SIZE;
@@ -180,6 +184,41 @@ cst_tokenstream *ts_open_string(const cst_string *string,
 					  postpunct);
 
     ts->string_buffer = cst_strdup(string);
+    ts->string_buffer_size = cst_strlen(ts->string_buffer);
+    ts_getc(ts);
+
+    return ts;
+}
+
+cst_tokenstream *ts_open_mapped(const char *filename,
+                                const cst_string *whitespace,
+                                const cst_string *singlechars,
+                                const cst_string *prepunct,
+                                const cst_string *postpunct)
+{
+    cst_tokenstream *ts;
+    cst_file fd;
+    cst_filemap *fmap;
+    long size;
+
+#ifndef UNDER_CE
+    if (cst_streq("-",filename))
+        return ts_open(filename,whitespace,singlechars,prepunct,postpunct);
+#endif
+    /* Check it's there first, as cst_mmap_file complains if it isn't */
+    if ((fd = cst_fopen(filename,CST_OPEN_READ|CST_OPEN_BINARY)) == NULL)
+        return NULL;
+    size = cst_filesize(fd);
+    cst_fclose(fd);
+    /* Empty files can't be mapped, and positions are ints */
+    if ((size <= 0) || (size > 0x7fffffffL) ||
+        ((fmap = cst_mmap_file(filename)) == NULL))
+        return ts_open(filename,whitespace,singlechars,prepunct,postpunct);
+
+    ts = new_tokenstream(whitespace,singlechars,prepunct,postpunct);
+    ts->string_buffer = (cst_string *)fmap->mem;
+    ts->string_buffer_size = (int)size;
+    ts->string_buffer_map = fmap;
     ts_getc(ts);
 
     return ts;
@@ -237,11 +276,14 @@ void ts_close(cst_tokenstream *ts)
 	    cst_fclose(ts->fd);
 	ts->fd = NULL; /* just in case close gets called twice */
     }
-    if (ts->string_buffer != NULL)
+    if (ts->string_buffer_map != NULL)
     {
-        cst_free(ts->string_buffer);
-	ts->string_buffer = NULL;
+        cst_munmap_file(ts->string_buffer_map);
+        ts->string_buffer_map = NULL;
     }
+    else if (ts->string_buffer != NULL)
+        cst_free(ts->string_buffer);
+    ts->string_buffer = NULL;
     if (ts->open)
         (ts->close)(ts);
     delete_tokenstream(ts);
@@ -353,7 +395,7 @@ int ts_set_stream_pos(cst_tokenstream *ts, int pos)
     }
     else if (ts->string_buffer)
     {
-        l = cst_strlen(ts->string_buffer);
+        l = ts->string_buffer_size;
         if (pos > l)
             new_pos = l;
         else if (pos < 0)
@@ -394,7 +436,7 @@ int ts_get_stream_size(cst_tokenstream *ts)
         cst_fseek(ts->fd,(long)current_pos,CST_SEEK_ABSOLUTE);
         return end_pos;
     } else if (ts->string_buffer)
-        return cst_strlen(ts->string_buffer);
+        return ts->string_buffer_size;
     else if (ts->open)
         return (ts->size)(ts);
     else
@@ -425,7 +467,7 @@ static cst_string internal_ts_getc(cst_tokenstream *ts)
     }
     else if (ts->string_buffer)
     {
-	if (ts->string_buffer[ts->file_pos] == '\0')
+	if (ts->file_pos >= ts->string_buffer_size)
         {
 	    ts->eof_flag = TRUE;
 	    ts->current_char = '\0';
@@ -510,6 +552,94 @@ const cst_string *ts_get_quoted_token(cst_tokenstream *ts,
     return ts->token;
 }
 
+static void set_token_part(cst_tokenstream *ts,
+                           cst_string **buffer, int *buffer_max,
+                           int start, int length)
+{
+    if ((*buffer == NULL) && (length == 0))
+        return;  /* a part that this stream never has */
+    if (length+1 > *buffer_max)
+    {
+        cst_free(*buffer);
+        *buffer_max = length+1+(length+1)/5;
+        *buffer = cst_alloc(cst_string,*buffer_max);
+    }
+    memmove(*buffer,&ts->string_buffer[start],length);
+    (*buffer)[length] = '\0';
+}
+
+static const cst_string *ts_get_from_memory(cst_tokenstream *ts)
+{
+    /* ts_get() for memory streams, the same as the char by char version */
+    /* below but it scans the buffer directly and copies each part once  */
+    const unsigned char *s = (const unsigned char *)ts->string_buffer;
+    const cst_string *cc = ts->charclass;
+    int n = ts->string_buffer_size;
+    int i, start, t;
+    int lines;
+
+    i = ts->file_pos-1;  /* the current char, its newline is already counted */
+    lines = -(s[i] == '\n');
+
+    /* Skip whitespace */
+    for (start=i;
+         (i < n) && ((cc[s[i]] & (TS_CHARCLASS_WHITESPACE|
+                                  TS_CHARCLASS_SINGLECHAR)) ==
+                     TS_CHARCLASS_WHITESPACE);
+         i++)
+        lines += (s[i] == '\n');
+    set_token_part(ts,&ts->whitespace,&ts->ws_max,start,i-start);
+    ts->token_pos = ((i < n) ? i+1 : n) - 1;
+
+    /* Get prepunctuation */
+    start = i;
+    if ((i < n) && (cc[s[i]] & TS_CHARCLASS_PREPUNCT))
+        for ( ; (i < n) && ((cc[s[i]] & (TS_CHARCLASS_PREPUNCT|
+                                         TS_CHARCLASS_SINGLECHAR)) ==
+                            TS_CHARCLASS_PREPUNCT);
+              i++)
+            lines += (s[i] == '\n');
+    set_token_part(ts,&ts->prepunctuation,&ts->prep_max,start,i-start);
+
+    /* Get the symbol itself, plus any post punctuation */
+    start = i;
+    if ((i < n) && (cc[s[i]] & TS_CHARCLASS_SINGLECHAR))
+    {
+        lines += (s[i] == '\n');
+        i++;
+    }
+    else
+        for ( ; (i < n) && !(cc[s[i]] & (TS_CHARCLASS_WHITESPACE|
+                                         TS_CHARCLASS_SINGLECHAR));
+              i++)
+            lines += (s[i] == '\n');
+
+    /* Get postpunctuation, the first char is always the token's */
+    t = i;
+    if (ts->p_postpunctuationsymbols[0])
+        for ( ; (t > start+1) && (cc[s[t-1]] & TS_CHARCLASS_POSTPUNCT); t--);
+    set_token_part(ts,&ts->token,&ts->token_max,start,t-start);
+    set_token_part(ts,&ts->postpunctuation,&ts->postp_max,t,i-t);
+
+    /* Leave things as ts_getc() would have, it counted newlines as */
+    /* they became the current char                                  */
+    ts->line_number += lines;
+    if (i < n)
+    {
+        ts->line_number += (s[i] == '\n');
+        ts->current_char = (cst_string)s[i];
+        ts->file_pos = i+1;
+    }
+    else
+    {
+        ts->current_char = '\0';
+        ts->file_pos = n;
+        ts->eof_flag = TRUE;
+    }
+
+    return ts->token;
+}
+
 const cst_string *ts_get(cst_tokenstream *ts)
 {
     /* Get next token */
@@ -520,6 +650,13 @@ const cst_string *ts_get(cst_tokenstream *ts)
         ts->tags = NULL;
     }
 
+    /* Memory streams can be read directly, unless we are just after a */
+    /* ts_set_stream_pos() where the current char isn't in the buffer  */
+    if (ts->string_buffer && !ts->open && !ts->utf8_explode_mode &&
+        !ts_eof(ts) && (ts->file_pos > 0) &&
+        (ts->string_buffer[ts->file_pos-1] == (cst_string)ts->current_char))
+        return ts_get_from_memory(ts);
+
     /* Skip whitespace */
     get_token_sub_part(ts,
 		       TS_CHARCLASS_WHITESPACE,
@@ -562,6 +699,16 @@ const cst_string *ts_get(cst_tokenstream *ts)
     return ts->token;
 }
 
+const cst_val *ts_part_val(const cst_string *part)
+{
+    if (part == NULL)
+        return atom_val("");
+    else if (cst_strlen(part) <= TS_PART_ATOM_MAX)
+        return atom_val(part);
+    else
+        return string_val(part);
+}
+
 int ts_read(void *buff, int size, int num, cst_tokenstream *ts)
 {
     /* people should complain about the speed here */
@@ -42,6 +42,7 @@
 #include "cst_val.h"
 #include "cst_string.h"
 #include "cst_tokenstream.h"
+#include "cst_thread.h"
 
 static cst_val *new_val()
 {
@@ -73,6 +74,123 @@ cst_val *string_val(const char *s)
     return v;
 }
 
+/* The atom table: open addressing on a hash of the string, always at */
+/* most half full.  Atoms are never freed so the table only grows.     */
+/* Lookups don't lock: slots are only ever filled (after the atom is    */
+/* made) and a bigger table is only published once it is filled in,    */
+/* old tables are kept as someone may still be looking in them.  The    */
+/* global lock is only taken to add an atom                             */
+typedef struct atom_table_struct {
+    int size;
+    cst_val **slots;
+    struct atom_table_struct *prev;
+} atom_table;
+
+static atom_table *atoms = NULL;
+static int num_atoms = 0;
+
+#if defined(__GNUC__)
+#define ATOM_LOAD(P) __atomic_load_n((P),__ATOMIC_ACQUIRE)
+#define ATOM_STORE(P,V) __atomic_store_n((P),(V),__ATOMIC_RELEASE)
+#define ATOM_LOCK_FREE 1
+#else
+/* Without atomics every lookup takes the lock */
+#define ATOM_LOAD(P) (*(P))
+#define ATOM_STORE(P,V) (*(P) = (V))
+#define ATOM_LOCK_FREE 0
+#endif
+
+static unsigned int atom_hash(const char *s, int n)
+{
+    unsigned int h = 5381;
+    int i;
+
+    for (i=0; i<n; i++)
+        h = (h*33) ^ (unsigned char)s[i];
+    return h;
+}
+
+static cst_val **atom_find(atom_table *t, const char *s, int n)
+{
+    cst_val **e, *v;
+    const char *a;
+    unsigned int i;
+
+    for (i=atom_hash(s,n)&(t->size-1); ; i=(i+1)&(t->size-1))
+    {
+        e = &t->slots[i];
+        if ((v = ATOM_LOAD(e)) == NULL)
+            return e;
+        a = CST_VAL_STRING(v);
+        if (cst_streqn(a,s,n) && (a[n] == '\0'))
+            return e;
+    }
+}
+
+static void atom_table_grow()
+{
+    atom_table *old = atoms, *t;
+    cst_val *v;
+    int i;
+
+    t = cst_alloc(atom_table,1);
+    t->size = (old == NULL) ? 256 : old->size*2;
+    t->slots = cst_alloc(cst_val *,t->size);
+    t->prev = old;
+    if (old)
+    {
+        for (i=0; i<old->size; i++)
+            if ((v = old->slots[i]) != NULL)
+                *atom_find(t,CST_VAL_STRING(v),
+                           cst_strlen(CST_VAL_STRING(v))) = v;
+    }
+    ATOM_STORE(&atoms,t);
+}
+
+const cst_val *atom_val_n(const char *s, int n)
+{
+    atom_table *t;
+    cst_val **e, *v;
+    char *str;
+
+    if (ATOM_LOCK_FREE && ((t = ATOM_LOAD(&atoms)) != NULL) &&
+        ((v = ATOM_LOAD(atom_find(t,s,n))) != NULL))
+        return v;
+
+    /* A new atom (or one just added by someone else).  The table is */
+    /* shared by all threads, so don't ask for atoms while holding    */
+    /* the global lock                                                */
+    cst_global_lock();
+    if ((atoms == NULL) || ((num_atoms+1)*2 > atoms->size))
+        atom_table_grow();
+    e = atom_find(atoms,s,n);
+    if ((v = *e) == NULL)
+    {
+        str = cst_alloc(char,n+1);
+        memmove(str,s,n);
+        v = new_val();
+        CST_VAL_TYPE(v) = CST_VAL_TYPE_STRING;
+        CST_VAL_REFCOUNT(v) = CST_VAL_REFCOUNT_ATOM;
+        CST_VAL_STRING_LVAL(v) = str;
+        ATOM_STORE(e,v);
+        num_atoms++;
+    }
+    cst_global_unlock();
+
+    return v;
+}
+
+const cst_val *atom_val(const char *s)
+{
+    return atom_val_n(s,cst_strlen(s));
+}
+
+int val_atomp(const cst_val *v)
+{
+    return (v && (CST_VAL_TYPE(v) == CST_VAL_TYPE_STRING) &&
+            (CST_VAL_REFCOUNT(v) == CST_VAL_REFCOUNT_ATOM));
+}
+
 cst_val *cons_val(const cst_val *a, const cst_val *b)
 {
     cst_val *v = new_val();
@@ -392,7 +510,13 @@ int val_equal(const cst_val *v1, const cst_val *v2)
 	else if (CST_VAL_TYPE(v1) == CST_VAL_TYPE_FLOAT)
 	    return (val_float(v1) == val_float(v2));
 	else if (CST_VAL_TYPE(v1) == CST_VAL_TYPE_STRING)
+	{
+	    /* different atoms are always different strings */
+	    if ((CST_VAL_REFCOUNT(v1) == CST_VAL_REFCOUNT_ATOM) &&
+		(CST_VAL_REFCOUNT(v2) == CST_VAL_REFCOUNT_ATOM))
+		return FALSE;
 	    return (cst_streq(CST_VAL_STRING(v1),CST_VAL_STRING(v2)));
+	}
 	else 
 	    return CST_VAL_VOID(v1) == CST_VAL_VOID(v2);
     }
@@ -442,7 +566,8 @@ cst_val *val_inc_refcount(const cst_val *b)
     /* where breaking const is reasonable                              */
     wb = (cst_val *)(void *)b;
 
-    if (CST_VAL_REFCOUNT(wb) == -1) 
+    if ((CST_VAL_REFCOUNT(wb) == -1) ||
+        (CST_VAL_REFCOUNT(wb) == CST_VAL_REFCOUNT_ATOM))
 	/* or is a cons cell in the text segment, how do I do that ? */
 	return wb;
     else if (!cst_val_consp(wb)) /* we don't ref count cons cells */
@@ -456,7 +581,8 @@ int val_dec_refcount(const cst_val *b)
 
     wb = (cst_val *)(void *)b;
 
-    if (CST_VAL_REFCOUNT(wb) == -1) 
+    if ((CST_VAL_REFCOUNT(wb) == -1) ||
+        (CST_VAL_REFCOUNT(wb) == CST_VAL_REFCOUNT_ATOM))
 	/* or is a cons cell in the text segment, how do I do that ? */
 	return -1;
     else if (cst_val_consp(wb)) /* we don't ref count cons cells */
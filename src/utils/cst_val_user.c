@@ -66,6 +66,10 @@ CST_VAL_REG_TD_FUNCPTR(breakfunc,cst_breakfunc,47)
 CST_VAL_REG_TD_TYPE(cg_db,cst_cg_db,49)
 CST_VAL_REG_TD_TYPE(voice,cst_voice,51)
 CST_VAL_REG_TD_TYPE(audio_streaming_info,cst_audio_streaming_info,53)
+CST_VAL_REG_TD_TYPE(synth_stats,cst_synth_stats,55)
+CST_VAL_REG_TD_TYPE_NODEL(prompt_cache,flite_prompt_cache,57)
+CST_VAL_REG_TD_TYPE_NODEL(cart_compiled,cst_cart_compiled,59)
+CST_VAL_REG_TD_TYPE(phoneset_accel,cst_phoneset_accel,61)
 
 const cst_val_def cst_val_defs[] = {
     /* These ones are never called */
@@ -97,5 +101,9 @@ const cst_val_def cst_val_defs[] = {
     { "cg_db", val_delete_cg_db },         /* 49 cg_db */
     { "voice", val_delete_voice },         /* 51 cst_voice */
     { "audio_streaming_info", val_delete_audio_streaming_info }, /* 53 asi */
+    { "synth_stats", val_delete_synth_stats }, /* 55 synth_stats */
+    { "prompt_cache", val_delete_prompt_cache }, /* 57 prompt_cache */
+    { "cart_compiled", val_delete_cart_compiled }, /* 59 cart_compiled */
+    { "phoneset_accel", val_delete_phoneset_accel }, /* 61 phoneset_accel */
     { NULL, NULL } /* NULLs at end of list */
 };
@@ -50,6 +50,8 @@
 #include "cst_wave.h"
 #include "cst_track.h"
 #include "cst_sigpr.h"
+#include "cst_thread.h"
+#include "cst_dsp.h"
 
 /* #define CLUNITS_DEBUG 1 */
 
@@ -70,15 +72,21 @@ CST_VAL_REGISTER_TYPE_NODEL(clunit_db,cst_clunit_db)
 CST_VAL_REGISTER_TYPE_NODEL(vit_cand,cst_vit_cand)
 
 static cst_utterance *clunits_select(cst_utterance *utt);
-static cst_vit_cand *cl_cand(cst_item *i,
-			     struct cst_viterbi_struct *vd);
-static cst_vit_path *cl_path(cst_vit_path *p,
-			     cst_vit_cand *c,
-			     cst_viterbi *vd);
+static void cl_states(cst_item *i,
+                      const cst_vit_column *prev,
+                      cst_vit_column *col,
+                      cst_viterbi *vd);
+static int cl_join(const cst_vit_state *p,
+                   const cst_vit_state *c,
+                   int *prev_move, int *this_move,
+                   cst_viterbi *vd);
 static const cst_cart *clunit_get_tree(cst_clunit_db *cludb, const char *name);
 static void clunit_set_unit_name(cst_item *s,cst_clunit_db *clunit_db);
 
 typedef int (*cst_distfunc)(const cst_clunit_db *, int, int, const int *, int, int);
+static int cl_join_cost(cst_clunit_db *cludb, int u0, int u1,
+                        int *u0_move, int *u1_move,
+                        cst_distfunc dfunc);
 static int optimal_couple_frame(cst_clunit_db *cludb, int u0, int u1,
 				cst_distfunc dfunc, int bestsofar);
 static int optimal_couple(cst_clunit_db *cludb,
@@ -138,11 +146,15 @@ static cst_utterance *clunits_select(cst_utterance *utt)
     int unit_entry;
     
     segs = utt_relation(utt,"Segment");
-    vd = new_viterbi(cl_cand,cl_path);
-    vd->num_states = -1;
+    vd = new_viterbi_array(cl_states,cl_join);
     vd->big_is_good = FALSE;
+    vd->beam_width = get_param_int(utt->features,"clunit_beam_width",0);
     feat_set(vd->f,"clunit_db",feat_val(utt->features,"clunit_db"));
     clunit_db = val_clunit_db(feat_val(vd->f,"clunit_db"));
+    clunit_db_prepare(clunit_db,
+                      get_param_int(utt->features,"clunit_join_cache_size",0),
+                      get_param_int(utt->features,"clunit_threads",0));
+    vd->workers = clunit_db->workers;
     utt_set_feat(utt,"sts_list",sts_list_val(clunit_db->sts));
 
     for (s=relation_head(segs); s; s=item_next(s))
@@ -155,8 +167,7 @@ static cst_utterance *clunits_select(cst_utterance *utt)
 	cst_errmsg("clunits: can't find path\n");
 	cst_error();
     }
-    viterbi_copy_feature(vd, "unit_prev_move");
-    viterbi_copy_feature(vd, "unit_this_move");
+    viterbi_copy_moves(vd, "unit_prev_move", "unit_this_move");
     delete_viterbi(vd);
 
     /* Construct unit stream with selected units */
@@ -164,7 +175,7 @@ static cst_utterance *clunits_select(cst_utterance *utt)
     for (s=relation_head(segs); s; s=item_next(s))
     {
 	u = relation_append(units,NULL);
-	item_set_string(u,"name",item_name(s));
+	item_set(u,"name",atom_val(item_name(s)));
 
 	unit_entry = item_feat_int(s,"selected_unit");
 
@@ -212,14 +223,17 @@ static cst_utterance *clunits_select(cst_utterance *utt)
 /* doing this is meaningless -- but *is* better */
 #define clunits_target_weight 70
 
-static cst_vit_cand *cl_cand(cst_item *i,cst_viterbi *vd)
+static void cl_states(cst_item *i,
+                      const cst_vit_column *prev,
+                      cst_vit_column *col,
+                      cst_viterbi *vd)
 {
     const char *unit_type;
     unsigned short nu;
     int idx;
-    int e;
+    int e, j, k;
     const cst_val *clist,*c;
-    cst_vit_cand *p,*all,*gt,*lc;
+    cst_vit_state x;
     cst_clunit_db *clunit_db;
     int ccc;
 
@@ -229,61 +243,55 @@ static cst_vit_cand *cl_cand(cst_item *i,cst_viterbi *vd)
     /* get tree */
     clist = cart_interpret(i,clunit_get_tree(clunit_db,unit_type));
 
-    all = 0; ccc = clunits_target_weight;
+    ccc = clunits_target_weight;
     for (c=clist; c; c=val_cdr(c))
     {
 	idx = clunit_get_unit_index(clunit_db, unit_type, val_int(val_car(c)));
-	p = new_vit_cand();
-	p->next = all;
-	p->item = i;
-	p->score = ccc;
+	viterbi_add_state(vd,col,idx,ccc);
         ccc += clunits_target_weight;
-	vit_cand_set_int(p,idx);
-	all = p;
     }
 
-    if ((clunit_db->extend_selections > 0) && (item_prev(i)))
+    if ((clunit_db->extend_selections > 0) && prev && (col->num_states > 0))
     {
-	lc = val_vit_cand(item_feat(item_prev(i),"clunit_cands"));
-	for (e=0; lc && (e < clunit_db->extend_selections); lc=lc->next)
+	for (e=0,k=0; (k < prev->num_states) &&
+                 (e < clunit_db->extend_selections); k++)
 	{
-	    nu = clunit_db->units[lc->ival].next;
+	    nu = clunit_db->units[prev->states[k].ival].next;
 	    if (nu == CLUNIT_NONE)
 		continue;
-	    for (gt=all; gt; gt=gt->next)
-		if (nu == gt->ival)
+	    for (j=0; j < col->num_states; j++)
+		if (nu == col->states[j].ival)
 		    break;  /* we've got this one already */
-	    if ((gt == 0)
+	    if ((j == col->num_states)
 		&& (clunit_db->units[nu].type
-		    == clunit_db->units[all->ival].type))
+		    == clunit_db->units[col->states[j-1].ival].type))
 	    {
-		p = new_vit_cand();
-		p->next = all;
-		p->item = i;
-		p->score = 0;
-		vit_cand_set_int(p, nu);
-		all = p;
+		viterbi_add_state(vd,col,nu,0);
 		e++;
 	    }
 	}
     }
-    item_set(i,"clunit_cands",vit_cand_val(all));
 
-    return all;
+    /* Candidates used to be pushed on a list, so they came out last */
+    /* first, keep that order as it decides which of equal paths wins */
+    for (j=0,k=col->num_states-1; j < k; j++,k--)
+    {
+        x = col->states[j];
+        col->states[j] = col->states[k];
+        col->states[k] = x;
+    }
 }
 
-static cst_vit_path *cl_path(cst_vit_path *p,
-			     cst_vit_cand *c,
-			     cst_viterbi *vd)
+static int cl_join(const cst_vit_state *p,
+                   const cst_vit_state *c,
+                   int *prev_move, int *this_move,
+                   cst_viterbi *vd)
 {
     int cost;
-    cst_vit_path *np;
+    int u0_move = -1, u1_move = -1;
     cst_clunit_db *cludb;
     cst_distfunc dfunc;
-    int u0,u1;
-    int u0_move = -1, u1_move = -1;
 
-    np = new_vit_path();
     cludb = val_clunit_db(feat_val(vd->f,"clunit_db"));	
     if (cludb->mcep->sts)
         dfunc = frame_distance;
@@ -294,37 +302,85 @@ static cst_vit_path *cl_path(cst_vit_path *p,
     else
 	dfunc = frame_distanceb;
 
-    np->cand = c;
-    np->from = p;
-    
-    if ((p==0) || (p->cand == 0))
-	cost = 0;
+    if (cludb->optimal_coupling == 1)
+        cost = cl_join_cost(cludb, p->ival, c->ival,
+                            prev_move, this_move, dfunc);
+    else if (cludb->optimal_coupling == 2)
+	cost = cl_join_cost(cludb, p->ival, c->ival,
+                            &u0_move, &u1_move, dfunc);
     else
+	cost = 0;
+
+    cost *= 1; /* magic number ("continuity weight") */
+
+    return cost;
+}
+
+void clunit_db_prepare(cst_clunit_db *cludb, int cache_size,
+                       int num_threads)
+{
+    /* The db is shared between all utterances (and threads) so this */
+    /* is done under the global lock, it only does work first time   */
+    unsigned short *w16;
+    int i;
+
+    cst_global_lock();
+    if ((cludb->join_weights16 == NULL) && cludb->join_weights)
+    {   /* The weights are normally 32768, if they fit in 16 bits the */
+        /* SIMD distance can use a 16x16 multiply high for w*|a-b|/65536 */
+        for (i=0; i < cludb->mcep->num_channels; i++)
+            if ((cludb->join_weights[i] < 0) ||
+                (cludb->join_weights[i] > 65535))
+                break;
+        if (i == cludb->mcep->num_channels)
+        {
+            w16 = cst_alloc(unsigned short,cludb->mcep->num_channels);
+            for (i=0; i < cludb->mcep->num_channels; i++)
+                w16[i] = (unsigned short)cludb->join_weights[i];
+            cludb->join_weights16 = w16;
+        }
+    }
+    if ((cache_size > 0) && (cludb->join_cache == NULL))
+        cludb->join_cache = new_clunit_join_cache(cache_size);
+    /* Joins only read the db (and the locked cache), so can be threaded */
+    if ((num_threads > 1) && (cludb->workers == NULL))
+        cludb->workers = new_thread_pool(num_threads);
+    cst_global_unlock();
+}
+
+static int cl_join_cost(cst_clunit_db *cludb, int u0, int u1,
+                        int *u0_move, int *u1_move,
+                        cst_distfunc dfunc)
+{
+    /* Precomputed joins, then the cache, then actually work it out */
+    const cst_clunit_join *pj = NULL;
+    cst_clunit_join j;
+
+    if (cludb->join_table)
+        pj = clunit_join_table_lookup(cludb->join_table,u0,u1);
+    if ((pj == NULL) && cludb->join_cache &&
+        clunit_join_cache_lookup(cludb->join_cache,u0,u1,&j))
+        pj = &j;
+    if (pj)
     {
-	u0 = p->cand->ival;
-	u1 = c->ival;
-	if (cludb->optimal_coupling == 1) {
-	    if (np->f == NULL)
-		np->f = new_features();
-	    cost = optimal_couple(cludb, u0, u1, &u0_move, &u1_move, dfunc);
-	    if (u0_move != -1)
-		    feat_set(np->f, "unit_prev_move", int_val(u0_move));
-	    if (u1_move != -1)
-		    feat_set(np->f, "unit_this_move", int_val(u1_move));
-	} else if (cludb->optimal_coupling == 2)
-	    cost = optimal_couple_frame(cludb, u0, u1, dfunc, INT_MAX);
-	else
-	    cost = 0;
+        *u0_move = pj->u0_move;
+        *u1_move = pj->u1_move;
+        return pj->cost;
     }
 
-    cost *= 1; /* magic number ("continuity weight") */
-    np->state = c->pos;
-    if (p==0)
-	np->score = cost + c->score;
+    j.u0 = u0;
+    j.u1 = u1;
+    j.u0_move = j.u1_move = -1;
+    if (cludb->optimal_coupling == 1)
+        j.cost = optimal_couple(cludb, u0, u1, &j.u0_move, &j.u1_move, dfunc);
     else
-	np->score = cost + c->score + p->score;
+        j.cost = optimal_couple_frame(cludb, u0, u1, dfunc, INT_MAX);
+    if (cludb->join_cache)
+        clunit_join_cache_add(cludb->join_cache,&j);
 
-    return np;
+    *u0_move = j.u0_move;
+    *u1_move = j.u1_move;
+    return j.cost;
 }
 
 static int optimal_couple_frame(cst_clunit_db *cludb, int u0, int u1,
@@ -452,6 +508,10 @@ static int frame_distance(const cst_clunit_db *cludb,
     bv = get_sts_frame(cludb->mcep, b);
     av = get_sts_frame(cludb->mcep, a);
 
+    if (cludb->join_weights16)
+        return cst_dsp->wabsdiff16(av,bv,cludb->join_weights16,
+                                   order,bestsofar);
+
 #if CLUNITS_DEBUG > 2
     cst_dbgmsg("a(%d): ",a);
     for (i = 0; i < order; ++i)
@@ -492,6 +552,10 @@ static int frame_distanceb(const cst_clunit_db *cludb,
     bv = get_sts_residual_fixed(cludb->mcep, b);
     av = get_sts_residual_fixed(cludb->mcep, a);
 
+    if (cludb->join_weights16)
+        return cst_dsp->wabsdiff8(av,bv,cludb->join_weights16,
+                                  order,bestsofar);
+
 #if CLUNITS_DEBUG > 2
     cst_dbgmsg("a(%d): ",a);
     for (i = 0; i < order; ++i)
@@ -0,0 +1,311 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Join cost caching for clunits selection                              */
+/*                                                                       */
+/*  Optimal coupling of two units slides over a third of each unit       */
+/*  comparing mcep frames, and the same unit pairs come up again and     */
+/*  again across utterances.  This offers a bounded LRU cache of join    */
+/*  costs hung off the clunit_db, and a precomputed table of the most    */
+/*  used joins, learnt from the cache, that can be compiled into a voice */
+/*                                                                       */
+/*************************************************************************/
+
+#include <stdlib.h>
+
+#include "cst_clunits.h"
+#include "cst_thread.h"
+
+typedef struct cst_clunit_join_entry_struct {
+    cst_clunit_join j;
+    int uses;
+    int chain;        /* next entry in same hash bucket */
+    int prev, next;   /* LRU order, head is most recently used */
+} cst_clunit_join_entry;
+
+struct cst_clunit_join_cache_struct {
+    int size;
+    int num_entries;
+    cst_clunit_join_entry *entries;
+    int num_buckets;  /* a power of 2 */
+    int *buckets;
+    int head, tail;
+    int hits, misses;
+    cst_mutex *lock;
+};
+
+static unsigned int join_hash(const cst_clunit_join_cache *jc, int u0, int u1)
+{
+    return (((unsigned int)u0 * 2654435761U) ^ ((unsigned int)u1 * 40503U))
+        & (jc->num_buckets-1);
+}
+
+cst_clunit_join_cache *new_clunit_join_cache(int size)
+{
+    cst_clunit_join_cache *jc;
+    int i;
+
+    jc = cst_alloc(cst_clunit_join_cache,1);
+    jc->size = (size < 1) ? 1 : size;
+    jc->entries = cst_alloc(cst_clunit_join_entry,jc->size);
+    for (jc->num_buckets=1; jc->num_buckets < jc->size; jc->num_buckets *= 2);
+    jc->buckets = cst_alloc(int,jc->num_buckets);
+    for (i=0; i<jc->num_buckets; i++)
+        jc->buckets[i] = -1;
+    jc->head = jc->tail = -1;
+    jc->lock = new_mutex();
+
+    return jc;
+}
+
+void delete_clunit_join_cache(cst_clunit_join_cache *jc)
+{
+    if (jc)
+    {
+        delete_mutex(jc->lock);
+        cst_free(jc->buckets);
+        cst_free(jc->entries);
+        cst_free(jc);
+    }
+}
+
+static void join_lru_unlink(cst_clunit_join_cache *jc, int e)
+{
+    cst_clunit_join_entry *ee = &jc->entries[e];
+
+    if (ee->prev == -1)
+        jc->head = ee->next;
+    else
+        jc->entries[ee->prev].next = ee->next;
+    if (ee->next == -1)
+        jc->tail = ee->prev;
+    else
+        jc->entries[ee->next].prev = ee->prev;
+}
+
+static void join_lru_push(cst_clunit_join_cache *jc, int e)
+{
+    cst_clunit_join_entry *ee = &jc->entries[e];
+
+    ee->prev = -1;
+    ee->next = jc->head;
+    if (jc->head != -1)
+        jc->entries[jc->head].prev = e;
+    jc->head = e;
+    if (jc->tail == -1)
+        jc->tail = e;
+}
+
+static int join_find(cst_clunit_join_cache *jc, int u0, int u1)
+{
+    int e;
+
+    for (e=jc->buckets[join_hash(jc,u0,u1)]; e != -1; e=jc->entries[e].chain)
+        if ((jc->entries[e].j.u0 == u0) && (jc->entries[e].j.u1 == u1))
+            return e;
+    return -1;
+}
+
+int clunit_join_cache_lookup(cst_clunit_join_cache *jc, int u0, int u1,
+                             cst_clunit_join *j)
+{
+    int e;
+
+    cst_mutex_lock(jc->lock);
+    e = join_find(jc,u0,u1);
+    if (e == -1)
+        jc->misses++;
+    else
+    {
+        jc->hits++;
+        jc->entries[e].uses++;
+        *j = jc->entries[e].j;
+        if (jc->head != e)
+        {
+            join_lru_unlink(jc,e);
+            join_lru_push(jc,e);
+        }
+    }
+    cst_mutex_unlock(jc->lock);
+
+    return (e != -1);
+}
+
+void clunit_join_cache_add(cst_clunit_join_cache *jc, const cst_clunit_join *j)
+{
+    int e, *c;
+
+    cst_mutex_lock(jc->lock);
+    if (join_find(jc,j->u0,j->u1) != -1)
+    {   /* someone else got here first */
+        cst_mutex_unlock(jc->lock);
+        return;
+    }
+    if (jc->num_entries < jc->size)
+        e = jc->num_entries++;
+    else
+    {   /* evict the least recently used */
+        e = jc->tail;
+        join_lru_unlink(jc,e);
+        for (c=&jc->buckets[join_hash(jc,jc->entries[e].j.u0,
+                                         jc->entries[e].j.u1)];
+             *c != e; c=&jc->entries[*c].chain);
+        *c = jc->entries[e].chain;
+    }
+    jc->entries[e].j = *j;
+    jc->entries[e].uses = 1;
+    c = &jc->buckets[join_hash(jc,j->u0,j->u1)];
+    jc->entries[e].chain = *c;
+    *c = e;
+    join_lru_push(jc,e);
+    cst_mutex_unlock(jc->lock);
+}
+
+void clunit_join_cache_stats(cst_clunit_join_cache *jc,
+                             int *hits, int *misses, int *entries)
+{
+    cst_mutex_lock(jc->lock);
+    if (hits) *hits = jc->hits;
+    if (misses) *misses = jc->misses;
+    if (entries) *entries = jc->num_entries;
+    cst_mutex_unlock(jc->lock);
+}
+
+const cst_clunit_join *clunit_join_table_lookup(const cst_clunit_join_table *t,
+                                                int u0, int u1)
+{
+    int start, end, mid;
+    const cst_clunit_join *j;
+
+    start = 0;
+    end = t->num_joins;
+    while (start < end)
+    {
+        mid = (start+end)/2;
+        j = &t->joins[mid];
+        if ((j->u0 == u0) && (j->u1 == u1))
+            return j;
+        else if ((j->u0 > u0) || ((j->u0 == u0) && (j->u1 > u1)))
+            end = mid;
+        else
+            start = mid + 1;
+    }
+
+    return NULL;
+}
+
+static int join_cmp_uses(const void *a, const void *b)
+{
+    const cst_clunit_join_entry *ja = (const cst_clunit_join_entry *)a;
+    const cst_clunit_join_entry *jb = (const cst_clunit_join_entry *)b;
+
+    if (ja->j.u0 != jb->j.u0)
+        return ja->j.u0 - jb->j.u0;
+    else if (ja->uses != jb->uses)
+        return jb->uses - ja->uses;   /* most used first */
+    else
+        return ja->j.u1 - jb->j.u1;
+}
+
+static int join_cmp_units(const void *a, const void *b)
+{
+    const cst_clunit_join_entry *ja = (const cst_clunit_join_entry *)a;
+    const cst_clunit_join_entry *jb = (const cst_clunit_join_entry *)b;
+
+    if (ja->j.u0 != jb->j.u0)
+        return ja->j.u0 - jb->j.u0;
+    else
+        return ja->j.u1 - jb->j.u1;
+}
+
+int clunit_join_table_save(cst_clunit_db *cludb, int k, const char *filename)
+{
+    /* Save the k most used joins from each unit seen in the cache as */
+    /* a C table that can be compiled into the voice                  */
+    cst_clunit_join_cache *jc = cludb->join_cache;
+    cst_clunit_join_entry *e;
+    cst_file fd;
+    int i, n, m, c, u0;
+
+    if (jc == NULL)
+    {
+        cst_errmsg("clunit_join_table_save: no join cache for %s\n",
+                   cludb->name);
+        return -1;
+    }
+    if ((fd = cst_fopen(filename,CST_OPEN_WRITE)) == NULL)
+    {
+        cst_errmsg("clunit_join_table_save: can't open file \"%s\"\n",
+                   filename);
+        return -1;
+    }
+
+    cst_mutex_lock(jc->lock);
+    n = jc->num_entries;
+    e = cst_alloc(cst_clunit_join_entry,n+1);
+    memmove(e,jc->entries,n*sizeof(cst_clunit_join_entry));
+    cst_mutex_unlock(jc->lock);
+
+    qsort(e,n,sizeof(cst_clunit_join_entry),join_cmp_uses);
+    for (m=0,c=0,u0=-1,i=0; i<n; i++)
+    {
+        if (e[i].j.u0 != u0)
+        {
+            u0 = e[i].j.u0;
+            c = 0;
+        }
+        if (c++ < k)
+            e[m++] = e[i];
+    }
+    qsort(e,m,sizeof(cst_clunit_join_entry),join_cmp_units);
+
+    cst_fprintf(fd,"/* Autogenerated join table for %s */\n\n",cludb->name);
+    cst_fprintf(fd,"#include \"cst_clunits.h\"\n\n");
+    cst_fprintf(fd,"static const cst_clunit_join %s_joins[] = {\n",
+                cludb->name);
+    for (i=0; i<m; i++)
+        cst_fprintf(fd,"   { %d, %d, %d, %d, %d },\n",
+                    e[i].j.u0,e[i].j.u1,e[i].j.cost,
+                    e[i].j.u0_move,e[i].j.u1_move);
+    cst_fprintf(fd,"   { 0, 0, 0, 0, 0 }\n};\n\n");
+    cst_fprintf(fd,"const cst_clunit_join_table %s_join_table = {\n",
+                cludb->name);
+    cst_fprintf(fd,"   %d,\n   %s_joins\n};\n",m,cludb->name);
+    cst_fclose(fd);
+    cst_free(e);
+
+    return m;
+}
@@ -0,0 +1,977 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Loadable clunits voice files                                         */
+/*                                                                       */
+/*  A complete clunits voice (types, units, trees, join weights, joins,  */
+/*  lpc and mcep frames, residuals and voice features) in one file that  */
+/*  is mmap'd and used in place, the analogue of flitevox files for CG.  */
+/*  The file is a fixed header followed by sections, each an array of    */
+/*  fixed size records at a 16 byte aligned offset.  Bulk data (units,   */
+/*  frames, residuals, joins) is used straight from the map, only the    */
+/*  small index structures with pointers (types, trees, vals) are built  */
+/*  at load time.  Files are native byte order and layout, a file        */
+/*  dumped on a different kind of machine is refused.                    */
+/*                                                                       */
+/*  The voice's lexicon isn't saved, as with flitevox files a loaded     */
+/*  voice uses the lexicon of its language (and secondary languages)     */
+/*  from lang_table, so addenda or a voice specific lexicon are lost.    */
+/*                                                                       */
+/*************************************************************************/
+
+#include "flite.h"
+#include "cst_endian.h"
+#include "cst_clunits.h"
+#include "cst_cg.h"
+
+const char * const clunits_voice_header_string = "CMU_FLITE_CLUNITS_VOXDATA-v1.0";
+
+/* The sections, in file order */
+#define CLV_STRINGS        0   /* char, NUL terminated strings */
+#define CLV_FEATURES       1   /* int name/value string offset pairs */
+#define CLV_TYPES          2   /* clv_type */
+#define CLV_UNITS          3   /* cst_clunit */
+#define CLV_TREES          4   /* clv_tree */
+#define CLV_NODES          5   /* clv_node */
+#define CLV_TREE_FEATS     6   /* int string offsets */
+#define CLV_VALS           7   /* clv_val */
+#define CLV_JOIN_WEIGHTS   8   /* int */
+#define CLV_JOINS          9   /* cst_clunit_join */
+#define CLV_STS_FRAMES    10   /* unsigned short */
+#define CLV_STS_RESOFFS   11   /* unsigned int, one more than frames */
+#define CLV_STS_RESIDUALS 12   /* unsigned char */
+#define CLV_STS_RESSIZES  13   /* unsigned char */
+#define CLV_MCEP_FRAMES   14   /* unsigned short (unsigned char if bytes) */
+#define CLV_DUR_STATS     15   /* clv_dur_stat */
+#define CLV_NUM_SECTIONS  16
+
+#define CLV_ALIGN 16
+
+typedef struct clv_section_struct {
+    unsigned int offset;   /* from the start of the file */
+    int count;             /* number of records */
+} clv_section;
+
+typedef struct clv_sts_struct {
+    int num_channels;
+    int sample_rate;
+    float coeff_min;
+    float coeff_range;
+    int codec;             /* string, -1 for none */
+    int bytes;             /* frames are unsigned chars */
+} clv_sts;
+
+typedef struct clv_header_struct {
+    char magic[32];
+    int endian;
+    int record_size[CLV_NUM_SECTIONS];  /* layout check */
+    clv_section sections[CLV_NUM_SECTIONS];
+
+    int name;              /* string */
+    int num_types;
+    int num_units;
+    int num_frames;
+    int optimal_coupling;
+    int extend_selections;
+    int f0_weight;
+    int dur_cart;          /* tree, -1 for none */
+    clv_sts sts;
+    clv_sts mcep;
+} clv_header;
+
+typedef struct clv_type_struct {
+    int name;
+    int start, count;
+} clv_type;
+
+typedef struct clv_tree_struct {
+    int first_node, num_nodes;
+    int first_feat, num_feats;
+} clv_tree;
+
+typedef struct clv_node_struct {
+    unsigned char feat;
+    unsigned char op;
+    unsigned short no_node;
+    int val;
+} clv_node;
+
+typedef struct clv_val_struct {
+    int type;
+    int ival;              /* int, string, or car of a cons */
+    float fval;
+    int cdr;
+} clv_val;
+
+typedef struct clv_dur_stat_struct {
+    int phone;
+    float mean, stddev;
+} clv_dur_stat;
+
+static const int clv_record_size[CLV_NUM_SECTIONS] = {
+    sizeof(char), 2*sizeof(int), sizeof(clv_type), sizeof(cst_clunit),
+    sizeof(clv_tree), sizeof(clv_node), sizeof(int), sizeof(clv_val),
+    sizeof(int), sizeof(cst_clunit_join), sizeof(unsigned short),
+    sizeof(unsigned int), sizeof(unsigned char), sizeof(unsigned char),
+    sizeof(unsigned short), sizeof(clv_dur_stat) };
+
+/* Voice features that are saved, if set */
+static const char * const clv_voice_features[] = {
+    "language", "secondary_languages", "country", "variant", "age",
+    "gender", "build_date", "description", "copyright",
+    "int_f0_target_mean", "int_f0_target_stddev", "duration_stretch",
+    "join_type", "resynth_type", "clunit_unit_name",
+    NULL };
+
+/* Everything a loaded voice owns, hung off the voice as "clunit_voxfile" */
+typedef struct clv_voxfile_struct {
+    cst_filemap *map;
+    cst_clunit_db db;
+    cst_sts_list sts, mcep;
+    cst_clunit_join_table join_table;
+    cst_clunit_type *types;
+    cst_cart *carts;
+    const cst_cart **trees;
+    cst_cart_node *nodes;
+    const char **feats;
+    cst_val *vals;
+    dur_stat *dur_stats;
+    const dur_stat **dur_stat_list;
+} clv_voxfile;
+
+/* Dumping */
+
+typedef struct clv_buf_struct {
+    char *mem;
+    int size;
+    int max;
+} clv_buf;
+
+typedef struct clv_dump_struct {
+    clv_buf sections[CLV_NUM_SECTIONS];
+    /* vals are often shared, so keep them that way */
+    const cst_val **val_keys;
+    int *val_index;
+    int val_hash_size;
+    int num_vals;
+    int error;
+} clv_dump;
+
+static int clv_add(clv_dump *d, int section, const void *data, int n)
+{
+    /* Add n records, returning the index of the first */
+    clv_buf *b = &d->sections[section];
+    int size = n * clv_record_size[section];
+    int r = b->size / clv_record_size[section];
+
+    if (b->size + size > b->max)
+    {
+        b->max = (b->size + size) * 2 + 1024;
+        b->mem = cst_realloc(b->mem,char,b->max);
+    }
+    if (data)
+        memmove(b->mem+b->size,data,size);
+    else
+        memset(b->mem+b->size,0,size);
+    b->size += size;
+
+    return r;
+}
+
+static int clv_add_string(clv_dump *d, const char *s)
+{
+    if (s == NULL)
+        return -1;
+    return clv_add(d,CLV_STRINGS,s,cst_strlen(s)+1);
+}
+
+static int clv_val_hash(const cst_val *v, int size)
+{
+    return (int)((((size_t)v) >> 3) * 2654435761u) & (size - 1);
+}
+
+static void clv_val_remember(clv_dump *d, const cst_val *v, int index)
+{
+    const cst_val **old_keys;
+    int *old_index;
+    int i, h, old_size;
+
+    if ((d->num_vals+1) * 2 > d->val_hash_size)
+    {
+        old_keys = d->val_keys;
+        old_index = d->val_index;
+        old_size = d->val_hash_size;
+        d->val_hash_size = (old_size == 0) ? 1024 : old_size * 2;
+        d->val_keys = cst_alloc(const cst_val *,d->val_hash_size);
+        d->val_index = cst_alloc(int,d->val_hash_size);
+        for (i=0; i < old_size; i++)
+        {
+            if (old_keys[i] == NULL)
+                continue;
+            for (h=clv_val_hash(old_keys[i],d->val_hash_size);
+                 d->val_keys[h]; h=(h+1)&(d->val_hash_size-1));
+            d->val_keys[h] = old_keys[i];
+            d->val_index[h] = old_index[i];
+        }
+        cst_free(old_keys);
+        cst_free(old_index);
+    }
+    for (h=clv_val_hash(v,d->val_hash_size); d->val_keys[h];
+         h=(h+1)&(d->val_hash_size-1));
+    d->val_keys[h] = v;
+    d->val_index[h] = index;
+    d->num_vals++;
+}
+
+static int clv_add_val(clv_dump *d, const cst_val *v)
+{
+    clv_val r;
+    int i, h;
+
+    if (v == NULL)
+        return -1;
+    if (d->val_hash_size > 0)
+        for (h=clv_val_hash(v,d->val_hash_size); d->val_keys[h];
+             h=(h+1)&(d->val_hash_size-1))
+            if (d->val_keys[h] == v)
+                return d->val_index[h];
+
+    memset(&r,0,sizeof(r));
+    r.cdr = -1;
+    i = clv_add(d,CLV_VALS,NULL,1);
+    clv_val_remember(d,v,i);
+    if (cst_val_consp(v))
+    {
+        r.type = CST_VAL_TYPE_CONS;
+        r.ival = clv_add_val(d,val_car(v));
+        r.cdr = clv_add_val(d,val_cdr(v));
+    }
+    else if (CST_VAL_TYPE(v) == CST_VAL_TYPE_INT)
+    {
+        r.type = CST_VAL_TYPE_INT;
+        r.ival = val_int(v);
+    }
+    else if (CST_VAL_TYPE(v) == CST_VAL_TYPE_FLOAT)
+    {
+        r.type = CST_VAL_TYPE_FLOAT;
+        r.fval = val_float(v);
+    }
+    else if (CST_VAL_TYPE(v) == CST_VAL_TYPE_STRING)
+    {
+        r.type = CST_VAL_TYPE_STRING;
+        r.ival = clv_add_string(d,val_string(v));
+    }
+    else
+    {
+        cst_errmsg("clunits dump: can't save val of type %d\n",
+                   CST_VAL_TYPE(v));
+        d->error = TRUE;
+    }
+    ((clv_val *)d->sections[CLV_VALS].mem)[i] = r;
+
+    return i;
+}
+
+static int clv_add_tree(clv_dump *d, const cst_cart *tree)
+{
+    clv_tree t;
+    clv_node n;
+    int i, s;
+
+    t.first_node = d->sections[CLV_NODES].size / sizeof(clv_node);
+    for (i=0; tree->rule_table[i].val; i++)
+    {
+        n.feat = tree->rule_table[i].feat;
+        n.op = tree->rule_table[i].op;
+        n.no_node = tree->rule_table[i].no_node;
+        n.val = clv_add_val(d,tree->rule_table[i].val);
+        clv_add(d,CLV_NODES,&n,1);
+    }
+    t.num_nodes = i;
+    t.first_feat = d->sections[CLV_TREE_FEATS].size / sizeof(int);
+    for (i=0; tree->feat_table[i]; i++)
+    {
+        s = clv_add_string(d,tree->feat_table[i]);
+        clv_add(d,CLV_TREE_FEATS,&s,1);
+    }
+    t.num_feats = i;
+
+    return clv_add(d,CLV_TREES,&t,1);
+}
+
+static void clv_add_feature(clv_dump *d, const cst_voice *v, const char *name)
+{
+    const cst_val *f;
+    char num[64];
+    const char *s;
+    int pair[2];
+
+    f = get_param_val(v->features,name,NULL);
+    if ((f == NULL) || cst_val_consp(f))
+        return;
+    if (CST_VAL_TYPE(f) == CST_VAL_TYPE_STRING)
+        s = val_string(f);
+    else if (CST_VAL_TYPE(f) == CST_VAL_TYPE_INT)
+    {
+        cst_sprintf(num,"%d",val_int(f));
+        s = num;
+    }
+    else if (CST_VAL_TYPE(f) == CST_VAL_TYPE_FLOAT)
+    {
+        cst_sprintf(num,"%f",val_float(f));
+        s = num;
+    }
+    else
+        return;
+
+    pair[0] = clv_add_string(d,name);
+    pair[1] = clv_add_string(d,s);
+    clv_add(d,CLV_FEATURES,pair,1);
+}
+
+static int clv_residual_bytes(const cst_sts_list *s, int frame)
+{
+    /* How much space the (possibly encoded) residual takes */
+    const unsigned char *r = get_sts_residual(s,frame);
+    int size = get_frame_size(s,frame);
+
+    if (s->codec && cst_streq(s->codec,"g721"))
+        return (size+CST_G721_LEADIN+1)/2;
+    else if (s->codec && cst_streq(s->codec,"g721vuv"))
+        return (r[0] == 0) ? 5 : (size+CST_G721_LEADIN+1)/2;
+    else if (s->codec && cst_streq(s->codec,"vuv"))
+        return (r[0] == 0) ? 5 : size;
+    else
+        return size;
+}
+
+static void clv_set_sts(clv_dump *d, clv_sts *h, const cst_sts_list *s)
+{
+    h->num_channels = s->num_channels;
+    h->sample_rate = s->sample_rate;
+    h->coeff_min = s->coeff_min;
+    h->coeff_range = s->coeff_range;
+    h->codec = clv_add_string(d,s->codec);
+}
+
+static void clv_add_frames(clv_dump *d, clv_header *h, const cst_clunit_db *db)
+{
+    unsigned int offset;
+    unsigned char size;
+    int i, n;
+
+    for (i=0; i < h->num_frames; i++)
+    {
+        clv_add(d,CLV_STS_FRAMES,get_sts_frame(db->sts,i),
+                db->sts->num_channels);
+        offset = d->sections[CLV_STS_RESIDUALS].size;
+        clv_add(d,CLV_STS_RESOFFS,&offset,1);
+        n = clv_residual_bytes(db->sts,i);
+        clv_add(d,CLV_STS_RESIDUALS,get_sts_residual(db->sts,i),n);
+        if (get_frame_size(db->sts,i) > 255)
+        {
+            cst_errmsg("clunits dump: frame %d is too big\n",i);
+            d->error = TRUE;
+        }
+        size = (unsigned char)get_frame_size(db->sts,i);
+        clv_add(d,CLV_STS_RESSIZES,&size,1);
+    }
+    offset = d->sections[CLV_STS_RESIDUALS].size;
+    clv_add(d,CLV_STS_RESOFFS,&offset,1);
+
+    /* mceps are only used for joins, they may be shorts or bytes */
+    if (db->mcep->sts || db->mcep->sts_paged || db->mcep->frames)
+    {
+        for (i=0; i < h->num_frames; i++)
+            clv_add(d,CLV_MCEP_FRAMES,get_sts_frame(db->mcep,i),
+                    db->mcep->num_channels);
+    }
+    else
+    {
+        /* packed together, and padded to a whole number of shorts */
+        h->mcep.bytes = TRUE;
+        n = h->num_frames * db->mcep->num_channels;
+        clv_add(d,CLV_MCEP_FRAMES,NULL,(n+1)/2);
+        for (i=0; i < h->num_frames; i++)
+            memmove(d->sections[CLV_MCEP_FRAMES].mem + 
+                    (i * db->mcep->num_channels),
+                    get_sts_residual_fixed(db->mcep,i),
+                    db->mcep->num_channels);
+    }
+}
+
+int cst_clunits_dump_voice(const cst_voice *v, const char *filename)
+{
+    clv_dump d;
+    clv_header h;
+    const cst_clunit_db *db;
+    const dur_stat * const *ds;
+    clv_dur_stat dr;
+    cst_file fd;
+    char pad[CLV_ALIGN];
+    unsigned int offset;
+    int i;
+
+    if (!feat_present(v->features,"clunit_db"))
+        return 0;  /* not a clunits voice */
+    db = val_clunit_db(feat_val(v->features,"clunit_db"));
+
+    memset(&d,0,sizeof(d));
+    memset(&h,0,sizeof(h));
+    memset(pad,0,sizeof(pad));
+    cst_sprintf(h.magic,"%s",clunits_voice_header_string);
+    h.endian = cst_endian_loc;
+    for (i=0; i < CLV_NUM_SECTIONS; i++)
+        h.record_size[i] = clv_record_size[i];
+
+    clv_add_string(&d,"");  /* so no real string is at 0 */
+    h.name = clv_add_string(&d,db->name);
+    h.num_types = db->num_types;
+    h.num_units = db->num_units;
+    h.optimal_coupling = db->optimal_coupling;
+    h.extend_selections = db->extend_selections;
+    h.f0_weight = db->f0_weight;
+
+    for (i=0; clv_voice_features[i]; i++)
+        clv_add_feature(&d,v,clv_voice_features[i]);
+
+    for (i=0; i < db->num_types; i++)
+    {
+        clv_type t;
+        t.name = clv_add_string(&d,db->types[i].name);
+        t.start = db->types[i].start;
+        t.count = db->types[i].count;
+        clv_add(&d,CLV_TYPES,&t,1);
+    }
+    clv_add(&d,CLV_UNITS,db->units,db->num_units);
+    for (i=0; i < db->num_types; i++)
+        clv_add_tree(&d,db->trees[i]);
+
+    if (db->join_weights)
+        clv_add(&d,CLV_JOIN_WEIGHTS,db->join_weights,db->mcep->num_channels);
+    if (db->join_table)
+        clv_add(&d,CLV_JOINS,db->join_table->joins,
+                db->join_table->num_joins);
+
+    /* The frames go up to the end of the last unit */
+    h.num_frames = db->sts->num_sts;
+    for (i=0; i < db->num_units; i++)
+        if (db->units[i].end > h.num_frames)
+            h.num_frames = db->units[i].end;
+    clv_set_sts(&d,&h.sts,db->sts);
+    clv_set_sts(&d,&h.mcep,db->mcep);
+    clv_add_frames(&d,&h,db);
+
+    /* Voices may bring their own duration model */
+    h.dur_cart = -1;
+    if (feat_present(v->features,"dur_cart") &&
+        feat_present(v->features,"dur_stats"))
+    {
+        h.dur_cart = clv_add_tree(&d,val_cart(feat_val(v->features,"dur_cart")));
+        ds = (const dur_stat * const *)
+            val_dur_stats(feat_val(v->features,"dur_stats"));
+        for (i=0; ds[i]; i++)
+        {
+            dr.phone = clv_add_string(&d,ds[i]->phone);
+            dr.mean = ds[i]->mean;
+            dr.stddev = ds[i]->stddev;
+            clv_add(&d,CLV_DUR_STATS,&dr,1);
+        }
+    }
+
+    offset = sizeof(clv_header);
+    for (i=0; i < CLV_NUM_SECTIONS; i++)
+    {
+        offset = (offset + CLV_ALIGN - 1) & ~(CLV_ALIGN - 1);
+        h.sections[i].offset = offset;
+        h.sections[i].count = d.sections[i].size / clv_record_size[i];
+        offset += d.sections[i].size;
+    }
+
+    if (!d.error &&
+        ((fd = cst_fopen(filename,CST_OPEN_WRITE|CST_OPEN_BINARY)) != NULL))
+    {
+        cst_fwrite(fd,&h,sizeof(h),1);
+        offset = sizeof(clv_header);
+        for (i=0; i < CLV_NUM_SECTIONS; i++)
+        {
+            cst_fwrite(fd,pad,1,h.sections[i].offset - offset);
+            cst_fwrite(fd,d.sections[i].mem,1,d.sections[i].size);
+            offset = h.sections[i].offset + d.sections[i].size;
+        }
+        cst_fclose(fd);
+    }
+    else if (!d.error)
+    {
+        cst_errmsg("clunits dump: can't open %s\n",filename);
+        d.error = TRUE;
+    }
+
+    for (i=0; i < CLV_NUM_SECTIONS; i++)
+        cst_free(d.sections[i].mem);
+    cst_free(d.val_keys);
+    cst_free(d.val_index);
+
+    return d.error ? 0 : 1;
+}
+
+/* Loading */
+
+#define CLV_SECTION(H,S,TYPE) \
+    ((const TYPE *)((const char *)(H) + (H)->sections[S].offset))
+
+static const char *clv_string(const clv_header *h, int s)
+{
+    if (s == -1)
+        return NULL;
+    return CLV_SECTION(h,CLV_STRINGS,char) + s;
+}
+
+#define CLV_BAD_STRING(H,S) \
+    (((S) < -1) || ((S) >= (H)->sections[CLV_STRINGS].count))
+
+static int clv_check(const clv_header *h, size_t mapsize)
+{
+    /* Make sure everything points inside the file, this is one pass */
+    /* over the indexes, the frames and residuals aren't touched     */
+    const clv_node *nodes;
+    const clv_tree *trees;
+    const clv_val *vals;
+    const clv_type *types;
+    const cst_clunit *units;
+    const unsigned int *resoffs;
+    const int *ints;
+    const clv_dur_stat *ds;
+    size_t mcep_size;
+    int i, j;
+
+    for (i=0; i < CLV_NUM_SECTIONS; i++)
+    {
+        if ((h->record_size[i] != clv_record_size[i]) ||
+            (h->sections[i].count < 0) ||
+            ((h->sections[i].offset % CLV_ALIGN) != 0) ||
+            ((size_t)h->sections[i].offset +
+             ((size_t)h->sections[i].count * clv_record_size[i]) > mapsize))
+            return FALSE;
+    }
+    /* Sizes are multiplied as size_t, so they can't overflow */
+    if ((h->num_frames < 0) || (h->sts.num_channels < 0) ||
+        (h->mcep.num_channels < 0))
+        return FALSE;
+    if ((h->sections[CLV_TYPES].count != h->num_types) ||
+        (h->sections[CLV_UNITS].count != h->num_units) ||
+        (h->sections[CLV_TREES].count < h->num_types) ||
+        ((size_t)h->sections[CLV_STS_RESOFFS].count !=
+         (size_t)h->num_frames + 1) ||
+        ((size_t)h->sections[CLV_STS_FRAMES].count !=
+         (size_t)h->num_frames * (size_t)h->sts.num_channels) ||
+        (h->sections[CLV_STRINGS].count == 0) ||
+        (CLV_SECTION(h,CLV_STRINGS,char)[h->sections[CLV_STRINGS].count-1]
+         != '\0') ||
+        (h->dur_cart < -1) ||
+        (h->dur_cart >= h->sections[CLV_TREES].count) ||
+        CLV_BAD_STRING(h,h->name) ||
+        CLV_BAD_STRING(h,h->sts.codec) || CLV_BAD_STRING(h,h->mcep.codec))
+        return FALSE;
+    if ((h->sections[CLV_JOIN_WEIGHTS].count != 0) &&
+        (h->sections[CLV_JOIN_WEIGHTS].count < h->mcep.num_channels))
+        return FALSE;
+    mcep_size = (size_t)h->num_frames * (size_t)h->mcep.num_channels;
+    if (h->mcep.bytes)
+        mcep_size = (mcep_size + 1) / 2;
+    if ((size_t)h->sections[CLV_MCEP_FRAMES].count != mcep_size)
+        return FALSE;
+
+    types = CLV_SECTION(h,CLV_TYPES,clv_type);
+    for (i=0; i < h->num_types; i++)
+        if (CLV_BAD_STRING(h,types[i].name) || (types[i].start < 0) ||
+            (types[i].start + types[i].count > h->num_units))
+            return FALSE;
+    units = CLV_SECTION(h,CLV_UNITS,cst_clunit);
+    for (i=0; i < h->num_units; i++)
+        if ((units[i].type >= h->num_types) || (units[i].start < 0) ||
+            (units[i].start > units[i].end) ||
+            (units[i].end > h->num_frames) ||
+            ((units[i].prev != CLUNIT_NONE) && 
+             ((units[i].prev < 0) || (units[i].prev >= h->num_units))) ||
+            ((units[i].next != CLUNIT_NONE) && 
+             ((units[i].next < 0) || (units[i].next >= h->num_units))))
+            return FALSE;
+    resoffs = CLV_SECTION(h,CLV_STS_RESOFFS,unsigned int);
+    for (i=0; i < h->num_frames; i++)
+        if (resoffs[i] > resoffs[i+1])
+            return FALSE;
+    if (resoffs[h->num_frames] > (unsigned int)h->sections[CLV_STS_RESIDUALS].count)
+        return FALSE;
+    ints = CLV_SECTION(h,CLV_FEATURES,int);
+    for (i=0; i < 2*h->sections[CLV_FEATURES].count; i++)
+        if ((ints[i] == -1) || CLV_BAD_STRING(h,ints[i]))
+            return FALSE;
+    ints = CLV_SECTION(h,CLV_TREE_FEATS,int);
+    for (i=0; i < h->sections[CLV_TREE_FEATS].count; i++)
+        if (CLV_BAD_STRING(h,ints[i]))
+            return FALSE;
+    ds = CLV_SECTION(h,CLV_DUR_STATS,clv_dur_stat);
+    for (i=0; i < h->sections[CLV_DUR_STATS].count; i++)
+        if (CLV_BAD_STRING(h,ds[i].phone))
+            return FALSE;
+
+    trees = CLV_SECTION(h,CLV_TREES,clv_tree);
+    nodes = CLV_SECTION(h,CLV_NODES,clv_node);
+    for (i=0; i < h->sections[CLV_TREES].count; i++)
+    {
+        if ((trees[i].first_node < 0) || (trees[i].first_feat < 0) ||
+            (trees[i].num_nodes < 1) || (trees[i].num_feats < 0) ||
+            (trees[i].first_node + trees[i].num_nodes >
+             h->sections[CLV_NODES].count) ||
+            (trees[i].first_feat + trees[i].num_feats >
+             h->sections[CLV_TREE_FEATS].count))
+            return FALSE;
+        /* Questions must name one of this tree's feats, and both */
+        /* answers (the next node and no_node) be in this tree    */
+        for (j=0; j < trees[i].num_nodes; j++)
+            if ((nodes[trees[i].first_node+j].op != CST_CART_OP_LEAF) &&
+                ((nodes[trees[i].first_node+j].feat >= trees[i].num_feats) ||
+                 (j+1 >= trees[i].num_nodes) ||
+                 (nodes[trees[i].first_node+j].no_node >=
+                  trees[i].num_nodes)))
+                return FALSE;
+    }
+    for (i=0; i < h->sections[CLV_NODES].count; i++)
+        if ((nodes[i].val < 0) ||
+            (nodes[i].val >= h->sections[CLV_VALS].count))
+            return FALSE;
+    vals = CLV_SECTION(h,CLV_VALS,clv_val);
+    for (i=0; i < h->sections[CLV_VALS].count; i++)
+    {
+        if ((vals[i].type == CST_VAL_TYPE_CONS) &&
+            ((vals[i].ival < -1) || (vals[i].cdr < -1) ||
+             (vals[i].ival >= h->sections[CLV_VALS].count) ||
+             (vals[i].cdr >= h->sections[CLV_VALS].count)))
+            return FALSE;
+        if ((vals[i].type == CST_VAL_TYPE_STRING) &&
+            CLV_BAD_STRING(h,vals[i].ival))
+            return FALSE;
+        if ((vals[i].type != CST_VAL_TYPE_CONS) &&
+            (vals[i].type != CST_VAL_TYPE_INT) &&
+            (vals[i].type != CST_VAL_TYPE_FLOAT) &&
+            (vals[i].type != CST_VAL_TYPE_STRING))
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+static void clv_load_vals(clv_voxfile *vf, const clv_header *h)
+{
+    const clv_val *r = CLV_SECTION(h,CLV_VALS,clv_val);
+    cst_val *v;
+    int i, n;
+
+    /* These are constant vals (ref_count -1), like compiled in ones */
+    n = h->sections[CLV_VALS].count;
+    vf->vals = cst_alloc(cst_val,n);
+    for (i=0; i < n; i++)
+    {
+        v = &vf->vals[i];
+        if (r[i].type == CST_VAL_TYPE_CONS)
+        {
+            v->c.cc.car = (r[i].ival == -1) ? NULL : &vf->vals[r[i].ival];
+            v->c.cc.cdr = (r[i].cdr == -1) ? NULL : &vf->vals[r[i].cdr];
+            continue;
+        }
+        v->c.a.type = r[i].type;
+        v->c.a.ref_count = -1;
+        if (r[i].type == CST_VAL_TYPE_INT)
+            v->c.a.v.ival = r[i].ival;
+        else if (r[i].type == CST_VAL_TYPE_FLOAT)
+            v->c.a.v.fval = r[i].fval;
+        else
+            v->c.a.v.vval = (void *)clv_string(h,r[i].ival);
+    }
+}
+
+static void clv_load_trees(clv_voxfile *vf, const clv_header *h)
+{
+    const clv_tree *t = CLV_SECTION(h,CLV_TREES,clv_tree);
+    const clv_node *n = CLV_SECTION(h,CLV_NODES,clv_node);
+    const int *f = CLV_SECTION(h,CLV_TREE_FEATS,int);
+    int num_trees = h->sections[CLV_TREES].count;
+    int i, j, k;
+
+    /* Each tree's nodes and feats are followed by a terminator */
+    vf->nodes = cst_alloc(cst_cart_node,h->sections[CLV_NODES].count+num_trees);
+    vf->feats = cst_alloc(const char *,h->sections[CLV_TREE_FEATS].count+num_trees);
+    vf->carts = cst_alloc(cst_cart,num_trees);
+    vf->trees = cst_alloc(const cst_cart *,num_trees+1);
+
+    for (i=0; i < num_trees; i++)
+    {
+        k = t[i].first_node + i;
+        vf->carts[i].rule_table = &vf->nodes[k];
+        for (j=0; j < t[i].num_nodes; j++,k++)
+        {
+            vf->nodes[k].feat = n[t[i].first_node+j].feat;
+            vf->nodes[k].op = n[t[i].first_node+j].op;
+            vf->nodes[k].no_node = n[t[i].first_node+j].no_node;
+            vf->nodes[k].val = &vf->vals[n[t[i].first_node+j].val];
+        }
+        k = t[i].first_feat + i;
+        vf->carts[i].feat_table = &vf->feats[k];
+        for (j=0; j < t[i].num_feats; j++,k++)
+            vf->feats[k] = clv_string(h,f[t[i].first_feat+j]);
+        vf->trees[i] = &vf->carts[i];
+    }
+}
+
+static void clv_load_sts(cst_sts_list *s, const clv_sts *h,
+                         const clv_header *hd)
+{
+    s->num_sts = hd->num_frames;
+    s->num_channels = h->num_channels;
+    s->sample_rate = h->sample_rate;
+    s->coeff_min = h->coeff_min;
+    s->coeff_range = h->coeff_range;
+    s->codec = clv_string(hd,h->codec);
+}
+
+static clv_voxfile *clv_load_db(cst_filemap *map)
+{
+    const clv_header *h = (const clv_header *)map->mem;
+    const clv_type *t;
+    const clv_dur_stat *ds;
+    clv_voxfile *vf;
+    cst_clunit_db *db;
+    int i;
+
+    vf = cst_alloc(clv_voxfile,1);
+    vf->map = map;
+    db = &vf->db;
+
+    db->name = clv_string(h,h->name);
+    db->num_types = h->num_types;
+    db->num_units = h->num_units;
+    db->optimal_coupling = h->optimal_coupling;
+    db->extend_selections = h->extend_selections;
+    db->f0_weight = h->f0_weight;
+
+    t = CLV_SECTION(h,CLV_TYPES,clv_type);
+    vf->types = cst_alloc(cst_clunit_type,h->num_types);
+    for (i=0; i < h->num_types; i++)
+    {
+        vf->types[i].name = clv_string(h,t[i].name);
+        vf->types[i].start = t[i].start;
+        vf->types[i].count = t[i].count;
+    }
+    db->types = vf->types;
+    db->units = CLV_SECTION(h,CLV_UNITS,cst_clunit);
+
+    clv_load_vals(vf,h);
+    clv_load_trees(vf,h);
+    db->trees = vf->trees;
+
+    if (h->sections[CLV_JOIN_WEIGHTS].count > 0)
+        db->join_weights = CLV_SECTION(h,CLV_JOIN_WEIGHTS,int);
+    if (h->sections[CLV_JOINS].count > 0)
+    {
+        vf->join_table.num_joins = h->sections[CLV_JOINS].count;
+        vf->join_table.joins = CLV_SECTION(h,CLV_JOINS,cst_clunit_join);
+        db->join_table = &vf->join_table;
+    }
+
+    clv_load_sts(&vf->sts,&h->sts,h);
+    vf->sts.frames = CLV_SECTION(h,CLV_STS_FRAMES,unsigned short);
+    vf->sts.resoffs = CLV_SECTION(h,CLV_STS_RESOFFS,unsigned int);
+    vf->sts.residuals = CLV_SECTION(h,CLV_STS_RESIDUALS,unsigned char);
+    vf->sts.ressizes = CLV_SECTION(h,CLV_STS_RESSIZES,unsigned char);
+    db->sts = &vf->sts;
+    clv_load_sts(&vf->mcep,&h->mcep,h);
+    if (h->mcep.bytes)
+        vf->mcep.residuals = CLV_SECTION(h,CLV_MCEP_FRAMES,unsigned char);
+    else
+        vf->mcep.frames = CLV_SECTION(h,CLV_MCEP_FRAMES,unsigned short);
+    db->mcep = &vf->mcep;
+
+    if (h->dur_cart != -1)
+    {
+        ds = CLV_SECTION(h,CLV_DUR_STATS,clv_dur_stat);
+        vf->dur_stats = cst_alloc(dur_stat,h->sections[CLV_DUR_STATS].count);
+        vf->dur_stat_list = 
+            cst_alloc(const dur_stat *,h->sections[CLV_DUR_STATS].count+1);
+        for (i=0; i < h->sections[CLV_DUR_STATS].count; i++)
+        {
+            vf->dur_stats[i].phone = clv_string(h,ds[i].phone);
+            vf->dur_stats[i].mean = ds[i].mean;
+            vf->dur_stats[i].stddev = ds[i].stddev;
+            vf->dur_stat_list[i] = &vf->dur_stats[i];
+        }
+    }
+
+    return vf;
+}
+
+cst_voice *cst_clunits_load_voice(const char *filename,
+                                  const cst_lang lang_table[])
+{
+    cst_filemap *map;
+    const clv_header *h;
+    const int *f;
+    clv_voxfile *vf;
+    cst_voice *vox;
+    cst_lexicon *lex;
+    cst_val *secondary_langs;
+    const cst_val *sc;
+    const char *language;
+    cst_file fd;
+    char magic[sizeof(h->magic)];
+    int i, n;
+
+    /* Quietly give up if this isn't a clunits voice file at all, it */
+    /* must be a local file and cst_mmap_file() complains otherwise  */
+    if (cst_urlp(filename) ||
+        ((fd = cst_fopen(filename,CST_OPEN_READ|CST_OPEN_BINARY)) == NULL))
+        return NULL;
+    n = cst_fread(fd,magic,sizeof(char),sizeof(magic));
+    cst_fclose(fd);
+    if ((n != sizeof(magic)) ||
+        (strncmp(magic,clunits_voice_header_string,sizeof(magic)) != 0))
+        return NULL;
+
+    map = cst_mmap_file(filename);
+    if (map == NULL)
+        return NULL;
+    h = (const clv_header *)map->mem;
+    if ((map->mapsize < sizeof(clv_header)) ||
+        (strncmp(h->magic,clunits_voice_header_string,sizeof(h->magic)) != 0))
+    {
+        cst_munmap_file(map);
+        return NULL;
+    }
+
+    if (h->endian != cst_endian_loc)
+    {
+        cst_errmsg("Error load voice: %s was dumped with other byte order\n",
+                   filename);
+        cst_munmap_file(map);
+        return NULL;
+    }
+    if (!clv_check(h,map->mapsize))
+    {
+        cst_errmsg("Error load voice: %s is corrupt or from another platform\n",
+                   filename);
+        cst_munmap_file(map);
+        return NULL;
+    }
+
+    vf = clv_load_db(map);
+    vox = new_voice();
+
+    /* The names and values live in the map, which lives with the voice */
+    f = CLV_SECTION(h,CLV_FEATURES,int);
+    for (i=0; i < h->sections[CLV_FEATURES].count; i++)
+        flite_feat_set_string(vox->features,
+                              clv_string(h,f[2*i]),clv_string(h,f[2*i+1]));
+
+    language = flite_get_param_string(vox->features,"language","eng");
+    secondary_langs = 
+        val_readlist_string(flite_get_param_string(vox->features,
+                                                   "secondary_languages",""));
+    for (sc = secondary_langs; sc; sc=val_cdr(sc))
+        cg_init_lang_lex(vox,lang_table,val_string(val_car(sc)));
+    delete_val(secondary_langs);
+    lex = cg_init_lang_lex(vox,lang_table,language);
+
+    if (lex == NULL)
+    {
+        cst_errmsg("Error load voice: lang/lex %s not supported in this binary\n",
+                   language);
+        delete_voice(vox);
+        cst_clunits_free_voxfile(vf);
+        return NULL;
+    }
+
+    vox->name = vf->db.name;
+    flite_feat_set_string(vox->features,"name",vf->db.name);
+    flite_feat_set_string(vox->features,"pathname",filename);
+
+    flite_feat_set(vox->features,"lexicon",lexicon_val(lex));
+    flite_feat_set(vox->features,"postlex_func",uttfunc_val(lex->postlex));
+
+    if (vf->dur_stat_list)
+    {
+        flite_feat_set(vox->features,"dur_cart",
+                       cart_val(vf->trees[h->dur_cart]));
+        flite_feat_set(vox->features,"dur_stats",
+                       dur_stats_val((dur_stats *)vf->dur_stat_list));
+    }
+
+    /* Waveform synthesis */
+    flite_feat_set(vox->features,"wave_synth_func",uttfunc_val(&clunits_synth));
+    flite_feat_set(vox->features,"clunit_db",clunit_db_val(&vf->db));
+    flite_feat_set(vox->features,"clunit_voxfile",userdata_val(vf));
+    flite_feat_set_int(vox->features,"sample_rate",vf->sts.sample_rate);
+    if (!feat_present(vox->features,"join_type"))
+        flite_feat_set_string(vox->features,"join_type","simple_join");
+    if (!feat_present(vox->features,"resynth_type"))
+        flite_feat_set_string(vox->features,"resynth_type","fixed");
+
+    /* Unit selection, only the standard naming functions can be named */
+    if (cst_streq("ldom_phone_word",
+                  flite_get_param_string(vox->features,"clunit_unit_name","")))
+        vf->db.unit_name_func = clunits_ldom_phone_word;
+
+    return vox;
+}
+
+void cst_clunits_free_voxfile(void *v)
+{
+    /* Called from delete_voice() */
+    clv_voxfile *vf = (clv_voxfile *)v;
+
+    cst_free(vf->types);
+    cst_free(vf->carts);
+    cst_free(vf->trees);
+    cst_free(vf->nodes);
+    cst_free(vf->feats);
+    cst_free(vf->vals);
+    cst_free(vf->dur_stats);
+    cst_free(vf->dur_stat_list);
+    cst_free((void *)vf->db.join_weights16);
+    delete_clunit_join_cache(vf->db.join_cache);
+    delete_thread_pool(vf->db.workers);
+    cst_munmap_file(vf->map);
+    cst_free(vf);
+}
@@ -43,6 +43,7 @@
 #include "cst_wave.h"
 #include "cst_sigpr.h"
 #include "cst_sts.h"
+#include "cst_dsp.h"
 
 cst_wave *lpc_resynth(cst_lpcres *lpcres)
 {
@@ -187,9 +188,8 @@ cst_wave *lpc_resynth_fixedpoint(cst_lpcres *lpcres)
 {
     /* The fixed point version, without floats */
     cst_wave *w;
-    int i,j,r,o,k;
+    int i,j,r,o,k,n,v;
     int stream_mark;
-    int ci,cr;
     int *outbuf, *lpccoefs;
     int pm_size_samps, ilpc_min, ilpc_range;
     int rc = CST_AUDIO_STREAM_CONT;
@@ -198,8 +198,11 @@ cst_wave *lpc_resynth_fixedpoint(cst_lpcres *lpcres)
     w = new_wave();
     cst_wave_resize(w,lpcres->num_samples,1);
     w->sample_rate = lpcres->sample_rate;
-    /* outbuf is a circular buffer with past relevant samples in it */
-    outbuf = cst_alloc(int,1+lpcres->num_channels);
+    /* outbuf is a circular buffer with past relevant samples in it, */
+    /* newest first, and written twice so the last num_channels are   */
+    /* always contiguous from outbuf+o                                 */
+    n = 1+lpcres->num_channels;
+    outbuf = cst_alloc(int,2*n);
     /* unpacked lpc coefficients */
     lpccoefs = cst_alloc(int,lpcres->num_channels);
     ilpc_min = (int)(lpcres->lpc_min*32768.0);
@@ -207,7 +210,7 @@ cst_wave *lpc_resynth_fixedpoint(cst_lpcres *lpcres)
     ilpc_range = (int)(lpcres->lpc_range*2048.0);
 
     stream_mark = 0;
-    for (r=0,o=lpcres->num_channels,i=0; 
+    for (r=0,o=0,i=0; 
          (rc == CST_AUDIO_STREAM_CONT) && (i < lpcres->num_frames); 
          i++)
     {
@@ -229,28 +232,25 @@ cst_wave *lpc_resynth_fixedpoint(cst_lpcres *lpcres)
 	/* resynthesis the signal */
 	for (j=0; j < pm_size_samps; j++,r++)
 	{
-            outbuf[o] = (int)ulaw_to_short_table[lpcres->residual[r]];
-	    outbuf[o] *= 16384;
-	    cr = (o == 0 ? lpcres->num_channels : o-1);
-	    for (ci=0; ci < lpcres->num_channels; ci++)
-	    {
-		outbuf[o] += lpccoefs[ci]*outbuf[cr];
-		cr = (cr == 0 ? lpcres->num_channels : cr-1);
-	    }
-	    outbuf[o] /= 16384;
-	    w->samples[r] = (short)outbuf[o];
-	    o = (o == lpcres->num_channels ? 0 : o+1);
+            v = (int)ulaw_to_short_table[lpcres->residual[r]];
+	    v = (int)((unsigned int)(v*16384) +
+                      (unsigned int)cst_dsp->dot_int(lpccoefs,outbuf+o,
+                                                     lpcres->num_channels));
+	    v /= 16384;
+	    w->samples[r] = (short)v;
+	    o = (o == 0 ? n-1 : o-1);
+	    outbuf[o] = outbuf[o+n] = v;
 	}
         if (lpcres->asi && (r-stream_mark > lpcres->asi->min_buffsize))
         {
-             rc = (*lpcres->asi->asc)(w,stream_mark,r-stream_mark,0,
-                                 lpcres->asi);
+             rc = audio_stream_send(lpcres->asi,w,stream_mark,
+                                    r-stream_mark,0);
              stream_mark = r;
         }
     }
 
     if ((lpcres->asi) && (rc == CST_AUDIO_STREAM_CONT))
-        (*lpcres->asi->asc)(w,stream_mark,r-stream_mark,1,lpcres->asi);
+        audio_stream_send(lpcres->asi,w,stream_mark,r-stream_mark,1);
 
     cst_free(outbuf);
     cst_free(lpccoefs);
@@ -0,0 +1,520 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Synthesis benchmarks: fixed workloads over the built in voices,      */
+/*  reporting speed, latency and memory, optionally as JSON, and for     */
+/*  the CG voices the speed and quality of each synthesis_tier           */
+/*                                                                       */
+/*************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include "flite.h"
+#include "flite_version.h"
+
+cst_voice *register_cmu_us_slt(const char *voxdir);
+cst_voice *register_cmu_us_rms(const char *voxdir);
+cst_voice *register_cmu_us_awb(const char *voxdir);
+cst_voice *register_cmu_time_awb(const char *voxdir);
+cst_voice *register_cmu_us_kal(const char *voxdir);
+
+/* The workloads, the time ones are all time_awb (a limited domain */
+/* voice) can say                                                   */
+static const char * const bench_short[] = {
+    "Hello.",
+    "Yes, please.",
+    "Turn left in two hundred meters.",
+    "Your call is important to us.",
+    "Press one for more options.",
+    "The door is open.",
+    "Thank you!",
+    "Goodbye for now.",
+    NULL };
+static const char * const bench_paragraph[] = {
+    "The history of speech synthesis goes back much further than most "
+    "people expect.  Long before computers, inventors built machines of "
+    "bellows, reeds and leather tubes that could be played, like an "
+    "instrument, to produce recognizable vowels and even whole words.  "
+    "When electronics arrived, the vocoder showed that speech could be "
+    "described by a small number of slowly changing parameters, and that "
+    "idea, more than any particular device, shaped everything that "
+    "followed.  Later systems concatenated recorded fragments of real "
+    "speech, choosing among thousands of candidates the sequence that fit "
+    "best, while statistical systems learned to predict the parameters "
+    "directly from text.  Each approach trades naturalness, size and "
+    "speed in a different way, which is why small synthesizers are still "
+    "widely used on devices where memory and power are scarce.",
+    "It was a bright cold day in April, and the clocks were striking "
+    "thirteen.  Nobody in the square seemed to notice.  The old man by "
+    "the fountain kept feeding the pigeons, the children kept running "
+    "between the benches, and somewhere behind the market a radio "
+    "played the same song it had played all morning.",
+    NULL };
+static const char * const bench_numbers[] = {
+    "On 12/03/2021 at 14:35 we paid $1,234.56 for 3 items.",
+    "Call 412-268-3000 or 1-800-555-0199, extension 4417.",
+    "The population grew from 1,203,457 in 1990 to 2,815,000 in 2020, "
+    "an increase of 133.9%.",
+    "Flight 2231 leaves gate B12 at 6:45am and arrives at 11:20pm.",
+    "Room 101, 221B Baker St, and 1600 Pennsylvania Ave are all addresses.",
+    NULL };
+static const char * const bench_oov[] = {
+    "Zylophant brimwick quastered the flornish gobbet near Vrenchley.",
+    "Dr. Oyelaran-Kristiansen and Ms. Thorvaldsdottir met Mr. Przybylski.",
+    "The snarfulous klemptometer glibbed across the vonderplatz.",
+    "Quixotrix, Blenvaria and Skrimshaw are all fictional brands.",
+    NULL };
+static const char * const bench_ssml[] = {
+    "<speak>Hello <break size=\"medium\"/> world.  "
+    "<prosody rate=\"1.5\">This part is said slowly.</prosody>  "
+    "The <sub alias=\"World Wide Web Consortium\">W3C</sub> "
+    "wrote the standard.</speak>",
+    "<speak><prosody volume=\"0.5\">Quietly now.</prosody> "
+    "<break size=\"large\"/> And back to normal.</speak>",
+    NULL };
+static const char * const bench_time[] = {
+    "The time is now, exactly five past one, in the morning.",
+    "The time is now, just after ten past two, in the afternoon.",
+    "The time is now, a little after quarter to eight, in the evening.",
+    "The time is now, almost midnight, at night.",
+    NULL };
+
+typedef struct bench_workload_struct {
+    const char *name;
+    const char * const *texts;
+    int ssml;
+    int general;   /* needs a general voice */
+} bench_workload;
+
+static const bench_workload bench_workloads[] = {
+    { "short", bench_short, 0, 1 },
+    { "paragraph", bench_paragraph, 0, 1 },
+    { "numbers", bench_numbers, 0, 1 },
+    { "oov", bench_oov, 0, 1 },
+    { "ssml", bench_ssml, 1, 1 },
+    { "time", bench_time, 0, 0 },
+    { NULL, NULL, 0, 0 }
+};
+
+typedef struct bench_voice_struct {
+    const char *name;
+    const char *type;
+    cst_voice *(*reg)(const char *voxdir);
+    int general;   /* can say anything */
+} bench_voice;
+
+static const bench_voice bench_voices[] = {
+    { "slt", "cg", register_cmu_us_slt, 1 },
+    { "rms", "cg", register_cmu_us_rms, 1 },
+    { "awb", "cg", register_cmu_us_awb, 1 },
+    { "time_awb", "clunits", register_cmu_time_awb, 0 },
+    { "kal", "diphone", register_cmu_us_kal, 1 },
+    { NULL, NULL, NULL, 0 }
+};
+
+/* What we find out about one voice on one workload */
+typedef struct bench_result_struct {
+    const char *tier;      /* synthesis_tier, NULL if not set */
+    float distance;        /* from the quality tier in dB, -1 if unknown */
+    int utts;
+    double audio;          /* seconds */
+    double wall;
+    double first_sample;   /* total latency to first sample */
+    int num_calls;
+    long peak_rss;         /* kB, of the process that ran just this */
+    int alloc_stats;       /* allocations were counted */
+    cst_synth_stats stats;
+} bench_result;
+
+typedef struct bench_call_struct {
+    double start;
+    double first;
+} bench_call;
+
+static double bench_time_now(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv,NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec/1000000.0;
+}
+
+static long bench_peak_rss(void)
+{
+    /* ru_maxrss never goes down, so each workload is run in a child */
+    /* of its own (see bench_fork()) for this to be just its peak    */
+    struct rusage ru;
+
+    getrusage(RUSAGE_SELF,&ru);
+#ifdef __APPLE__
+    return ru.ru_maxrss/1024;  /* bytes there */
+#else
+    return ru.ru_maxrss;
+#endif
+}
+
+static int bench_stream(const cst_wave *w, int start, int size,
+                        int last, cst_audio_streaming_info *asi)
+{
+    bench_call *c = (bench_call *)asi->userdata;
+
+    if (c->first == 0.0)
+        c->first = bench_time_now();
+    return CST_AUDIO_STREAM_CONT;
+}
+
+static float bench_say(cst_voice *v, const char *text, int ssml)
+{
+    /* Non-ssml text goes through the same path as files, so paragraphs */
+    /* are split into utterances                                        */
+    if (ssml)
+        return flite_ssml_text_to_speech(text,v,"none");
+    return flite_ts_to_speech(ts_open_string(text,
+          get_param_string(v->features,"text_whitespace",NULL),
+          get_param_string(v->features,"text_singlecharsymbols",NULL),
+          get_param_string(v->features,"text_prepunctuation",NULL),
+          get_param_string(v->features,"text_postpunctuation",NULL)),
+                              v,"none");
+}
+
+static int alloc_stats = FALSE;
+
+static void bench_run(cst_voice *v, const bench_workload *wl, int iterations,
+                      bench_result *r)
+{
+    cst_audio_streaming_info *asi;
+    bench_call call;
+    double start;
+    int i, j;
+
+    asi = new_audio_streaming_info();
+    asi->asc = bench_stream;
+    asi->userdata = &call;
+    feat_set(v->features,"streaming_info",audio_streaming_info_val(asi));
+
+    /* once through so lazy set up isn't counted */
+    for (j=0; wl->texts[j]; j++)
+        bench_say(v,wl->texts[j],wl->ssml);
+
+    memset(r,0,sizeof(*r));
+    cst_synth_stats_reset();
+    start = bench_time_now();
+    for (i=0; i<iterations; i++)
+        for (j=0; wl->texts[j]; j++)
+        {
+            call.start = bench_time_now();
+            call.first = 0.0;
+            r->audio += bench_say(v,wl->texts[j],wl->ssml);
+            if (call.first > 0.0)
+                r->first_sample += call.first - call.start;
+            r->num_calls++;
+        }
+    r->wall = bench_time_now() - start;
+    r->peak_rss = bench_peak_rss();
+    cst_synth_stats_totals(&r->stats);
+    r->utts = r->stats.num_utts;
+    r->alloc_stats = alloc_stats;
+
+    feat_remove(v->features,"streaming_info");
+}
+
+static float bench_tier_distance(cst_voice *v, const bench_workload *wl,
+                                 const char *tier)
+{
+    /* Mean log spectral distance of the workload said in tier from it */
+    /* said in the quality tier, the durations don't change with tier  */
+    cst_wave *q, *w;
+    float d, sum = 0.0;
+    int j, n = 0;
+
+    if (wl->ssml)
+        return -1.0;
+    for (j=0; wl->texts[j]; j++)
+    {
+        feat_set_string(v->features,"synthesis_tier","quality");
+        q = flite_text_to_wave(wl->texts[j],v);
+        feat_set_string(v->features,"synthesis_tier",tier);
+        w = flite_text_to_wave(wl->texts[j],v);
+        d = cst_wave_spectral_distance(q,w);
+        if (d >= 0.0)
+        {
+            sum += d;
+            n++;
+        }
+        delete_wave(q);
+        delete_wave(w);
+    }
+
+    return (n > 0 ? sum/n : -1.0);
+}
+
+static void bench_json(FILE *fd, const bench_voice *bv,
+                       const bench_workload *wl, const bench_result *r,
+                       int first)
+{
+    int i;
+    int utts = (r->utts > 0 ? r->utts : 1);
+
+    fprintf(fd,"%s    {\"voice\": \"%s\", \"type\": \"%s\", "
+            "\"workload\": \"%s\",\n",
+            (first ? "" : ",\n"),bv->name,bv->type,wl->name);
+    if (r->tier)
+    {
+        fprintf(fd,"     \"tier\": \"%s\", ",r->tier);
+        if (r->distance >= 0.0)
+            fprintf(fd,"\"spectral_distance_db\": %.4f,\n",r->distance);
+        else
+            fprintf(fd,"\"spectral_distance_db\": null,\n");
+    }
+    fprintf(fd,"     \"utterances\": %d, \"audio_seconds\": %.4f, "
+            "\"wall_seconds\": %.4f,\n",r->utts,r->audio,r->wall);
+    fprintf(fd,"     \"xrt\": %.3f, \"utts_per_sec\": %.3f, "
+            "\"ttfs_ms\": %.3f,\n",
+            (r->wall > 0.0 ? r->audio/r->wall : 0.0),
+            (r->wall > 0.0 ? r->utts/r->wall : 0.0),
+            (r->num_calls > 0 ? 1000.0*r->first_sample/r->num_calls : 0.0));
+    fprintf(fd,"     \"peak_rss_kb\": %ld, ",r->peak_rss);
+    if (r->alloc_stats)
+        fprintf(fd,"\"allocs_per_utt\": %.1f, \"alloc_bytes_per_utt\": %.0f,\n",
+                r->stats.counts[CST_STAT_ALLOCS]/utts,
+                r->stats.counts[CST_STAT_ALLOC_BYTES]/utts);
+    else
+        fprintf(fd,"\"allocs_per_utt\": null, \"alloc_bytes_per_utt\": null,\n");
+    fprintf(fd,"     \"stages_ms_per_utt\": {");
+    for (i=0; i<r->stats.num_modules; i++)
+        fprintf(fd,"%s\"%s\": %.4f",(i ? ", " : ""),
+                r->stats.modules[i].name,
+                1000.0*r->stats.modules[i].wall/utts);
+    fprintf(fd,"},\n     \"counts_per_utt\": {");
+    fprintf(fd,"\"cart_evals\": %.2f, \"lex_lookups\": %.2f, "
+            "\"lex_lts\": %.2f}}",
+            r->stats.counts[CST_STAT_CART_EVALS]/utts,
+            r->stats.counts[CST_STAT_LEX_LOOKUPS]/utts,
+            r->stats.counts[CST_STAT_LEX_LTS]/utts);
+}
+
+static void bench_one(const bench_voice *bv, cst_voice *v,
+                      const bench_workload *wl, int iterations,
+                      const char *tier, int show_tiers, FILE *jfd,
+                      int first)
+{
+    /* Run wl, and give its line of results (and JSON) */
+    bench_result r;
+
+    bench_run(v,wl,iterations,&r);
+    r.tier = NULL;
+    r.distance = -1.0;
+    printf("%-9s %-10s ",bv->name,wl->name);
+    if (show_tiers)
+    {
+        if (tier)
+        {
+            r.tier = tier;
+            r.distance = bench_tier_distance(v,wl,r.tier);
+            feat_set_string(v->features,"synthesis_tier",r.tier);
+        }
+        printf("%-8s ",(r.tier ? r.tier : "-"));
+        if (r.distance >= 0.0)
+            printf("%7.3f ",r.distance);
+        else
+            printf("%7s ","-");
+    }
+    printf("%6d %8.2f %8.2f %9.2f %9.2f %8ld %8.0f\n",
+           r.utts,r.audio,
+           (r.wall > 0.0 ? r.audio/r.wall : 0.0),
+           (r.wall > 0.0 ? r.utts/r.wall : 0.0),
+           (r.num_calls > 0 ?
+            1000.0*r.first_sample/r.num_calls : 0.0),
+           r.peak_rss,
+           (r.utts > 0 ?
+            r.stats.counts[CST_STAT_ALLOCS]/r.utts : 0.0));
+    if (jfd)
+        bench_json(jfd,bv,wl,&r,first);
+}
+
+static int bench_fork(const bench_voice *bv, cst_voice *v,
+                      const bench_workload *wl, int iterations,
+                      const char *tier, int show_tiers, FILE *jfd,
+                      int first)
+{
+    /* bench_one() in a child process, so its peak RSS is its own, */
+    /* TRUE if it wrote its results                                */
+    pid_t pid;
+    int status;
+
+    fflush(stdout);
+    if (jfd)
+        fflush(jfd);
+    if ((pid = fork()) < 0)
+    {   /* can't, so the RSS will be the peak so far */
+        bench_one(bv,v,wl,iterations,tier,show_tiers,jfd,first);
+        return TRUE;
+    }
+    if (pid == 0)
+    {
+        bench_one(bv,v,wl,iterations,tier,show_tiers,jfd,first);
+        fflush(stdout);
+        if (jfd)
+            fflush(jfd);
+        _exit(0);
+    }
+    if ((waitpid(pid,&status,0) != pid) ||
+        !WIFEXITED(status) || (WEXITSTATUS(status) != 0))
+    {
+        fprintf(stderr,"bench: %s %s failed\n",bv->name,wl->name);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+static int bench_selected(const char *name, char **names, int num_names)
+{
+    int i;
+
+    if (num_names == 0)
+        return TRUE;
+    for (i=0; i<num_names; i++)
+        if (cst_streq(name,names[i]))
+            return TRUE;
+    return FALSE;
+}
+
+static void bench_usage(void)
+{
+    printf("bench: synthesis benchmarks\n"
+           "  -voice NAME     only this voice (slt rms awb time_awb kal),\n"
+           "                  may be repeated\n"
+           "  -workload NAME  only this workload (short paragraph numbers\n"
+           "                  oov ssml time), may be repeated\n"
+           "  -iter N         times round each workload (default 3)\n"
+           "  -tier NAME      run the CG voices with this synthesis_tier\n"
+           "                  (quality balanced fast) and give its log\n"
+           "                  spectral distance from quality, may be repeated\n"
+           "  -json FILE      also write the results as JSON to FILE\n");
+    exit(0);
+}
+
+int main(int argc, char **argv)
+{
+    char *voice_names[16], *workload_names[16], *tier_names[16];
+    int num_voices = 0, num_workloads = 0, num_tiers = 0;
+    int iterations = 3;
+    const char *jsonfile = NULL;
+    FILE *jfd = NULL;
+    const bench_voice *bv;
+    const bench_workload *wl;
+    cst_voice *v;
+    int i, t, tiered, first = TRUE;
+
+    /* before anything is allocated */
+    alloc_stats = cst_alloc_stats_enable();
+
+    for (i=1; i<argc; i++)
+    {
+        if (cst_streq(argv[i],"-voice") && (i+1 < argc) && (num_voices < 16))
+            voice_names[num_voices++] = argv[++i];
+        else if (cst_streq(argv[i],"-workload") && (i+1 < argc) &&
+                 (num_workloads < 16))
+            workload_names[num_workloads++] = argv[++i];
+        else if (cst_streq(argv[i],"-tier") && (i+1 < argc) &&
+                 (num_tiers < 16))
+            tier_names[num_tiers++] = argv[++i];
+        else if (cst_streq(argv[i],"-iter") && (i+1 < argc))
+            iterations = atoi(argv[++i]);
+        else if (cst_streq(argv[i],"-json") && (i+1 < argc))
+            jsonfile = argv[++i];
+        else
+            bench_usage();
+    }
+
+    if (jsonfile)
+    {
+        if ((jfd = fopen(jsonfile,"w")) == NULL)
+        {
+            fprintf(stderr,"bench: can't open %s\n",jsonfile);
+            return 1;
+        }
+        fprintf(jfd,"{\"flite_version\": \"%s\", \"iterations\": %d,\n"
+                " \"results\": [\n",FLITE_PROJECT_VERSION,iterations);
+    }
+
+    flite_init();
+    cst_synth_stats_enable(TRUE);
+
+    printf("%-9s %-10s ","voice","workload");
+    if (num_tiers > 0)
+        printf("%-8s %7s ","tier","dist dB");
+    printf("%6s %8s %8s %9s %9s %8s %8s\n",
+           "utts","audio s","xRT","utts/s","ttfs ms","rss kB","allocs/u");
+    for (bv=bench_voices; bv->name; bv++)
+    {
+        if (!bench_selected(bv->name,voice_names,num_voices))
+            continue;
+        v = (bv->reg)(NULL);
+        for (wl=bench_workloads; wl->name; wl++)
+        {
+            if (!bench_selected(wl->name,workload_names,num_workloads) ||
+                (wl->general && !bv->general))
+                continue;
+            /* Only the CG voices have tiers */
+            tiered = cst_streq(bv->type,"cg") && (num_tiers > 0);
+            for (t=0; t < (tiered ? num_tiers : 1); t++)
+            {
+                if (tiered)
+                    feat_set_string(v->features,"synthesis_tier",
+                                    tier_names[t]);
+                if (bench_fork(bv,v,wl,iterations,
+                               (tiered ? tier_names[t] : NULL),
+                               (num_tiers > 0),jfd,first))
+                    first = FALSE;
+            }
+        }
+        feat_remove(v->features,"synthesis_tier");
+    }
+
+    if (jfd)
+    {
+        fprintf(jfd,"\n ]}\n");
+        fclose(jfd);
+    }
+
+    return 0;
+}
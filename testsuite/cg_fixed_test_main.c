@@ -0,0 +1,205 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Check the fixed point CG vocoder against the float one, on made up   */
+/*  parameters                                                           */
+/*                                                                       */
+/*************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "cst_cg.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define CGFX_ORDER 48
+#define CGFX_BANDS 5
+#define CGFX_MCEPS 25
+
+/* Largest mean log spectral distance (dB) allowed from the float path */
+#define CGFX_MAX_DISTANCE 0.5
+/* and smallest signal to difference ratio (dB) when the noise is the */
+/* same, pulses may be a sample out after a long time voiced           */
+#define CGFX_MIN_SNR 30.0
+
+static double cgfx_filters[CGFX_BANDS][CGFX_ORDER];
+static const double *cgfx_h[CGFX_BANDS];
+
+static void cgfx_make_filters(void)
+{
+    /* Hamming windowed band passes that add up to (about) an impulse, */
+    /* like a voice's mixed excitation filters                          */
+    static const double edges[CGFX_BANDS+1] =
+        { 0.0, 1000.0, 2000.0, 4000.0, 6000.0, 8000.0 };
+    double t, w, lo, hi;
+    int i, j;
+
+    for (j=0; j<CGFX_BANDS; j++)
+    {
+        lo = edges[j]/16000.0;
+        hi = edges[j+1]/16000.0;
+        for (i=0; i<CGFX_ORDER; i++)
+        {
+            t = i - (CGFX_ORDER-1)/2.0;
+            w = 0.54 - 0.46*cos(2*M_PI*i/(CGFX_ORDER-1));
+            cgfx_filters[j][i] = w *
+                (sin(2*M_PI*hi*t) - sin(2*M_PI*lo*t)) / (M_PI*t);
+        }
+        cgfx_h[j] = cgfx_filters[j];
+    }
+}
+
+static void cgfx_make_tracks(cst_track *params, cst_track *str,
+                             int num_frames, int voiced_only)
+{
+    /* f0 and mceps that move about, with unvoiced stretches unless */
+    /* voiced_only                                                  */
+    int t, i;
+
+    cst_track_resize(params,num_frames,CGFX_MCEPS+1);
+    cst_track_resize(str,num_frames,CGFX_BANDS);
+    for (t=0; t<num_frames; t++)
+    {
+        params->times[t] = t*0.005;
+        if (voiced_only || ((t/40)%3))
+            params->frames[t][0] = 120.0 + 40.0*sin(t*0.03);
+        else
+            params->frames[t][0] = 0.0;
+        params->frames[t][1] = 5.5 + sin(t*0.01);  /* not clipped */
+        for (i=1; i<CGFX_MCEPS; i++)
+            params->frames[t][i+1] = 0.3*sin(t*0.02*(i+1)+i)/(i+1);
+        for (i=0; i<CGFX_BANDS; i++)
+            str->frames[t][i] = (params->frames[t][0] > 0.0) ?
+                0.5+0.5*sin(t*0.05+i) : 0.1*i;
+    }
+}
+
+static cst_wave *cgfx_synth(const cst_track *params, const cst_track *str,
+                            cst_cg_db *cg_db, const char *tier_name,
+                            int fixed_point)
+{
+    cst_features *f;
+    cst_cg_tier tier;
+    cst_mlsa *m;
+    cst_wave *w;
+
+    f = new_features();
+    feat_set_string(f,"synthesis_tier",tier_name);
+    if (fixed_point)
+        feat_set_string(f,"resynth_type","fixed");
+    cg_get_tier(f,&tier);
+    delete_features(f);
+
+    m = new_mlsa(params,cg_db,&tier);
+    mlsa_synth_frames(m,params,str,0,params->num_frames,NULL);
+    w = mlsa_finish(m,NULL);
+
+    return w;
+}
+
+static int cgfx_compare(const char *name, const cst_track *params,
+                        const cst_track *str, cst_cg_db *cg_db,
+                        const char *tier_name)
+{
+    cst_wave *a, *b;
+    double sig = 0.0, err = 0.0, d, snr;
+    float distance;
+    int i, fail;
+
+    a = cgfx_synth(params,str,cg_db,tier_name,0);
+    b = cgfx_synth(params,str,cg_db,tier_name,1);
+
+    for (i=0; i<a->num_samples; i++)
+    {
+        d = a->samples[i] - b->samples[i];
+        sig += (double)a->samples[i]*a->samples[i];
+        err += d*d;
+    }
+    snr = (err > 0.0) ? 10.0*log10(sig/err) : 99.9;
+    distance = cst_wave_spectral_distance(a,b);
+
+    fail = (a->num_samples != b->num_samples) ||
+        (distance < 0) || (distance > CGFX_MAX_DISTANCE) ||
+        (str && (snr < CGFX_MIN_SNR));
+    printf("%s %s: %d samples, snr %.1f dB, spectral distance %.3f dB: %s\n",
+           name,tier_name,a->num_samples,snr,distance,
+           (fail ? "FAILED" : "ok"));
+
+    delete_wave(a);
+    delete_wave(b);
+
+    return fail;
+}
+
+int main(int argc, char **argv)
+{
+    cst_cg_db cg_db;
+    cst_track *params, *str;
+    int fails = 0;
+
+    cgfx_make_filters();
+    memset(&cg_db,0,sizeof(cg_db));
+    cg_db.sample_rate = 16000;
+    cg_db.mlsa_alpha = 0.42;
+    cg_db.mlsa_beta = 0.4;
+    cg_db.gain = 1.5;
+    cg_db.ME_num = CGFX_BANDS;
+    cg_db.ME_order = CGFX_ORDER;
+    cg_db.me_h = cgfx_h;
+
+    params = new_track();
+    str = new_track();
+
+    /* Mixed excitation has the same noise in both */
+    cg_db.mixed_excitation = 1;
+    cgfx_make_tracks(params,str,2000,0);
+    fails += cgfx_compare("mixed excitation",params,str,&cg_db,"quality");
+    fails += cgfx_compare("mixed excitation",params,str,&cg_db,"fast");
+
+    /* Without, the noise isn't the same, so only pulses are compared */
+    cg_db.mixed_excitation = 0;
+    cgfx_make_tracks(params,str,2000,1);
+    fails += cgfx_compare("pulse excitation",params,NULL,&cg_db,"quality");
+
+    delete_track(params);
+    delete_track(str);
+
+    return (fails ? 1 : 0);
+}
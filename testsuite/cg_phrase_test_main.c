@@ -0,0 +1,390 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Check CG synthesis phrase by phrase (cg_by_phrase) against the whole */
+/*  utterance at once, with a made up voice                              */
+/*                                                                       */
+/*************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "flite.h"
+#include "cst_cg.h"
+#include "../lang/usenglish/usenglish.h"
+#include "../lang/cmulex/cmu_lex.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define CGPH_ORDER 48
+#define CGPH_BANDS 5
+#define CGPH_MCEPS 25
+/* F0, statics, deltas, strengths and voicing, each a mean and stddev */
+#define CGPH_CHANNELS (2*(1+CGPH_MCEPS+CGPH_MCEPS+CGPH_BANDS+1))
+#define CGPH_ROWS 6
+#define CGPH_NODES 11
+
+/* Smallest signal to difference ratio (dB) allowed with MLPG, which */
+/* only sees CG_MLPG_CONTEXT frames beyond each phrase               */
+#define CGPH_MIN_SNR 40.0
+
+static double cgph_filters[CGPH_BANDS][CGPH_ORDER];
+static const double *cgph_h[CGPH_BANDS];
+
+static unsigned short cgph_vectors[CGPH_ROWS][CGPH_CHANNELS];
+static const unsigned short *cgph_rows[CGPH_ROWS];
+static const unsigned short **cgph_models[1] = { cgph_rows };
+static float cgph_min[CGPH_CHANNELS];
+static float cgph_range[CGPH_CHANNELS];
+static int cgph_num_channels[1] = { CGPH_CHANNELS };
+static int cgph_num_frames[1] = { CGPH_ROWS };
+
+static cst_cart_node cgph_param_nodes[CGPH_NODES];
+static cst_cart_node cgph_f0_nodes[CGPH_NODES];
+static cst_cart_node cgph_dur_nodes[CGPH_NODES];
+static const char * const cgph_mcep_feats[] = {
+    "R:mcep_link.parent.R:segstate.parent.ph_vc",
+    "R:mcep_link.parent.statepos", NULL };
+static const char * const cgph_state_feats[] = {
+    "R:segstate.parent.ph_vc", "statepos", NULL };
+static const cst_cart cgph_param_tree = { cgph_param_nodes, cgph_mcep_feats };
+static const cst_cart cgph_f0_tree = { cgph_f0_nodes, cgph_mcep_feats };
+static const cst_cart cgph_dur_tree = { cgph_dur_nodes, cgph_state_feats };
+static const cst_cart *cgph_param_trees0[1] = { &cgph_param_tree };
+static const cst_cart *cgph_f0_trees0[1] = { &cgph_f0_tree };
+static const cst_cart **cgph_param_trees[1] = { cgph_param_trees0 };
+static const cst_cart **cgph_f0_trees[1] = { cgph_f0_trees0 };
+static const cst_cart *cgph_dur_carts[1] = { &cgph_dur_tree };
+
+static const dur_stat cgph_dur_x = { "x", 0.025, 0.01 };
+static const dur_stat cgph_dur_pau = { "pau_2", 0.15, 0.05 };
+static const dur_stat *cgph_dur_stats0[] = { &cgph_dur_x, &cgph_dur_pau, NULL };
+static const dur_stat **cgph_dur_stats[1] = { cgph_dur_stats0 };
+
+/* Unknown phones get the first one's states */
+static const char * const cgph_x_states[] =
+    { "x", "x_1", "x_2", "x_3", NULL };
+static const char * const cgph_pau_states[] =
+    { "pau", "pau_1", "pau_2", "pau_3", NULL };
+static const char * const * const cgph_phone_states[] =
+    { cgph_x_states, cgph_pau_states, NULL };
+static const char * const cgph_types[] = { "x_1", NULL };
+
+static float cgph_dynwin[3] = { -0.5, 0.0, 0.5 };
+
+static cst_val *cgph_vals[3*CGPH_NODES];
+static int cgph_num_vals = 0;
+
+static const cst_val *cgph_val(cst_val *v)
+{
+    cgph_vals[cgph_num_vals++] = v;
+    return v;
+}
+
+static void cgph_make_tree(cst_cart_node *n, cst_val *leaves[CGPH_ROWS])
+{
+    /* On ph_vc (feature 0) then statepos (feature 1), leaves 0-2 for */
+    /* voiced phones' states 1-3, and 3-5 for the others'              */
+    static const unsigned char feat[CGPH_NODES] =
+        { 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0 };
+    static const unsigned char op[CGPH_NODES] =
+        { CST_CART_OP_IS, CST_CART_OP_LESS, CST_CART_OP_LEAF,
+          CST_CART_OP_LESS, CST_CART_OP_LEAF, CST_CART_OP_LEAF,
+          CST_CART_OP_LESS, CST_CART_OP_LEAF,
+          CST_CART_OP_LESS, CST_CART_OP_LEAF, CST_CART_OP_LEAF };
+    static const unsigned short no_node[CGPH_NODES] =
+        { 6, 3, 0, 5, 0, 0, 8, 0, 10, 0, 0 };
+    static const int leaf[CGPH_NODES] =
+        { -1, -1, 0, -1, 1, 2, -1, 3, -1, 4, 5 };
+    int i;
+
+    for (i=0; i<CGPH_NODES; i++)
+    {
+        n[i].feat = feat[i];
+        n[i].op = op[i];
+        n[i].no_node = no_node[i];
+        if (leaf[i] >= 0)
+            n[i].val = cgph_val(leaves[leaf[i]]);
+        else if (i == 0)
+            n[i].val = cgph_val(string_val("+"));
+        else
+            n[i].val = cgph_val(int_val((i == 1 || i == 6) ? 2 : 3));
+    }
+}
+
+static void cgph_make_db(cst_cg_db *cg_db)
+{
+    cst_val *leaves[CGPH_ROWS];
+    double t, w, lo, hi, v;
+    int i, j, k, r;
+    static const double edges[CGPH_BANDS+1] =
+        { 0.0, 1000.0, 2000.0, 4000.0, 6000.0, 8000.0 };
+
+    for (j=0; j<CGPH_BANDS; j++)
+    {
+        lo = edges[j]/16000.0;
+        hi = edges[j+1]/16000.0;
+        for (i=0; i<CGPH_ORDER; i++)
+        {
+            t = i - (CGPH_ORDER-1)/2.0;
+            w = 0.54 - 0.46*cos(2*M_PI*i/(CGPH_ORDER-1));
+            cgph_filters[j][i] = w *
+                (sin(2*M_PI*hi*t) - sin(2*M_PI*lo*t)) / (M_PI*t);
+        }
+        cgph_h[j] = cgph_filters[j];
+    }
+
+    /* Rows 0-2 are voiced, 3-5 aren't */
+    for (i=0; i<CGPH_CHANNELS; i++)
+    {
+        cgph_min[i] = -1.0;
+        cgph_range[i] = 8.0;
+    }
+    for (r=0; r<CGPH_ROWS; r++)
+    {
+        for (i=0; i<CGPH_CHANNELS; i+=2)
+        {
+            k = i/2;
+            if (k == 1)
+                v = 4.5 + 0.3*r;                          /* c0 */
+            else if (k <= CGPH_MCEPS)
+                v = 0.4*sin(r*1.7+k)/k;                   /* statics */
+            else if (k <= 2*CGPH_MCEPS)
+                v = 0.02*sin(r+k);                        /* deltas */
+            else if (k <= 2*CGPH_MCEPS+CGPH_BANDS)
+                v = 0.5+0.4*sin(r+k);                     /* strengths */
+            else
+                v = (r < 3) ? 0.9 : 0.1;                  /* voicing */
+            if (k == 0)
+                v = 0.0;
+            cgph_vectors[r][i] = (unsigned short)
+                (0.5 + 65535.0*(v-cgph_min[i])/cgph_range[i]);
+            v = (k <= CGPH_MCEPS) ? 0.1 : 0.05;           /* stddevs */
+            cgph_vectors[r][i+1] = (unsigned short)
+                (0.5 + 65535.0*(v-cgph_min[i+1])/cgph_range[i+1]);
+        }
+        cgph_rows[r] = cgph_vectors[r];
+    }
+
+    for (r=0; r<CGPH_ROWS; r++)
+        leaves[r] = int_val(r);
+    cgph_make_tree(cgph_param_nodes,leaves);
+    for (r=0; r<CGPH_ROWS; r++)
+        leaves[r] = float_val((r < 3) ? 110.0+(r*r*15.0) : 0.0);
+    cgph_make_tree(cgph_f0_nodes,leaves);
+    for (r=0; r<CGPH_ROWS; r++)
+        leaves[r] = float_val(((r%3)-1)*0.8);
+    cgph_make_tree(cgph_dur_nodes,leaves);
+
+    memset(cg_db,0,sizeof(*cg_db));
+    cg_db->name = "cg_phrase_test";
+    cg_db->types = cgph_types;
+    cg_db->num_types = 1;
+    cg_db->sample_rate = 16000;
+    cg_db->f0_mean = 120.0;
+    cg_db->f0_stddev = 20.0;
+    cg_db->num_f0_models = 1;
+    cg_db->f0_trees = cgph_f0_trees;
+    cg_db->num_param_models = 1;
+    cg_db->param_trees = cgph_param_trees;
+    cg_db->num_channels = cgph_num_channels;
+    cg_db->num_frames = cgph_num_frames;
+    cg_db->model_vectors = cgph_models;
+    cg_db->model_min = cgph_min;
+    cg_db->model_range = cgph_range;
+    cg_db->model_shape = CST_CG_MODEL_SHAPE_BASE_MINRANGE;
+    cg_db->frame_advance = 0.005;
+    cg_db->num_dur_models = 1;
+    cg_db->dur_stats = cgph_dur_stats;
+    cg_db->dur_cart = cgph_dur_carts;
+    cg_db->phone_states = cgph_phone_states;
+    cg_db->do_mlpg = 1;
+    cg_db->dynwin = cgph_dynwin;
+    cg_db->dynwinsize = 3;
+    cg_db->mlsa_alpha = 0.42;
+    cg_db->mlsa_beta = 0.4;
+    cg_db->mixed_excitation = 1;
+    cg_db->ME_num = CGPH_BANDS;
+    cg_db->ME_order = CGPH_ORDER;
+    cg_db->me_h = cgph_h;
+    cg_db->gain = 1.5;
+}
+
+static cst_utterance *cgph_synth(cst_voice *v, const char *tier_name,
+                                 int by_phrase)
+{
+    feat_set_string(v->features,"synthesis_tier",tier_name);
+    feat_set_int(v->features,"cg_by_phrase",by_phrase);
+    return flite_synth_text("Once there was a phrase, then another one, "
+                            "and at last a third one to end it.",v);
+}
+
+static int cgph_breaks(cst_utterance *u)
+{
+    /* The pauses it is split at, else there is nothing to test */
+    cst_item *s;
+    int n = 0;
+
+    for (s=utt_rel_head(u,"Segment"); s; s=item_next(s))
+        if (item_prev(s) && item_next(s) &&
+            cst_streq("pau",item_feat_string(s,"name")))
+            n++;
+    return n;
+}
+
+static int cgph_same_track(const cst_track *a, const cst_track *b)
+{
+    int i;
+
+    if ((a->num_frames != b->num_frames) ||
+        (a->num_channels != b->num_channels))
+        return FALSE;
+    for (i=0; i<a->num_frames; i++)
+        if (memcmp(a->frames[i],b->frames[i],
+                   a->num_channels*sizeof(float)) != 0)
+            return FALSE;
+    return TRUE;
+}
+
+static int cgph_compare_waves(const char *name, const cst_wave *a,
+                              const cst_wave *b, double min_snr)
+{
+    /* min_snr < 0 asks for the same samples */
+    double sig = 0.0, err = 0.0, d, snr;
+    int i, fail;
+
+    fail = (a->num_samples != b->num_samples) || (a->num_samples == 0);
+    for (i=0; !fail && i<a->num_samples; i++)
+    {
+        d = a->samples[i] - b->samples[i];
+        sig += (double)a->samples[i]*a->samples[i];
+        err += d*d;
+    }
+    snr = (err > 0.0) ? 10.0*log10(sig/err) : 99.9;
+    if (min_snr < 0.0)
+        fail = fail || (err > 0.0);
+    else
+        fail = fail || (snr < min_snr);
+    printf("%s: %d samples, snr %.1f dB: %s\n",
+           name,a->num_samples,snr,(fail ? "FAILED" : "ok"));
+
+    return fail;
+}
+
+static int cgph_compare(cst_voice *v, const char *tier_name, double min_snr)
+{
+    cst_utterance *whole, *phrases;
+    char name[64];
+    int fail;
+
+    whole = cgph_synth(v,tier_name,0);
+    phrases = cgph_synth(v,tier_name,1);
+
+    /* The F0 spline done as the frames are predicted is the same as */
+    /* when done all at once, as are the other predicted parameters   */
+    fail = !cgph_same_track(val_track(utt_feat_val(whole,"param_track")),
+                            val_track(utt_feat_val(phrases,"param_track")));
+    printf("%s params, %d breaks: %s\n",tier_name,cgph_breaks(whole),
+           (fail || (cgph_breaks(whole) < 2)) ? "FAILED" : "ok");
+    fail = fail || (cgph_breaks(whole) < 2);
+
+    cst_sprintf(name,"%s by phrase",tier_name);
+    fail += cgph_compare_waves(name,utt_wave(whole),utt_wave(phrases),
+                               min_snr);
+
+    delete_utterance(whole);
+    delete_utterance(phrases);
+
+    return fail;
+}
+
+static int cgph_baseline(cst_voice *v, cst_cg_db *cg_db)
+{
+    /* The whole utterance against MLPG and the vocoder run on its */
+    /* parameters directly                                          */
+    cst_utterance *u;
+    cst_track *smoothed;
+    cst_wave *w;
+    int fail;
+
+    u = cgph_synth(v,"quality",0);
+    smoothed = mlpg(val_track(utt_feat_val(u,"param_track")),cg_db);
+    w = mlsa_resynthesis(smoothed,val_track(utt_feat_val(u,"str_track")),
+                         cg_db,NULL,0);
+    fail = cgph_compare_waves("quality whole",utt_wave(u),w,-1.0);
+
+    delete_wave(w);
+    delete_track(smoothed);
+    delete_utterance(u);
+
+    return fail;
+}
+
+int main(int argc, char **argv)
+{
+    cst_voice *v;
+    cst_lexicon *lex;
+    cst_cg_db cg_db;
+    int i, fails = 0;
+
+    flite_init();
+    cgph_make_db(&cg_db);
+
+    v = new_voice();
+    v->name = "cg_phrase_test";
+    usenglish_init(v);
+    lex = cmu_lex_init();
+    feat_set(v->features,"lexicon",lexicon_val(lex));
+    feat_set(v->features,"postlex_func",uttfunc_val(lex->postlex));
+    feat_set_string(v->features,"no_segment_duration_model","1");
+    feat_set_string(v->features,"no_f0_target_model","1");
+    feat_set(v->features,"wave_synth_func",uttfunc_val(&cg_synth));
+    feat_set(v->features,"cg_db",cg_db_val(&cg_db));
+    feat_set_int(v->features,"sample_rate",cg_db.sample_rate);
+
+    fails += cgph_baseline(v,&cg_db);
+    /* Without MLPG the phrases are vocoded from the same frames */
+    fails += cgph_compare(v,"fast",-1.0);
+    fails += cgph_compare(v,"quality",CGPH_MIN_SNR);
+
+    delete_voice(v);
+    for (i=0; i<cgph_num_vals; i++)
+        delete_val(cgph_vals[i]);
+
+    return (fails ? 1 : 0);
+}
@@ -63,7 +63,8 @@ int main(int argc, char **argv)
     files =
         cst_args(argv,argc,
                  "usage: compare_waves OPTIONS WAVE1 WAVE2\n"
-                 "Compare two waveformfiles\n",
+                 "Compare two waveformfiles\n"
+                 "-spectral   Also give the log spectral distance (dB)\n",
                  args);
 
     f1 = val_string(val_car(files));
@@ -143,7 +144,11 @@ int main(int argc, char **argv)
     v3 = (yysum/yycount)-((ysum/ycount)*(ysum/ycount));
     c = v1/sqrt(v2*v3);
         
-    printf("%2.3f %0.3f %d\n",sqrt(b),c,best);
+    if (feat_present(args,"-spectral"))
+        printf("%2.3f %0.3f %d %2.3f\n",sqrt(b),c,best,
+               cst_wave_spectral_distance(w1,w2));
+    else
+        printf("%2.3f %0.3f %d\n",sqrt(b),c,best);
 
     return 0;
 }
@@ -0,0 +1,185 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Check every signal processing kernel variant this machine can run    */
+/*  against the C reference                                              */
+/*                                                                       */
+/*************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <limits.h>
+
+#include "cst_alloc.h"
+#include "cst_dsp.h"
+
+#define DSP_TEST_MAX 300
+
+static unsigned int dsp_test_seed = 12345;
+
+static unsigned int dsp_test_rand(void)
+{
+    /* our own, so every run (and machine) tests the same numbers */
+    dsp_test_seed ^= dsp_test_seed << 13;
+    dsp_test_seed ^= dsp_test_seed >> 17;
+    dsp_test_seed ^= dsp_test_seed << 5;
+    return dsp_test_seed;
+}
+
+static double dsp_test_real(void)
+{
+    return ((double)(dsp_test_rand() % 20001) - 10000.0) / 1000.0;
+}
+
+static int dsp_test_variant(const cst_dsp_kernels *ref,
+                            const cst_dsp_kernels *k)
+{
+    double *da, *db, dr, dv, dmag;
+    float *fa, *fb, fr, fv, fmag;
+    int *ia, *ib;
+    unsigned short *sa, *sb, *w;
+    unsigned char *ca, *cb;
+    int i, n, off, t, best, rr, rv;
+    int fails = 0;
+
+    da = cst_alloc(double,DSP_TEST_MAX+1);
+    db = cst_alloc(double,DSP_TEST_MAX+1);
+    fa = cst_alloc(float,DSP_TEST_MAX+1);
+    fb = cst_alloc(float,DSP_TEST_MAX+1);
+    ia = cst_alloc(int,DSP_TEST_MAX+1);
+    ib = cst_alloc(int,DSP_TEST_MAX+1);
+    sa = cst_alloc(unsigned short,DSP_TEST_MAX+1);
+    sb = cst_alloc(unsigned short,DSP_TEST_MAX+1);
+    w = cst_alloc(unsigned short,DSP_TEST_MAX+1);
+    ca = cst_alloc(unsigned char,DSP_TEST_MAX+1);
+    cb = cst_alloc(unsigned char,DSP_TEST_MAX+1);
+
+    for (t=0; t<2000; t++)
+    {
+        /* all the short lengths, where the tails matter, then longer */
+        n = (t < 200) ? t%70 : (int)(dsp_test_rand() % DSP_TEST_MAX);
+        off = t & 1;   /* unaligned too */
+        dmag = 0.0;
+        fmag = 0.0;
+        for (i=0; i<n+off; i++)
+        {
+            da[i] = dsp_test_real();
+            db[i] = dsp_test_real();
+            fa[i] = (float)dsp_test_real();
+            fb[i] = (float)dsp_test_real();
+            ia[i] = (int)dsp_test_rand();
+            ib[i] = (int)dsp_test_rand();
+            sa[i] = (unsigned short)dsp_test_rand();
+            sb[i] = (unsigned short)dsp_test_rand();
+            w[i] = (unsigned short)dsp_test_rand();
+            ca[i] = (unsigned char)dsp_test_rand();
+            cb[i] = (unsigned char)dsp_test_rand();
+            if (i >= off)
+            {
+                dmag += fabs(da[i]*db[i]);
+                fmag += fabs(fa[i]*fb[i]);
+            }
+        }
+
+        /* The float ones may add in a different order */
+        dr = ref->dot(da+off,db+off,n);
+        dv = k->dot(da+off,db+off,n);
+        if (fabs(dr-dv) > 1e-12*(dmag+1.0))
+        {
+            printf("%s dot n=%d: %.17g should be %.17g\n",k->name,n,dv,dr);
+            fails++;
+        }
+        fr = ref->dot_float(fa+off,fb+off,n);
+        fv = k->dot_float(fa+off,fb+off,n);
+        if (fabs(fr-fv) > 1e-5*(fmag+1.0))
+        {
+            printf("%s dot_float n=%d: %.9g should be %.9g\n",k->name,n,fv,fr);
+            fails++;
+        }
+        rr = ref->dot_int(ia+off,ib+off,n);
+        rv = k->dot_int(ia+off,ib+off,n);
+        if (rr != rv)
+        {
+            printf("%s dot_int n=%d: %d should be %d\n",k->name,n,rv,rr);
+            fails++;
+        }
+
+        /* Exact without a cut off, with one only when it isn't reached */
+        best = (t & 2) ? INT_MAX : (int)(dsp_test_rand() % (4096*(n+1)));
+        rr = ref->wabsdiff16(sa+off,sb+off,w+off,n,best);
+        rv = k->wabsdiff16(sa+off,sb+off,w+off,n,best);
+        if ((rr <= best) ? (rr != rv) : (rv <= best))
+        {
+            printf("%s wabsdiff16 n=%d best=%d: %d should be %d\n",
+                   k->name,n,best,rv,rr);
+            fails++;
+        }
+        rr = ref->wabsdiff8(ca+off,cb+off,w+off,n,best);
+        rv = k->wabsdiff8(ca+off,cb+off,w+off,n,best);
+        if ((rr <= best) ? (rr != rv) : (rv <= best))
+        {
+            printf("%s wabsdiff8 n=%d best=%d: %d should be %d\n",
+                   k->name,n,best,rv,rr);
+            fails++;
+        }
+    }
+
+    cst_free(da); cst_free(db);
+    cst_free(fa); cst_free(fb);
+    cst_free(ia); cst_free(ib);
+    cst_free(sa); cst_free(sb); cst_free(w);
+    cst_free(ca); cst_free(cb);
+
+    return fails;
+}
+
+int main(int argc, char **argv)
+{
+    const cst_dsp_kernels *ref, *k;
+    int i, fails, total = 0;
+
+    cst_dsp_init();
+    ref = cst_dsp_variant(0);
+    printf("using %s\n",cst_dsp->name);
+    for (i=1; (k = cst_dsp_variant(i)) != NULL; i++)
+    {
+        fails = dsp_test_variant(ref,k);
+        printf("%s: %s\n",k->name,(fails ? "FAILED" : "ok"));
+        total += fails;
+    }
+
+    return (total ? 1 : 0);
+}
@@ -0,0 +1,302 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Check the prompt cache: least recently used prompts go first, old    */
+/*  ones expire, and damaged files on disk aren't used                   */
+/*                                                                       */
+/*************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <dirent.h>
+
+#include "flite.h"
+#include "../lang/usenglish/usenglish.h"
+#include "../lang/cmulex/cmu_lex.h"
+
+#define CACHE_TEST_SAMPLES 8000
+
+static int fails = 0;
+static int cache_test_no_wave = FALSE;  /* as if synthesis failed */
+
+static cst_utterance *cache_test_synth(cst_utterance *u)
+{
+    /* Stands in for a synthesizer, every prompt is the same length */
+    cst_wave *w;
+
+    if (cache_test_no_wave)
+        return u;
+    w = new_wave();
+    w->sample_rate = 16000;
+    cst_wave_resize(w,CACHE_TEST_SAMPLES,1);
+    utt_set_wave(u,w);
+
+    return u;
+}
+
+static void cache_test_check(int ok, const char *what)
+{
+    if (!ok)
+    {
+        printf("FAILED: %s\n",what);
+        fails++;
+    }
+}
+
+static int cache_test_say(cst_voice *v, flite_prompt_cache *c,
+                          const char *text)
+{
+    /* 1 if text was in the cache (or on disk), 2 if only on disk */
+    flite_prompt_cache_counts before, after;
+    cst_utterance *u;
+
+    feat_set(v->features,"prompt_cache",prompt_cache_val(c));
+    flite_prompt_cache_stats(c,&before);
+    u = flite_synth_text_cached(text,v);
+    flite_prompt_cache_stats(c,&after);
+    if ((u == NULL) ||
+        (!cache_test_no_wave &&
+         (utt_wave(u)->num_samples != CACHE_TEST_SAMPLES)))
+        cache_test_check(0,"wrong wave");
+    delete_utterance(u);
+    feat_remove(v->features,"prompt_cache");
+
+    if (after.disk_hits > before.disk_hits)
+        return 2;
+    return (after.hits > before.hits) ? 1 : 0;
+}
+
+static char *cache_test_file(const char *dir)
+{
+    /* The (only) prompt file in dir */
+    DIR *d;
+    struct dirent *de;
+    char *fn = NULL;
+
+    d = opendir(dir);
+    while (d && (fn == NULL) && (de = readdir(d)))
+        if (strstr(de->d_name,".fpc"))
+        {
+            fn = cst_alloc(char,cst_strlen(dir)+cst_strlen(de->d_name)+2);
+            cst_sprintf(fn,"%s/%s",dir,de->d_name);
+        }
+    if (d)
+        closedir(d);
+    return fn;
+}
+
+static void cache_test_age(const char *fn, int seconds)
+{
+    /* Make the file seem to have been made that long ago */
+    FILE *fd;
+    int h[7];
+    long long t;
+
+    fd = fopen(fn,"r+b");
+    if ((fd == NULL) || (fread(h,sizeof(int),7,fd) != 7))
+    {
+        cache_test_check(0,"can't read prompt file");
+        if (fd) fclose(fd);
+        return;
+    }
+    t = (long long)time(NULL) - seconds;
+    h[5] = (int)(unsigned int)(t & 0xffffffff);
+    h[6] = (int)(unsigned int)(t >> 32);
+    fseek(fd,0,SEEK_SET);
+    fwrite(h,sizeof(int),7,fd);
+    fclose(fd);
+}
+
+static void cache_test_truncate(const char *fn, int size)
+{
+    /* Keep just the first size bytes, or all but the last -size */
+    FILE *fd;
+    char *buff;
+    int length = 0;
+
+    fd = fopen(fn,"rb");
+    if (fd)
+    {
+        fseek(fd,0,SEEK_END);
+        length = ftell(fd);
+        fseek(fd,0,SEEK_SET);
+        if (size < 0)
+            size += length;
+        buff = cst_alloc(char,length+1);
+        length = fread(buff,1,length,fd);
+        fclose(fd);
+        if ((fd = fopen(fn,"wb")) != NULL)
+        {
+            fwrite(buff,1,(size < length) ? size : length,fd);
+            fclose(fd);
+        }
+        cst_free(buff);
+    }
+    cache_test_check(length > size,"prompt file to cut");
+}
+
+int main(int argc, char **argv)
+{
+    cst_voice *v;
+    flite_prompt_cache *c;
+    flite_prompt_cache_counts counts;
+    char dir[] = "/tmp/prompt_cache_testXXXXXX";
+    char *fn, *gone;
+    int size;
+
+    flite_init();
+
+    v = new_voice();
+    v->name = "cache_test";
+    usenglish_init(v);
+    feat_set(v->features,"lexicon",lexicon_val(cmu_lex_init()));
+    feat_set(v->features,"wave_synth_func",uttfunc_val(&cache_test_synth));
+
+    /* Least recently used go first: room for two prompts, not three */
+    c = new_flite_prompt_cache(1000000,0,NULL);
+    cache_test_say(v,c,"one");
+    flite_prompt_cache_stats(c,&counts);
+    size = (int)counts.bytes;
+    delete_flite_prompt_cache(c);
+
+    c = new_flite_prompt_cache(size*5/2,0,NULL);
+    cache_test_check(cache_test_say(v,c,"one") == 0,"one at first");
+    cache_test_check(cache_test_say(v,c,"two") == 0,"two at first");
+    cache_test_check(cache_test_say(v,c,"one") == 1,"one again");
+    cache_test_check(cache_test_say(v,c,"six") == 0,"six at first");
+    cache_test_check(cache_test_say(v,c,"one") == 1,"one kept");
+    cache_test_check(cache_test_say(v,c,"two") == 0,"two dropped");
+    flite_prompt_cache_stats(c,&counts);
+    cache_test_check(counts.evictions == 2,"evictions");
+    cache_test_check(counts.entries == 2,"entries");
+    delete_flite_prompt_cache(c);
+
+    /* Each synthesis tier has its own prompts */
+    c = new_flite_prompt_cache(1000000,0,NULL);
+    feat_set_string(v->features,"synthesis_tier","fast");
+    cache_test_check(cache_test_say(v,c,"one") == 0,"fast at first");
+    cache_test_check(cache_test_say(v,c,"one") == 1,"fast again");
+    feat_set_string(v->features,"synthesis_tier","quality");
+    cache_test_check(cache_test_say(v,c,"one") == 0,"quality at first");
+    feat_set_string(v->features,"synthesis_tier","fast");
+    cache_test_check(cache_test_say(v,c,"one") == 1,"fast kept");
+    feat_remove(v->features,"synthesis_tier");
+    delete_flite_prompt_cache(c);
+
+    /* And fixed and float CG vocoders too */
+    c = new_flite_prompt_cache(1000000,0,NULL);
+    feat_set_string(v->features,"resynth_type","float");
+    cache_test_check(cache_test_say(v,c,"one") == 0,"float at first");
+    feat_set_string(v->features,"resynth_type","fixed");
+    cache_test_check(cache_test_say(v,c,"one") == 0,"fixed at first");
+    cache_test_check(cache_test_say(v,c,"one") == 1,"fixed again");
+    feat_set_string(v->features,"resynth_type","float");
+    cache_test_check(cache_test_say(v,c,"one") == 1,"float kept");
+    feat_remove(v->features,"resynth_type");
+    delete_flite_prompt_cache(c);
+
+    /* Expiry in memory */
+    c = new_flite_prompt_cache(1000000,1,NULL);
+    cache_test_check(cache_test_say(v,c,"one") == 0,"one to expire");
+    sleep(2);
+    cache_test_check(cache_test_say(v,c,"one") == 0,"one expired");
+    flite_prompt_cache_stats(c,&counts);
+    cache_test_check(counts.expired == 1,"expired count");
+    delete_flite_prompt_cache(c);
+
+    /* Expiry and damage on disk, each through a new cache so it */
+    /* has to be read back                                       */
+    if (mkdtemp(dir) == NULL)
+    {
+        printf("FAILED: can't make %s\n",dir);
+        return 1;
+    }
+    c = new_flite_prompt_cache(1000000,0,dir);
+    cache_test_say(v,c,"one");
+    delete_flite_prompt_cache(c);
+    fn = cache_test_file(dir);
+    cache_test_check(fn != NULL,"prompt file written");
+    if (fn)
+    {
+        c = new_flite_prompt_cache(1000000,3000,dir);
+        cache_test_age(fn,2000);
+        cache_test_check(cache_test_say(v,c,"one") == 2,"young file read");
+        delete_flite_prompt_cache(c);
+
+        c = new_flite_prompt_cache(1000000,3000,dir);
+        cache_test_age(fn,3600);
+        cache_test_check(cache_test_say(v,c,"one") == 0,"old file ignored");
+        delete_flite_prompt_cache(c);
+
+        /* and removed, which shows when it isn't remade */
+        c = new_flite_prompt_cache(1000000,3000,dir);
+        cache_test_age(fn,3600);
+        cache_test_no_wave = TRUE;
+        cache_test_say(v,c,"one");
+        cache_test_no_wave = FALSE;
+        gone = cache_test_file(dir);
+        cache_test_check(gone == NULL,"old file removed");
+        cst_free(gone);
+        delete_flite_prompt_cache(c);
+        c = new_flite_prompt_cache(1000000,0,dir);
+        cache_test_say(v,c,"one");
+        delete_flite_prompt_cache(c);
+
+        /* Just some of the header, then all but the last sample */
+        c = new_flite_prompt_cache(1000000,0,dir);
+        cache_test_age(fn,0);
+        cache_test_truncate(fn,10);
+        cache_test_check(cache_test_say(v,c,"one") == 0,"header cut");
+        delete_flite_prompt_cache(c);
+
+        c = new_flite_prompt_cache(1000000,0,dir);
+        cache_test_truncate(fn,-2);
+        cache_test_check(cache_test_say(v,c,"one") == 0,"samples cut");
+        delete_flite_prompt_cache(c);
+
+        remove(fn);
+        cst_free(fn);
+    }
+    rmdir(dir);
+
+    printf("%s\n",(fails ? "FAILED" : "ok"));
+
+    delete_voice(v);
+
+    return (fails ? 1 : 0);
+}
@@ -0,0 +1,179 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Compare the compiled prosody models (tools/compile_prosody) with     */
+/*  the interpreted ones and time both                                   */
+/*                                                                       */
+/*************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "flite.h"
+#include "cst_thread.h"
+#include "usenglish.h"
+#include "us_f0.h"
+
+cst_lexicon *cmu_lex_init(void);
+
+static const char *texts[] = {
+    "Hello world.",
+    "Is this the right way to the station?",
+    "A large fraction of the budget, about 45 percent, went on the new building in 1998.",
+    "Please call Dr. Smith at 412 268 3000 before Tuesday, or send email instead!",
+    "The quick brown fox jumps over the lazy dog, and then runs away into the woods.",
+    NULL };
+
+static cst_voice *prosody_voice(void)
+{
+    /* Just the front end, there is no waveform synthesis */
+    cst_voice *v;
+    cst_lexicon *lex;
+
+    v = new_voice();
+    v->name = "prosody_test";
+    usenglish_init(v);
+    lex = cmu_lex_init();
+    feat_set(v->features,"lexicon",lexicon_val(lex));
+    feat_set(v->features,"postlex_func",uttfunc_val(lex->postlex));
+
+    return v;
+}
+
+static cst_utterance *synth(const char *text, cst_voice *v, int compiled)
+{
+    feat_set_int(v->features,"compiled_prosody",compiled);
+    return flite_synth_text(text,v);
+}
+
+static int compare_relation(cst_utterance *a, cst_utterance *b,
+                            const char *relname, const char * const *feats)
+{
+    cst_item *i, *j;
+    const cst_val *va, *vb;
+    int k, n, errors = 0;
+
+    for (i=relation_head(utt_relation(a,relname)),
+             j=relation_head(utt_relation(b,relname)), n=0;
+         i && j; i=item_next(i), j=item_next(j), n++)
+    {
+        for (k=0; feats[k]; k++)
+        {
+            /* exactly the same, floats included */
+            va = feat_val(item_feats(i),feats[k]);
+            vb = feat_val(item_feats(j),feats[k]);
+            if ((va || vb) && !(va && vb && val_equal(va,vb)))
+            {
+                printf("%s %s differs at item %d\n",relname,feats[k],n);
+                errors++;
+            }
+        }
+    }
+    if (i || j)
+    {
+        printf("%s has different lengths\n",relname);
+        errors++;
+    }
+
+    return errors;
+}
+
+static double time_module(cst_utterance *u, cst_uttfunc f, int compiled,
+                          int n)
+{
+    double start;
+    int i;
+
+    feat_set_int(u->features,"compiled_prosody",compiled);
+    start = cst_clock_wall();
+    for (i=0; i<n; i++)
+        f(u);
+    return cst_clock_wall()-start;
+}
+
+int main(int argc, char **argv)
+{
+    static const char * const syl_feats[] = { "accent", "endtone", NULL };
+    static const char * const seg_feats[] = { "end", NULL };
+    static const char * const targ_feats[] = { "pos", "f0", NULL };
+    static const struct { const char *name; cst_uttfunc f; } modules[] = {
+        { "accents and tones", cart_intonation },
+        { "duration", cart_duration },
+        { "f0", us_f0_model },
+        { NULL, NULL } };
+    cst_voice *v;
+    cst_utterance *a, *b;
+    double interpreted, compiled;
+    int i, m, n, errors = 0;
+
+    n = 200;
+    if (argc > 1)
+        n = atoi(argv[1]);
+
+    flite_init();
+    v = prosody_voice();
+
+    for (i=0; texts[i]; i++)
+    {
+        a = synth(texts[i],v,FALSE);
+        b = synth(texts[i],v,TRUE);
+        errors += compare_relation(a,b,"Syllable",syl_feats);
+        errors += compare_relation(a,b,"Segment",seg_feats);
+        errors += compare_relation(a,b,"Target",targ_feats);
+        delete_utterance(a);
+        delete_utterance(b);
+    }
+    printf("compiled and interpreted models %s\n",
+           errors ? "differ" : "agree");
+
+    for (m=0; modules[m].name; m++)
+    {
+        interpreted = compiled = 0.0;
+        for (i=0; texts[i]; i++)
+        {
+            a = synth(texts[i],v,TRUE);
+            interpreted += time_module(a,modules[m].f,FALSE,n);
+            compiled += time_module(a,modules[m].f,TRUE,n);
+            delete_utterance(a);
+        }
+        printf("%-18s interpreted %8.2f ms compiled %8.2f ms (%.2fx)\n",
+               modules[m].name,interpreted*1000.0,compiled*1000.0,
+               compiled > 0.0 ? interpreted/compiled : 0.0);
+    }
+
+    delete_voice(v);
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,222 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Check the phone, word and mark events given while streaming, with a  */
+/*  stand in synthesizer that only makes silence, and that a prompt from */
+/*  the prompt cache gives the same events                               */
+/*                                                                       */
+/*************************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+#include "flite.h"
+#include "../lang/usenglish/usenglish.h"
+#include "../lang/cmulex/cmu_lex.h"
+
+#define EVENTS_TEST_CHUNK 160
+
+typedef struct events_test_struct {
+    int sent;          /* samples given to the audio callback so far */
+    int phone_end;     /* where the last phone ended */
+    int word_start;    /* start of the last word, -1 once its phone came */
+    const char *last_mark;
+    char log[4096];    /* all the events so far */
+    int fails;
+} events_test;
+
+static void events_test_fail(events_test *et, const cst_audio_event *e,
+                             const char *why)
+{
+    printf("FAILED: %d %s %d %d: %s\n",e->type,e->name,e->start,e->end,why);
+    et->fails++;
+}
+
+static int events_test_event(const cst_audio_event *e,
+                             cst_audio_streaming_info *asi)
+{
+    events_test *et = (events_test *)asi->userdata;
+
+    printf("%s %s %d %d\n",
+           (e->type == CST_AUDIO_EVENT_PHONE) ? "phone" :
+           (e->type == CST_AUDIO_EVENT_WORD) ? "word" : "mark",
+           e->name,e->start,e->end);
+    if (cst_strlen(et->log) + cst_strlen(e->name) + 40 < sizeof(et->log))
+        cst_sprintf(et->log+cst_strlen(et->log),"%d %s %d %d\n",
+                    e->type,e->name,e->start,e->end);
+
+    /* Before its audio, but not long before */
+    if (e->start < et->sent)
+        events_test_fail(et,e,"after its audio");
+    if (e->start >= et->sent + EVENTS_TEST_CHUNK)
+        events_test_fail(et,e,"too early");
+    if (e->end < e->start)
+        events_test_fail(et,e,"ends before it starts");
+
+    if (e->type == CST_AUDIO_EVENT_PHONE)
+    {
+        if (e->start != et->phone_end)
+            events_test_fail(et,e,"not after the last phone");
+        if ((et->word_start >= 0) && (et->word_start != e->start))
+            events_test_fail(et,e,"not at the start of its word");
+        et->phone_end = e->end;
+        et->word_start = -1;
+    }
+    else if (e->type == CST_AUDIO_EVENT_WORD)
+    {
+        if (cst_streq(e->name,"world") &&
+            ((et->last_mark == NULL) || !cst_streq(et->last_mark,"here")))
+            events_test_fail(et,e,"didn't have its mark before it");
+        et->word_start = e->start;
+        et->last_mark = NULL;
+    }
+    else
+        et->last_mark = e->name;
+
+    return CST_AUDIO_STREAM_CONT;
+}
+
+static int events_test_audio(const cst_wave *w, int start, int size,
+                             int last, cst_audio_streaming_info *asi)
+{
+    events_test *et = (events_test *)asi->userdata;
+
+    et->sent = start+size;
+
+    return CST_AUDIO_STREAM_CONT;
+}
+
+static cst_utterance *events_test_synth(cst_utterance *u)
+{
+    /* Stands in for a synthesizer, streaming a silent wave as long */
+    /* as the segments, a few samples at a time                     */
+    cst_audio_streaming_info *asi;
+    const cst_item *last_seg;
+    cst_wave *w;
+    int start, size;
+
+    last_seg = relation_tail(utt_relation(u,"Segment"));
+    w = new_wave();
+    w->sample_rate = 16000;
+    cst_wave_resize(w,audio_segment_end_sample(last_seg,w->sample_rate),1);
+    asi = val_audio_streaming_info(feat_val(u->features,"streaming_info"));
+    asi->utt = u;
+    for (start=0; start < w->num_samples; start += size)
+    {
+        size = w->num_samples - start;
+        if (size > EVENTS_TEST_CHUNK)
+            size = EVENTS_TEST_CHUNK;
+        audio_stream_send(asi,w,start,size,(start+size == w->num_samples));
+    }
+    utt_set_wave(u,w);
+
+    return u;
+}
+
+static void events_test_check_phones(events_test *et)
+{
+    if (et->phone_end == 0)
+    {
+        printf("FAILED: no phones\n");
+        et->fails++;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    cst_voice *v;
+    cst_audio_streaming_info *asi;
+    flite_prompt_cache *c;
+    flite_prompt_cache_counts counts;
+    events_test et;
+    char *live_log;
+    int fails;
+
+    flite_init();
+
+    v = new_voice();
+    v->name = "events_test";
+    usenglish_init(v);
+    feat_set(v->features,"lexicon",lexicon_val(cmu_lex_init()));
+    feat_set(v->features,"wave_synth_func",uttfunc_val(&events_test_synth));
+
+    memset(&et,0,sizeof(et));
+    asi = new_audio_streaming_info();
+    asi->asc = events_test_audio;
+    asi->event = events_test_event;
+    asi->userdata = &et;
+    asi->min_buffsize = EVENTS_TEST_CHUNK;  /* for cached prompts */
+    feat_set(v->features,"streaming_info",audio_streaming_info_val(asi));
+
+    flite_ssml_text_to_speech("<speak>Hello <mark name=\"here\"/>world, "
+                              "this is a test.</speak>",v,"none");
+
+    events_test_check_phones(&et);
+    fails = et.fails;
+
+    /* The same prompt synthesized, then from the cache */
+    c = new_flite_prompt_cache(10000000,0,NULL);
+    feat_set(v->features,"prompt_cache",prompt_cache_val(c));
+    memset(&et,0,sizeof(et));
+    flite_text_to_speech("Hello there, this is a test.",v,"none");
+    events_test_check_phones(&et);
+    live_log = cst_strdup(et.log);
+    fails += et.fails;
+
+    memset(&et,0,sizeof(et));
+    flite_text_to_speech("Hello there, this is a test.",v,"none");
+    events_test_check_phones(&et);
+    flite_prompt_cache_stats(c,&counts);
+    if (counts.hits != 1)
+    {
+        printf("FAILED: wasn't cached\n");
+        et.fails++;
+    }
+    if (!cst_streq(live_log,et.log))
+    {
+        printf("FAILED: cached events differ\n");
+        et.fails++;
+    }
+    fails += et.fails;
+    cst_free(live_log);
+    feat_remove(v->features,"prompt_cache");
+    delete_flite_prompt_cache(c);
+
+    printf("%s\n",(fails ? "FAILED" : "ok"));
+
+    delete_voice(v);
+
+    return (fails ? 1 : 0);
+}
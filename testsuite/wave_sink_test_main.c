@@ -0,0 +1,209 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Check that waves written through a cst_wave_sink make the same files */
+/*  as the old save and append functions, for riff, au and raw, and that */
+/*  a sink opened on an fd leaves what's before it alone                 */
+/*                                                                       */
+/*************************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+#include "flite.h"
+
+#define SINK_TEST_WAVES 5
+#define SINK_TEST_PREFIX "container header"
+
+static int fails = 0;
+
+static void sink_test_check(int ok, const char *what)
+{
+    if (!ok)
+    {
+        printf("FAILED: %s\n",what);
+        fails++;
+    }
+}
+
+static unsigned char *sink_test_read(const char *filename, int *size)
+{
+    FILE *fd;
+    unsigned char *b;
+
+    *size = 0;
+    if ((fd = fopen(filename,"rb")) == NULL)
+        return cst_alloc(unsigned char,1);
+    fseek(fd,0,SEEK_END);
+    *size = ftell(fd);
+    fseek(fd,0,SEEK_SET);
+    b = cst_alloc(unsigned char,*size+1);
+    *size = fread(b,1,*size,fd);
+    fclose(fd);
+    return b;
+}
+
+static unsigned int sink_test_be32(const unsigned char *b)
+{
+    return (b[0] << 24) | (b[1] << 16) | (b[2] << 8) | b[3];
+}
+
+static void sink_test_write(cst_wave **waves, const char *filename,
+                            const char *type)
+{
+    cst_wave_sink *s;
+    int i;
+
+    s = cst_wave_sink_open(filename,type);
+    sink_test_check(s != NULL,"opening sink");
+    if (s == NULL)
+        return;
+    for (i=0; i < SINK_TEST_WAVES; i++)
+        sink_test_check(cst_wave_sink_write(s,waves[i]) == 0,"writing");
+    sink_test_check(cst_wave_sink_close(s) == 0,"closing sink");
+}
+
+static void sink_test_same(const char *a, const char *b, int skip,
+                           const char *what)
+{
+    /* b, after its first skip bytes, is the same as a */
+    unsigned char *ab, *bb;
+    int asize, bsize;
+
+    ab = sink_test_read(a,&asize);
+    bb = sink_test_read(b,&bsize);
+    sink_test_check((asize > 0) && (asize+skip == bsize) &&
+                    (memcmp(ab,bb+skip,asize) == 0),what);
+    cst_free(ab);
+    cst_free(bb);
+}
+
+int main(int argc, char **argv)
+{
+    cst_wave *waves[SINK_TEST_WAVES], *all, *w;
+    unsigned char *b;
+    cst_wave_sink *s;
+    cst_file fd;
+    int i, j, size, total = 0;
+
+    /* Some waves of different lengths, one of them empty */
+    all = new_wave();
+    all->sample_rate = 16000;
+    all->num_channels = 1;
+    for (i=0; i < SINK_TEST_WAVES; i++)
+    {
+        waves[i] = new_wave();
+        waves[i]->sample_rate = 16000;
+        cst_wave_resize(waves[i],(i == 2) ? 0 : 1000 + 3457*i,1);
+        for (j=0; j < waves[i]->num_samples; j++)
+            waves[i]->samples[j] = (short)((j*7919 + i*104729) % 65536 - 32768);
+        total += waves[i]->num_samples;
+        concat_wave(all,waves[i]);
+    }
+
+    /* riff: as cst_wave_save_riff() then cst_wave_append_riff() */
+    cst_wave_save_riff(waves[0],"wave_sink_test_old.wav");
+    for (i=1; i < SINK_TEST_WAVES; i++)
+        cst_wave_append_riff(waves[i],"wave_sink_test_old.wav");
+    sink_test_write(waves,"wave_sink_test.wav","riff");
+    sink_test_same("wave_sink_test_old.wav","wave_sink_test.wav",0,
+                   "riff differs from appended riff");
+    w = new_wave();
+    sink_test_check((cst_wave_load_riff(w,"wave_sink_test.wav") ==
+                     CST_OK_FORMAT) && (w->num_samples == total) &&
+                    (memcmp(w->samples,all->samples,total*2) == 0),
+                    "riff samples");
+    delete_wave(w);
+
+    /* raw: as cst_wave_save_raw() of them all */
+    cst_wave_save_raw(all,"wave_sink_test_old.raw");
+    sink_test_write(waves,"wave_sink_test.raw","raw");
+    sink_test_same("wave_sink_test_old.raw","wave_sink_test.raw",0,
+                   "raw differs from saved raw");
+
+    /* au: there's no old writer, so check the header and samples */
+    sink_test_write(waves,"wave_sink_test.au","au");
+    b = sink_test_read("wave_sink_test.au",&size);
+    sink_test_check(size == 24 + total*2,"au size");
+    if (size == 24 + total*2)
+    {
+        sink_test_check((sink_test_be32(b) == CST_SND_MAGIC) &&
+                        (sink_test_be32(b+4) == 24) &&
+                        (sink_test_be32(b+8) == (unsigned int)total*2) &&
+                        (sink_test_be32(b+12) == CST_SND_SHORT) &&
+                        (sink_test_be32(b+16) == 16000) &&
+                        (sink_test_be32(b+20) == 1),"au header");
+        for (j=0; j < total; j++)
+            if ((short)((b[24+2*j] << 8) | b[24+2*j+1]) != all->samples[j])
+                break;
+        sink_test_check(j == total,"au samples");
+    }
+    cst_free(b);
+
+    /* A sink on an fd after something else, with a checkpoint too */
+    fd = cst_fopen("wave_sink_test_fd.wav",CST_OPEN_WRITE|CST_OPEN_BINARY);
+    cst_fwrite(fd,SINK_TEST_PREFIX,1,cst_strlen(SINK_TEST_PREFIX));
+    s = cst_wave_sink_open_fd(fd,"riff");
+    for (i=0; i < SINK_TEST_WAVES; i++)
+    {
+        cst_wave_sink_write(s,waves[i]);
+        if (i == 1)
+            cst_wave_sink_checkpoint(s);
+    }
+    cst_wave_sink_close(s);
+    cst_fclose(fd);
+    b = sink_test_read("wave_sink_test_fd.wav",&size);
+    sink_test_check((size > cst_strlen(SINK_TEST_PREFIX)) &&
+                    (memcmp(b,SINK_TEST_PREFIX,
+                            cst_strlen(SINK_TEST_PREFIX)) == 0),
+                    "what was before the fd's sink");
+    cst_free(b);
+    sink_test_same("wave_sink_test.wav","wave_sink_test_fd.wav",
+                   cst_strlen(SINK_TEST_PREFIX),"riff on an fd");
+
+    remove("wave_sink_test_old.wav");
+    remove("wave_sink_test.wav");
+    remove("wave_sink_test_old.raw");
+    remove("wave_sink_test.raw");
+    remove("wave_sink_test.au");
+    remove("wave_sink_test_fd.wav");
+    for (i=0; i < SINK_TEST_WAVES; i++)
+        delete_wave(waves[i]);
+    delete_wave(all);
+
+    printf("%s\n",(fails ? "FAILED" : "ok"));
+
+    return (fails ? 1 : 0);
+}
@@ -76,7 +76,7 @@ void cmu_LANGNAME_lang_init(cst_voice *v)
     feat_set(v->features,"utt_break",breakfunc_val(&default_utt_break));
 
     /* Phoneset -- need to get this from voice */
-    feat_set(v->features,"phoneset",phoneset_val(&cmu_LANGNAME_phoneset));
+    phoneset_set(v->features,&cmu_LANGNAME_phoneset);
     feat_set_string(v->features,"silence",cmu_LANGNAME_phoneset.silence);
 
     /* Get information from voice and add to lexicon */
@@ -0,0 +1,320 @@
+/*************************************************************************/
+/*                                                                       */
+/*                  Language Technologies Institute                      */
+/*                     Carnegie Mellon University                        */
+/*                        Copyright (c) 2026                             */
+/*                        All Rights Reserved.                           */
+/*                                                                       */
+/*  Permission is hereby granted, free of charge, to use and distribute  */
+/*  this software and its documentation without restriction, including   */
+/*  without limitation the rights to use, copy, modify, merge, publish,  */
+/*  distribute, sublicense, and/or sell copies of this work, and to      */
+/*  permit persons to whom this work is furnished to do so, subject to   */
+/*  the following conditions:                                            */
+/*   1. The code must retain the above copyright notice, this list of    */
+/*      conditions and the following disclaimer.                         */
+/*   2. Any modifications must be clearly marked as such.                */
+/*   3. Original authors' names are not deleted.                         */
+/*   4. The authors' names are not used to endorse or promote products   */
+/*      derived from this software without specific prior written        */
+/*      permission.                                                      */
+/*                                                                       */
+/*  CARNEGIE MELLON UNIVERSITY AND THE CONTRIBUTORS TO THIS WORK         */
+/*  DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE, INCLUDING      */
+/*  ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO EVENT   */
+/*  SHALL CARNEGIE MELLON UNIVERSITY NOR THE CONTRIBUTORS BE LIABLE      */
+/*  FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES    */
+/*  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN   */
+/*  AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,          */
+/*  ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF       */
+/*  THIS SOFTWARE.                                                       */
+/*                                                                       */
+/*************************************************************************/
+/*************************************************************************/
+/*               Date:  October 2026                                     */
+/*************************************************************************/
+/*                                                                       */
+/*  Compiles the fixed US English prosody models (the accent, tone       */
+/*  and duration carts and the F0 linear regression model) to C, with    */
+/*  each feature path turned into direct item calls.  The output is      */
+/*  lang/usenglish/us_prosody_compiled.c                                 */
+/*                                                                       */
+/*************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cst_cart.h"
+#include "usenglish.h"
+#include "us_f0.h"
+
+/* The carts to compile, by the name of the C tree (less _cart) */
+static const struct compile_cart_struct {
+    const char *name;
+    const cst_cart *tree;
+} compile_carts[] = {
+    { "us_int_accent", &us_int_accent_cart },
+    { "us_int_tone", &us_int_tone_cart },
+    { "us_durz", &us_durz_cart },
+    { NULL, NULL }
+};
+
+#define PATH_EXPR_MAX 1024
+
+static const char *path_expr(const char *featpath, char *expr,
+                             char *last)
+{
+    /* C for finding the item featpath is on from i, as ffeature() */
+    /* would; last gets the name of the feature itself             */
+    char tokenstring[200];
+    char *tokens[100];
+    char inner[PATH_EXPR_MAX];
+    int i,j;
+
+    for (i=0; i<199 && featpath[i]; i++)
+        tokenstring[i] = featpath[i];
+    tokenstring[i]='\0';
+    tokens[0] = tokenstring;
+    for (i=0,j=1; tokenstring[i]; i++)
+    {
+        if (strchr(":.",tokenstring[i]))
+        {
+            tokenstring[i] = '\0';
+            tokens[j] = &tokenstring[i+1];
+            j++;
+        }
+    }
+    tokens[j] = NULL;
+
+    strcpy(expr,"i");
+    for (j=0; tokens[j+1]; j++)
+    {
+        strcpy(inner,expr);
+        if (cst_streq(tokens[j],"n"))
+            sprintf(expr,"item_next(%s)",inner);
+        else if (cst_streq(tokens[j],"p"))
+            sprintf(expr,"item_prev(%s)",inner);
+        else if (cst_streq(tokens[j],"pp"))
+            sprintf(expr,"item_prev(item_prev(%s))",inner);
+        else if (cst_streq(tokens[j],"nn"))
+            sprintf(expr,"item_next(item_next(%s))",inner);
+        else if (cst_streq(tokens[j],"parent"))
+            sprintf(expr,"item_parent(%s)",inner);
+        else if (cst_streq(tokens[j],"daughter") ||
+                 cst_streq(tokens[j],"daughter1"))
+            sprintf(expr,"item_daughter(%s)",inner);
+        else if (cst_streq(tokens[j],"daughtern"))
+            sprintf(expr,"item_last_daughter(%s)",inner);
+        else if (cst_streq(tokens[j],"first"))
+            sprintf(expr,"item_first(%s)",inner);
+        else if (cst_streq(tokens[j],"last"))
+            sprintf(expr,"item_last(%s)",inner);
+        else if (cst_streq(tokens[j],"R") && tokens[j+2])
+        {
+            j++;
+            sprintf(expr,"item_as(%s,\"%s\")",inner,tokens[j]);
+        }
+        else
+        {
+            fprintf(stderr,"compile_prosody: can't compile \"%s\" in %s\n",
+                    tokens[j],featpath);
+            exit(-1);
+        }
+        if (strlen(expr) > PATH_EXPR_MAX/2)
+        {
+            fprintf(stderr,"compile_prosody: %s is too long\n",featpath);
+            exit(-1);
+        }
+    }
+    strcpy(last,tokens[j]);
+
+    return expr;
+}
+
+static void compile_feature(FILE *fd, const char *name, int f,
+                            const char *featpath)
+{
+    char expr[PATH_EXPR_MAX], last[200];
+
+    path_expr(featpath,expr,last);
+    fprintf(fd,"static const cst_val *%s_f%d(const cst_item *i,\n",name,f);
+    fprintf(fd,"        const cst_ffunction *ff)\n");
+    fprintf(fd,"{   /* %s */\n",featpath);
+    fprintf(fd,"    return ffeature_at(%s,\n",expr);
+    fprintf(fd,"                       \"%s\",ff[%d]);\n",last,f);
+    fprintf(fd,"}\n\n");
+}
+
+static void compile_names(FILE *fd, const char *name,
+                          const char * const *featpaths, int num_feats)
+{
+    char expr[PATH_EXPR_MAX], last[200];
+    int f;
+
+    fprintf(fd,"static const char * const %s_ffunc_names[] = {\n",name);
+    for (f=0; f<num_feats; f++)
+    {
+        path_expr(featpaths[f],expr,last);
+        fprintf(fd,"    \"%s\",\n",last);
+    }
+    fprintf(fd,"    NULL };\n\n");
+}
+
+static void compile_cart(FILE *fd, const char *name, const cst_cart *tree)
+{
+    const cst_cart_node *nodes = tree->rule_table;
+    const char *test;
+    int num_feats, num_nodes, n, f;
+    char *labelled;
+
+    for (num_feats=0; tree->feat_table[num_feats]; num_feats++);
+    for (num_nodes=0; nodes[num_nodes].val; num_nodes++);
+    if (num_feats > CST_CART_COMPILED_MAX_FEATS)
+    {
+        fprintf(stderr,"compile_prosody: %s has too many features\n",name);
+        exit(-1);
+    }
+
+    fprintf(fd,"/* %s_cart */\n\n",name);
+    for (f=0; f<num_feats; f++)
+        compile_feature(fd,name,f,tree->feat_table[f]);
+    compile_names(fd,name,tree->feat_table,num_feats);
+
+    /* Only nodes that are jumped to need labels */
+    labelled = cst_alloc(char,num_nodes);
+    for (n=0; n<num_nodes; n++)
+        if (nodes[n].op != CST_CART_OP_LEAF)
+            labelled[nodes[n].no_node] = 1;
+
+    fprintf(fd,"static const cst_val *%s_interpret(const cst_item *i,\n",
+            name);
+    fprintf(fd,"        const cst_ffunction *ff)\n");
+    fprintf(fd,"{\n");
+    fprintf(fd,"    const cst_val *f[%d];\n",num_feats);
+    fprintf(fd,"    const cst_val *v;\n");
+    fprintf(fd,"    int k;\n\n");
+    fprintf(fd,"    memset(f,0,sizeof(f));\n");
+    for (n=0; n<num_nodes; n++)
+    {
+        if (labelled[n])
+            fprintf(fd,"n%d:\n",n);
+        if (nodes[n].op == CST_CART_OP_LEAF)
+        {
+            fprintf(fd,"    v = %s_cart.rule_table[%d].val;\n",name,n);
+            fprintf(fd,"    goto done;\n");
+            continue;
+        }
+        switch (nodes[n].op)
+        {
+        case CST_CART_OP_IS: test = "val_equal"; break;
+        case CST_CART_OP_IN: test = "val_member"; break;
+        case CST_CART_OP_LESS: test = "val_less"; break;
+        case CST_CART_OP_GREATER: test = "val_greater"; break;
+        case CST_CART_OP_MATCHES: test = NULL; break;
+        default:
+            fprintf(stderr,"compile_prosody: unknown op %d in %s\n",
+                    nodes[n].op,name);
+            exit(-1);
+        }
+        f = nodes[n].feat;
+        fprintf(fd,"    if (!f[%d]) f[%d] = val_inc_refcount(%s_f%d(i,ff));\n",
+                f,f,name,f);
+        if (test)
+            fprintf(fd,"    if (!%s(f[%d],%s_cart.rule_table[%d].val))\n",
+                    test,f,name,n);
+        else
+            fprintf(fd,"    if (!cst_regex_match(cst_regex_table[val_int("
+                    "%s_cart.rule_table[%d].val)],\n"
+                    "                         val_string(f[%d])))\n",
+                    name,n,f);
+        fprintf(fd,"        goto n%d;\n",nodes[n].no_node);
+    }
+    fprintf(fd,"done:\n");
+    fprintf(fd,"    for (k=0; k<%d; k++)\n",num_feats);
+    fprintf(fd,"        delete_val((cst_val *)(void *)f[k]);\n");
+    fprintf(fd,"    return v;\n");
+    fprintf(fd,"}\n\n");
+    cst_free(labelled);
+
+    fprintf(fd,"const cst_cart_compiled %s_cart_compiled = {\n",name);
+    fprintf(fd,"    &%s_cart,\n",name);
+    fprintf(fd,"    %d,\n",num_feats);
+    fprintf(fd,"    %s_ffunc_names,\n",name);
+    fprintf(fd,"    %s_interpret\n",name);
+    fprintf(fd,"};\n\n");
+}
+
+static void compile_f0_lr(FILE *fd, const char *name, const char *terms_name,
+                          const us_f0_lr_term *terms)
+{
+    const char *featpaths[CST_CART_COMPILED_MAX_FEATS];
+    int num_feats, t;
+
+    /* Runs of terms share a feature, as in apply_lr_model() */
+    fprintf(fd,"/* %s */\n\n",terms_name);
+    fprintf(fd,"static const int %s_term_feats[] = {\n    -1,",name);
+    for (num_feats=0, t=1; terms[t].feature; t++)
+    {
+        if (!cst_streq(terms[t].feature,terms[t-1].feature))
+        {
+            if (num_feats == CST_CART_COMPILED_MAX_FEATS)
+            {
+                fprintf(stderr,"compile_prosody: %s has too many features\n",
+                        terms_name);
+                exit(-1);
+            }
+            featpaths[num_feats++] = terms[t].feature;
+        }
+        fprintf(fd,"%s%d,",(t%16 == 0) ? "\n    " : " ",num_feats-1);
+    }
+    fprintf(fd," };\n\n");
+
+    for (t=0; t<num_feats; t++)
+        compile_feature(fd,name,t,featpaths[t]);
+    compile_names(fd,name,featpaths,num_feats);
+
+    fprintf(fd,"static void %s_features(const cst_item *i,\n",name);
+    fprintf(fd,"        const cst_ffunction *ff, const cst_val **fv)\n");
+    fprintf(fd,"{\n");
+    for (t=0; t<num_feats; t++)
+        fprintf(fd,"    fv[%d] = val_inc_refcount(%s_f%d(i,ff));\n",
+                t,name,t);
+    fprintf(fd,"}\n\n");
+
+    fprintf(fd,"const us_f0_lr_compiled_model %s_compiled = {\n",name);
+    fprintf(fd,"    %s,\n",terms_name);
+    fprintf(fd,"    %s_term_feats,\n",name);
+    fprintf(fd,"    %d,\n",num_feats);
+    fprintf(fd,"    %s_ffunc_names,\n",name);
+    fprintf(fd,"    %s_features\n",name);
+    fprintf(fd,"};\n\n");
+}
+
+int main(int argc, char **argv)
+{
+    FILE *fd = stdout;
+    int i;
+
+    if ((argc > 1) && (cst_streq(argv[1],"-h") || cst_streq(argv[1],"--help")))
+    {
+        printf("compile_prosody: write the US English prosody models as C\n");
+        printf("usage: compile_prosody >us_prosody_compiled.c\n");
+        return 0;
+    }
+
+    fprintf(fd,"/*******************************************************/\n");
+    fprintf(fd,"/**  Autogenerated by tools/compile_prosody from the   */\n");
+    fprintf(fd,"/**  carts and F0 model in lang/usenglish, don't edit   */\n");
+    fprintf(fd,"/*******************************************************/\n\n");
+    fprintf(fd,"#include \"cst_string.h\"\n");
+    fprintf(fd,"#include \"cst_cart.h\"\n");
+    fprintf(fd,"#include \"cst_regex.h\"\n");
+    fprintf(fd,"#include \"usenglish.h\"\n");
+    fprintf(fd,"#include \"us_f0.h\"\n\n");
+
+    for (i=0; compile_carts[i].name; i++)
+        compile_cart(fd,compile_carts[i].name,compile_carts[i].tree);
+    compile_f0_lr(fd,"us_f0_lr","f0_lr_terms",f0_lr_terms);
+
+    return 0;
+}
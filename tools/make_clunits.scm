@@ -69,6 +69,9 @@ Convert a festvox clunits (processed) voice into a C file."
 
    (format ofd "extern const cst_cart * const %s_carts[];\n" name )
    (format ofd "extern cst_sts_list %s_sts, %s_mcep;\n\n" name name )
+   (set! joinsfn (path-append odir (string-append name "_joins.c")))
+   (if (probe_file joinsfn)
+       (format ofd "extern const cst_clunit_join_table %s_join_table;\n\n" name))
 
    (format ofd "cst_clunit_db %s_db = {\n" name)
    (format ofd "  \"%s\",\n\n" name)
@@ -87,7 +90,10 @@ Convert a festvox clunits (processed) voice into a C file."
    (format ofd "  1, /* optimal coupling */\n")
    (format ofd "  5, /* extend selections */\n")
    (format ofd "  100, /* f0 weight */\n")
-   (format ofd "  0  /* unit_name function */\n")
+   (format ofd "  0, /* unit_name function */\n")
+   (if (probe_file joinsfn)
+       (format ofd "  &%s_join_table /* precomputed joins */\n" name)
+       (format ofd "  NULL /* precomputed joins */\n"))
    
    (format ofd "};\n")
 